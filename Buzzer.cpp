@@ -59,6 +59,9 @@ void Buzzer::buzz(unsigned long buzz_duration_micros)
   {
     tone(this->BUZZER_PIN_, this->BUZZ_NOTE_, buzz_duration_micros / this->MICROS_IN_MILLI_);
   }
+
+  // mark it even in quiet mode; the touch got signaled either way 
+  Latency_Probe::mark(Latency_Probe::BUZZER_START);
 }
 
 // Stop emitting sound // TODO protection against calling this in a loop?
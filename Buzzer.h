@@ -14,6 +14,9 @@
 #include <inttypes.h>
 #include <Arduino.h>
 
+// local includes
+#include "Latency_Probe.h"
+
 // A class to control a buzzer for a fencing scoring machine 
 class Buzzer
 {
@@ -0,0 +1,73 @@
+//============================================================================//
+//  Name    : Cycle_Counter.cpp                                               //
+//  Desc    : C++ Implementation for an exact CPU cycle counter built on      //
+//            Timer1                                                          //
+//  Dev     : Nate Cope,                                                      //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - See the header for what this does to Timer1                   //
+//============================================================================//
+
+// interface include
+#include "Cycle_Counter.h"
+
+// static data member definitions
+volatile uint16_t Cycle_Counter::overflows_ = 0;
+unsigned long     Cycle_Counter::overhead_  = 0;
+
+
+// count the high half of the cycle count
+ISR(TIMER1_OVF_vect)
+{
+  Cycle_Counter::overflows_++;
+}
+
+
+// take over Timer1 and start counting from zero
+void Cycle_Counter::begin()
+{
+  uint8_t old_sreg = SREG;
+  noInterrupts();
+
+  TCCR1A     = 0;           // normal mode, no output compare pins
+  TCCR1B     = _BV(CS10);   // no prescaler: one count per CPU cycle
+  TCNT1      = 0;
+  TIFR1      = _BV(TOV1);   // clear any stale overflow (written as a one, weirdly)
+  TIMSK1     = _BV(TOIE1);  // overflow interrupt only
+  overflows_ = 0;
+
+  SREG = old_sreg;
+
+  // figure out what measuring nothing costs
+  unsigned long first = now();
+  overhead_           = now() - first;
+}
+
+
+// the number of cycles since begin()
+unsigned long Cycle_Counter::now()
+{
+  uint8_t old_sreg = SREG;
+  noInterrupts();
+
+  uint16_t low  = TCNT1;
+  uint16_t high = overflows_;
+
+  // an overflow happened but its interrupt hasn't run yet (we're blocking it); if the low half
+  // is small, it wrapped before we read it, so count it ourselves
+  if ((TIFR1 & _BV(TOV1)) && low < 0x8000)
+  {
+    high++;
+  }
+
+  SREG = old_sreg;
+
+  return ((unsigned long)high << 16) | low;
+}
+
+
+// the number of cycles a back-to-back pair of now() calls reports
+unsigned long Cycle_Counter::get_overhead()
+{
+  return overhead_;
+}
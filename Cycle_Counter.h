@@ -0,0 +1,53 @@
+//============================================================================//
+//  Name    : Cycle_Counter.h                                                 //
+//  Desc    : C++ Interface for an exact CPU cycle counter built on Timer1    //
+//  Dev     : Nate Cope,                                                      //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Timer1 runs unprescaled at the CPU clock, so one count is one //
+//              cycle (62.5ns at 16MHz), versus micros()' 4us granularity     //
+//            - An overflow interrupt extends it to 32 bits (~268s at 16MHz), //
+//              plenty for timing anything the main loop does                 //
+//            - Takes over Timer1 completely; don't use it alongside anything //
+//              else that wants Timer1 (Servo, etc.). tone() uses Timer2 and  //
+//              micros() uses Timer0, so neither is affected                  //
+//            - NeoPixel's show() blocks interrupts; an overflow that lands   //
+//              inside one is still caught, as long as show() takes less than //
+//              one full Timer1 period (4ms), which ours do by a mile         //
+//============================================================================//
+
+#ifndef CYCLE_COUNTER_H
+#define CYCLE_COUNTER_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+
+// A static class to count CPU cycles for benchmarking
+class Cycle_Counter
+{
+  public:
+
+    // take over Timer1 and start counting from zero
+    static void begin();
+
+    // the number of cycles since begin(), to the cycle (well, give or take get_overhead())
+    static unsigned long now();
+
+    // the number of cycles a back-to-back pair of now() calls reports; subtract it from
+    // short measurements to get the cost of just the code in between
+    static unsigned long get_overhead();
+
+    // conversion constant for anyone reporting in microseconds
+    static const unsigned long CYCLES_PER_MICRO_ = F_CPU / 1000000UL;
+
+    // NB: public only so the overflow interrupt can get at it; don't touch
+    static volatile uint16_t overflows_;
+
+  private:
+
+    // measured in begin()
+    static unsigned long overhead_;
+};
+
+#endif
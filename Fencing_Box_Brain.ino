@@ -35,7 +35,10 @@
 //============
 // #defines
 //============
-#define DEBUG 0 // 1 == weapon testing, 2 = main loop timing
+#ifndef DEBUG   // (the host/ builds pick their own)
+#define DEBUG 0 // 1 == weapon testing, 2 = main loop timing, 3 = hit-to-light latency probe, 4 = component benchmarks and per-tick cycle counts,
+                //   5 = record a line trace over Serial (replay it, or sweep timings over it, with host/ tools)
+#endif
 
 //============
 // #includes
@@ -45,8 +48,16 @@
 // Local Includes
 #include "Fencing_Clock.h"
 #include "Fencing_Point_Displays.h"
+#include "Seven_Segment_Bus.h"
+#include "Fixed_Pin_Transfer.h"
+#include "Seven_Segment_Background.h"
 #include "Fencing_Light_Displays.h"
 #include "Buzzer.h"
+#include "Latency_Probe.h"
+#include "Timing_Statistics.h"
+#include "Cycle_Counter.h"
+#include "Line_Trace.h"
+#include "Hit_Detector.h"
 
 
 //============
@@ -91,8 +102,15 @@ const uint8_t TIME_DISPLAY_DATA_PIN_                = LEFT_FENCER_SCORE_DISPLAY_
 const uint8_t LEFT_FENCER_RING_LIGHT_CONTROL_PIN_   = 13; // pin for communication with left fencer scoring light
 const uint8_t RIGHT_FENCER_RING_LIGHT_CONTROL_PIN_  = 8; // pin for communication with right fencer scoring light
 const uint8_t BUZZER_CONTROL_PIN_                   = 6;  // pin for sending commands to buzzer module
+const uint8_t LATENCY_PROBE_PIN_                    = 0;  // spare pin toggled at every hit pipeline stage under DEBUG 3, pin AKA RX (the quiet mode button doesn't exist yet)
 
-// enums (currently just mode)
+// Display transport 
+const bool    DISPLAYS_SEND_IN_BACKGROUND_          = false; // send the displays' traffic from a Timer1 interrupt at a fixed rate, instead of a little every loop (never under DEBUG 4, which has Timer1 counting cycles)
+
+// Ring light wiring 
+const bool    RING_LIGHTS_CHAINED_                  = false; // the right ring's DIN is wired to the left ring's DOUT, so both go out on LEFT_FENCER_RING_LIGHT_CONTROL_PIN_ in one show()
+
+// enums
 enum mode
 {
   SABER,
@@ -109,7 +127,6 @@ enum mode
 
 // Timing Constants
 const unsigned long MICROS_IN_SEC                       = 1000000;                // conversion constant; "avoiding magic numbers"
-const unsigned long LIGHT_DURATION_MICROS               = 3 * MICROS_IN_SEC;      // length of time the lights are kept on after a hit ((microseconds)
 const unsigned long BAUDRATE                            = 57600;//9600;                  // baudrate of the serial debug interface
 const unsigned long CLOCK_ADJUSTMENT_RATE_TICK_MICROS   = 0.333 * MICROS_IN_SEC;  // how fast the time increments / decrements when the corresponding button is held down
 const unsigned long CLOCK_ADJUSTMENT_RATE_CHANGE_MICROS = 2 * MICROS_IN_SEC;      // how fast the time increments / decrements increase in size when the corresponding button is held down
@@ -122,23 +139,6 @@ const unsigned long CLOCK_STANDARD_START_MICROS_        = 3 * 60 * MICROS_IN_SEC
 const unsigned long REMOTE_BUTTON_MODE_2_HOLD_DURATION_ = 1 * MICROS_IN_SEC;      // the time a remote button must be held down to activate its second mode
 const unsigned long DISPLAY_MODE_CHANGE_TEXT_LENGTH_    = 1 * MICROS_IN_SEC;      // the duration to display the name of the new mode
 
-// Lockout & Depress Times
-// the lockout time between hits for foil is 300ms +/-25ms
-// the minimum amount of time the tip needs to be depressed for foil 14ms +/-1ms
-// the lockout time between hits for epee is 45ms +/-5ms
-// the minimum amount of time the tip needs to be depressed for epee 2ms
-// the lockout time between hits for sabre is 170ms +/-10ms
-// the minimum amount of time blade needs to be in contact for sabre 0.1ms <-> 1ms
-// These values are stored as micro seconds for more accuracy
-// we use the minimum times for contact so that we have the most edge on any processing lag,
-// we use the middle times for lockout to balance post-hit processing lag (lights) with pre-hit processing lag
-const unsigned long SABER_LOCKOUT_MICROS_  = 170000;
-const unsigned long FOIL_LOCKOUT_MICROS_   = 300000;
-const unsigned long EPEE_LOCKOUT_MICROS_   = 45000;
-const unsigned long SABER_CONTACT_MICROS_  = 100;
-const unsigned long FOIL_CONTACT_MICROS_   = 13000;
-const unsigned long EPEE_CONTACT_MICROS_   = 2000;
-
 // Analog read constants (may need tuning)
 const unsigned long ANALOG_READ_ON_TARGET_THRESHOLD_LOW_            = 450;//400;
 const unsigned long ANALOG_READ_ON_TARGET_THRESHOLD_HIGH_           = 600;//600;
@@ -149,6 +149,8 @@ const unsigned long ANALOG_READ_OFF_TARGET_A_THRESHOLD_LOW_         = 900;//900;
 
 // Debugging constants
 const unsigned long CYCLES_PER_TIMING_EVENT_ = 5000; 
+const unsigned long BENCHMARK_ITERATIONS_    = 1000;  // calls timed per component under DEBUG 4
+const uint16_t      LINE_TRACE_SAMPLE_MICROS_ = 250;   // roughly how often the main loop samples the lines; replays re-sample held line states this often
 
 //=============================
 // Data Members and Attributes
@@ -157,9 +159,13 @@ const unsigned long CYCLES_PER_TIMING_EVENT_ = 5000;
 // A/V components
 Fencing_Point_Displays*  scoreboard_;
 Fencing_Clock*           clock_;
+Seven_Segment_Bus*       display_bus_;
 Buzzer*                  buzzer_;
 Fencing_Light_Displays*  lights_;
 
+// the hit detection itself 
+Hit_Detector*            hit_detector_;
+
 // button states
 bool            remote_button_a_pressed_              = false;
 bool            remote_button_b_pressed_              = false;
@@ -173,6 +179,7 @@ uint8_t         remote_button_a_last_tick_reacted_to_ = 0;
 uint8_t         remote_button_b_last_tick_reacted_to_ = 0;
 uint8_t         remote_button_c_last_tick_reacted_to_ = 0;
 uint8_t         remote_button_d_last_tick_reacted_to_ = 0;
+uint8_t         remote_button_c_timer_at_depression_  = Fencing_Clock::BOUT_TIMER; // which timer was shown when button C went down
 bool            mode_switch_button_pressed_           = false;
 bool            clock_time_increment_button_pressed_  = false;
 bool            clock_time_decrement_button_pressed_  = false;
@@ -196,20 +203,16 @@ bool right_fencer_b_weapon_line_reading_high_ = false;
 bool left_fencer_a_lame_line_reading_high_    = false;
 bool right_fencer_a_lame_line_reading_high_   = false;
 
-// hit interpretation variables
-unsigned long left_fencer_contact_start_time_         = 0;
-unsigned long right_fencer_contact_start_time_        = 0;
-bool          locked_out_                             = false;
-unsigned long left_fencer_time_of_registered_hit_     = 0;
-unsigned long right_fencer_time_of_registered_hit_    = 0;
+// hit signalling (the hits themselves are hit_detector_'s business)
 bool          contact_reset_after_hit_signaled_       = true; //TODO switch on mode switch?
-unsigned long time_of_lockout_                        = 0;
-bool          left_fencer_contact_made_               = false;
-bool          right_fencer_contact_made_              = false;
-bool          left_fencer_hit_on_target_              = false;
-bool          left_fencer_hit_off_target_             = false;
-bool          right_fencer_hit_on_target_             = false;
-bool          right_fencer_hit_off_target_            = false;
+
+// line trace recording 
+Line_Trace*   line_trace_;
+
+// whether the bout's time was running down last pass, to catch it running out, and whether the alert for it is 
+// waiting on a touch to play out 
+bool          bout_timer_was_running_                 = false;
+bool          time_up_alert_pending_                  = false;
 
 // Debugging variables TODO can't like all of these be local instead? or is that not cleaner?
 unsigned long timing_event_start_micros_              = 0;
@@ -218,6 +221,31 @@ unsigned long last_cycle_start_                       = 0;
 unsigned long worst_cycle_time_                       = 0;   
 unsigned long second_worst_cycle_time_                = 0;   
 unsigned long third_worst_cycle_time_                 = 0;   
+
+// top of the heap once setup() is done with it; everything after should run without allocating (avr-libc's own marker)
+extern char*  __brkval;
+char*         heap_top_after_setup_                   = NULL;
+
+
+
+//======================
+// Function Prototypes
+//======================
+// (the Arduino IDE writes these itself, but the host/ builds compile the sketch as plain C++, which needs them spelled out)
+void               watch_for_time_up();
+void               signal_hits(unsigned long current_time);
+void               reset_hit_detection();
+void               handle_clock_adjustment_buttons(unsigned long current_time);
+void               handle_remote_input(unsigned long current_time);
+void               run_component_benchmarks();
+void               tick_components_counting_cycles(unsigned long current_time);
+void               tick_display_bus(unsigned long current_time);
+void               print_display_bus_statistics();
+void               print_light_blackout_statistics();
+void               print_clock_lag_statistics();
+void               print_heap_growth();
+void               handle_mode_switch_button();
+void               handle_quiet_mode_button();
            
 
 
@@ -251,8 +279,33 @@ void setup()
                                             RIGHT_FENCER_SCORE_DISPLAY_DATA_PIN_
                                           );
   clock_      = new Fencing_Clock(TIME_DISPLAY_CLK_PIN_, TIME_DISPLAY_DATA_PIN_);
+
+  // the display pins never change, so the displays can send with every edge one instruction instead of a digitalWrite() 
+  clock_->clock_                          ->use_transfer(new Fixed_Pin_Transfer<TIME_DISPLAY_CLK_PIN_,               TIME_DISPLAY_DATA_PIN_              >());
+  scoreboard_->left_fencer_score_display_ ->use_transfer(new Fixed_Pin_Transfer<LEFT_FENCER_SCORE_DISPLAY_CLK_PIN_,  LEFT_FENCER_SCORE_DISPLAY_DATA_PIN_ >());
+  scoreboard_->right_fencer_score_display_->use_transfer(new Fixed_Pin_Transfer<RIGHT_FENCER_SCORE_DISPLAY_CLK_PIN_, RIGHT_FENCER_SCORE_DISPLAY_DATA_PIN_>());
+
+  // the displays all share a data pin, so whatever they all need sending (e.g. the mode names) only goes out once; 
+  // unless they're sending from the timer interrupt instead, in which case the loop only hands it frames 
+  display_bus_ = new Seven_Segment_Bus(TIME_DISPLAY_DATA_PIN_);
+  if (DISPLAYS_SEND_IN_BACKGROUND_ && DEBUG != 4 && Seven_Segment_Background::begin())
+  {
+    clock_->clock_                          ->send_in_background();
+    scoreboard_->left_fencer_score_display_ ->send_in_background();
+    scoreboard_->right_fencer_score_display_->send_in_background();
+  }
+  else
+  {
+    display_bus_->add_display(clock_->clock_);
+    display_bus_->add_display(scoreboard_->left_fencer_score_display_);
+    display_bus_->add_display(scoreboard_->right_fencer_score_display_);
+  }
+
   buzzer_     = new Buzzer(BUZZER_CONTROL_PIN_);
-  lights_     = new Fencing_Light_Displays(LEFT_FENCER_RING_LIGHT_CONTROL_PIN_, RIGHT_FENCER_RING_LIGHT_CONTROL_PIN_);
+  lights_     = new Fencing_Light_Displays(LEFT_FENCER_RING_LIGHT_CONTROL_PIN_, RIGHT_FENCER_RING_LIGHT_CONTROL_PIN_, RING_LIGHTS_CHAINED_);
+
+  hit_detector_ = new Hit_Detector();
+  hit_detector_->set_mode(current_mode_);
 
   if (DEBUG > 0)
   {
@@ -260,13 +313,44 @@ void setup()
     Serial.begin(BAUDRATE);
   }
 
+  if (DEBUG == 5)
+  {
+    // the trace goes out over the debug serial link 
+    line_trace_ = new Line_Trace(&Serial);
+    line_trace_->begin_recording(micros(), LINE_TRACE_SAMPLE_MICROS_);
+  }
+
+  if (DEBUG == 3)
+  {
+    // the probe pin doubles as the serial RX pin; we only ever transmit reports, so hand it back
+    UCSR0B &= ~_BV(RXEN0);
+
+    // start marking the hit pipeline 
+    Latency_Probe::begin(LATENCY_PROBE_PIN_);
+  }
+
   // why not just be sure?
-  reset_values();
+  reset_hit_detection();
 
   // annoying reset TODO make cleaner
   lights_->display_right_on_target(); 
   lights_->display_left_on_target(); 
   lights_->reset_lights();
+  lights_->commit();
+  lights_->reset_blackout_statistics();
+
+  // say hello; it plays out a frame at a time from the main loop, so it holds nothing up 
+  lights_->show_off_on_startup();
+
+  // everything's been allocated; from here on the heap shouldn't move 
+  heap_top_after_setup_ = __brkval;
+
+  // time the main per-loop work, call by call, before the box starts up for real 
+  if (DEBUG == 4)
+  {
+    Cycle_Counter::begin(); 
+    run_component_benchmarks();
+  }
 }
 
 
@@ -282,10 +366,21 @@ void loop()
     unsigned long current_time = micros(); 
  
     // update all major components on time elapsed
-    scoreboard_ ->tick(current_time);   // Timing NB: this line is now like 0.03 milliseconds per average cycle (without timer or lights on)
-    clock_      ->tick(current_time);   // Timing NB: this line is now like 0.06 milliseconds per average cycle (without timer or lights on)
-    buzzer_     ->tick(current_time);   // Timing NB: this line doesn't do anything; makes sense as it's a no-op 
-    lights_     ->tick(current_time);   // Timing NB: this line doesn't do anything; makes sense as it's a no-op 
+    if (DEBUG == 4) // same thing, but with every tick counted to the cycle 
+    {
+      tick_components_counting_cycles(current_time); 
+    }
+    else
+    {
+      scoreboard_ ->tick(current_time);   // Timing NB: this line is now like 0.03 milliseconds per average cycle (without timer or lights on)
+      clock_      ->tick(current_time);   // Timing NB: this line is now like 0.06 milliseconds per average cycle (without timer or lights on)
+      tick_display_bus(current_time);
+      buzzer_     ->tick(current_time);   // Timing NB: this line doesn't do anything; makes sense as it's a no-op 
+      lights_     ->tick(current_time);   // Timing NB: only draws anything while an animation's playing 
+    }
+
+    // flash the lights if the bout's time just ran out 
+    watch_for_time_up();
   
     // check user inputs and act on them
     handle_remote_input(current_time);
@@ -303,7 +398,14 @@ void loop()
     right_fencer_a_lame_line_reading_high_   = digitalRead(RIGHT_FENCER_A_LAME_LINE_PIN_);
 
     // interpret hit for left fencer (based on mode) // basically free, timewise [before hit registered)
-    process_hits(current_time, true);
+    hit_detector_->process_left_phase(current_time, left_fencer_b_weapon_line_reading_high_, left_fencer_a_lame_line_reading_high_, right_fencer_a_lame_line_reading_high_);
+
+    // hang on to the left fencer's half of the sample if we're recording a line trace 
+    uint8_t traced_lines = 0; 
+    if (DEBUG == 5)
+    {
+      traced_lines = Line_Trace::encode_left_phase(left_fencer_b_weapon_line_reading_high_, left_fencer_a_lame_line_reading_high_, right_fencer_a_lame_line_reading_high_);
+    }
 
     // set up the left fencer's weapon to be the only one powered 
     digitalWrite(LEFT_FENCER_B_WEAPON_LINE_POWER_PIN_,   LOW);
@@ -314,11 +416,24 @@ void loop()
     right_fencer_a_lame_line_reading_high_   = digitalRead(RIGHT_FENCER_A_LAME_LINE_PIN_);
 
     // interpret hit for right fencer (based on mode) // basically free, timewise [before hit registered)
-    process_hits(current_time, false);
+    hit_detector_->process_right_phase(current_time, right_fencer_b_weapon_line_reading_high_, left_fencer_a_lame_line_reading_high_, right_fencer_a_lame_line_reading_high_);
+
+    // record the whole sample, if it's changed 
+    if (DEBUG == 5)
+    {
+      traced_lines |= Line_Trace::encode_right_phase(right_fencer_b_weapon_line_reading_high_, left_fencer_a_lame_line_reading_high_, right_fencer_a_lame_line_reading_high_);
+      line_trace_->record_sample(current_time, traced_lines, current_mode_);
+    }
 
     // react to equipment inputs as necessary // basically free, timewise [before hit registered)
     signal_hits(current_time);
 
+    // then push whatever the lights did this pass out in one go; both fencers' lines have been read and judged 
+    // by now, so this is the one place a show()'s interrupt blackout can't land in the middle of a sample 
+    // (and animations wait for the touch, if there's one going) 
+    lights_->set_contact_pending(hit_detector_->is_contact_pending());
+    lights_->commit();
+
 
     // weapons bugtesting 
     if (DEBUG == 1)
@@ -398,6 +513,15 @@ void loop()
         Serial.print("\tThird Worst Cycle: ");
         Serial.print(third_worst_cycle_time_);
         Serial.println("");
+
+        // what the seven-segment displays cost on the bus over the same stretch 
+        print_display_bus_statistics(); 
+
+        // how far off the true tenths / seconds the clock's digits landed (and, if asked, try the other way next) 
+        print_clock_lag_statistics(); 
+
+        // and whether anything's been allocating 
+        print_heap_growth(); 
    
         // reset the cycle count 
         cycles_passed_                = 0; 
@@ -450,232 +574,36 @@ void loop()
 } // end of loop() function 
 
 
-//=================================================================================================================
-// process_hits - determines hit, lockout, and timeout statuses based on current equipment inputs and current mode
-//    parameter:  current_time - the time in microseconds passed since the last processing
+//============================================================================================
+// watch_for_time_up - flashes the lights when the bout's time runs all the way out (but not
+//                     when it's stopped early, e.g. by a touch); if it runs out in the middle
+//                     of a touch (a hit's in, but the lockout isn't up yet), the touch plays
+//                     out first, lights and all, and the flash comes after
 //    output:   none
-//================================================================================================================
-void process_hits(unsigned long current_time, bool left_fencer_weapon_powered)
+//============================================================================================
+void watch_for_time_up()
 {
-  // first, check for hits!
-
-  // check the left fencer's circuit if it's the one currently live 
-  if (left_fencer_weapon_powered)
-  {
-    // if the left fencer already has a hit, no need to confirm it again
-    if ((!locked_out_) && !(left_fencer_hit_on_target_ || left_fencer_hit_off_target_) )
-    {
-      // if the left fencer's registering a hit, then add that time to their tally (or start the tally if they weren't already hitting) NB: these methods account for mode already
-      if ( 
-           is_reading_on_target (left_fencer_b_weapon_line_reading_high_, right_fencer_a_lame_line_reading_high_, left_fencer_a_lame_line_reading_high_)   ||    
-           is_reading_off_target(left_fencer_b_weapon_line_reading_high_, right_fencer_a_lame_line_reading_high_, left_fencer_a_lame_line_reading_high_)
-         )  
-      {
-        if (!left_fencer_contact_made_)
-        {
-          // note the contact 
-          left_fencer_contact_made_ = true;
-  
-          // record when the contact started 
-          left_fencer_contact_start_time_ = current_time;
-        }
-      }
-      else
-      {
-        // if there's no contact, then reset the counters
-        left_fencer_contact_made_       = false;
-        left_fencer_contact_start_time_ = 0;
-      }
-  
-      // if the left fencer is in contact and has exceeded the necessary contact time, mark a hit
-      // TODO NB: there's a weird situation where foil can start on-target and slide to off-target and the on-target depressed time counts. Is that right?
-      if ( left_fencer_contact_made_ &&
-           (
-            ((current_mode_ == mode::SABER) && ((unsigned long)(current_time - left_fencer_contact_start_time_) > SABER_CONTACT_MICROS_) ) ||
-            ((current_mode_ == mode::FOIL)  && ((unsigned long)(current_time - left_fencer_contact_start_time_) > FOIL_CONTACT_MICROS_ ) ) ||
-            ((current_mode_ == mode::EPEE)  && ((unsigned long)(current_time - left_fencer_contact_start_time_) > EPEE_CONTACT_MICROS_ ) )
-           )
-         )
-      {
-        // if you're foil, you gotta check if you're off target (NB: the method accounts for mode)
-        if (is_reading_off_target(left_fencer_b_weapon_line_reading_high_, right_fencer_a_lame_line_reading_high_, left_fencer_a_lame_line_reading_high_))
-        {
-          left_fencer_hit_off_target_          = true;
-          left_fencer_time_of_registered_hit_  = current_time;
-        }
-        // every other weapon can only get here by being on-target, as off-targets don't exist TODO TODO still check on target as an error checking measure???
-        else
-        {
-          left_fencer_hit_on_target_           = true;
-          left_fencer_time_of_registered_hit_  = current_time;
-        }
-      } // end if just got a valid hit 
-    } // end if not locked out or if already has a hit registered 
-  } // end if the left fencer weapon is the one that's powered 
-
-  // check the right fencer's circuit if it's the one currently live 
-  else // i.e., the left fencer's circuit isn't the one that's on right now 
-  {
-    // if the right fencer already has a hit, no need to confirm it again
-    if ((!locked_out_) && !(right_fencer_hit_on_target_ || right_fencer_hit_off_target_) )
-    {
-      // if the right fencer's registering a hit, then add that time to their tally (or start the tally if they weren't already hitting) NB: these methods account for mode already
-      if ( 
-           is_reading_on_target (right_fencer_b_weapon_line_reading_high_, left_fencer_a_lame_line_reading_high_, right_fencer_a_lame_line_reading_high_)   ||    
-           is_reading_off_target(right_fencer_b_weapon_line_reading_high_, left_fencer_a_lame_line_reading_high_, right_fencer_a_lame_line_reading_high_)
-         )  
-      {
-        if (!right_fencer_contact_made_)
-        {
-          // note the contact 
-          right_fencer_contact_made_ = true;
-  
-          // record when the contact started 
-          right_fencer_contact_start_time_ = current_time;
-        }
-      }
-      else
-      {
-        // if there's no contact, then reset the counters
-        right_fencer_contact_made_       = false;
-        right_fencer_contact_start_time_ = 0;
-      }
-  
-      // if the right fencer is in contact and has exceeded the necessary contact time, mark a hit
-      // TODO NB: there's a weird situation where foil can start on-target and slide to off-target and the on-target depressed time counts. Is that right?
-      if ( right_fencer_contact_made_ &&
-            (
-             ((current_mode_ == mode::SABER) && ((unsigned long)(current_time - right_fencer_contact_start_time_) > SABER_CONTACT_MICROS_) ) ||
-             ((current_mode_ == mode::FOIL)  && ((unsigned long)(current_time - right_fencer_contact_start_time_) > FOIL_CONTACT_MICROS_ ) ) ||
-             ((current_mode_ == mode::EPEE)  && ((unsigned long)(current_time - right_fencer_contact_start_time_) > EPEE_CONTACT_MICROS_ ) )
-            )
-         )
-      {
-        // if you're foil, you gotta check if you're off target (NB: the method accounts for mode)
-        if (is_reading_off_target(right_fencer_b_weapon_line_reading_high_, left_fencer_a_lame_line_reading_high_, right_fencer_a_lame_line_reading_high_))
-        {
-          right_fencer_hit_off_target_         = true;
-          right_fencer_time_of_registered_hit_ = current_time;
-        }
-        // every other weapon can only get here by being on-target, as off-targets don't exist TODO TODO still check on target as an error checking measure???
-        else
-        {
-          right_fencer_hit_on_target_          = true;
-          right_fencer_time_of_registered_hit_ = current_time;
-        }
-      } // end if just got a valid hit 
-    } // end if not locked out or if already has a hit registered 
-  } // end if the right fencer weapon is the one that's powered 
-
-
-  // now, check for lockouts!
+  bool bout_timer_running = clock_->is_timer_running(Fencing_Clock::BOUT_TIMER);
 
-  // if we're already locked out, no need to check for lockout again TODO TODO don't think I need check for which circuit is powered here?
-  if (!locked_out_)
+  if (bout_timer_was_running_ && !bout_timer_running && 
+      clock_->get_timer_remaining_micros(Fencing_Clock::BOUT_TIMER) == 0)
   {
-    // if the left fencer has a valid hit and has had enough time pass since they confirmed it (according to their weapon), lock out
-    if ( ( left_fencer_hit_on_target_ || left_fencer_hit_off_target_ ) &&
-        (
-          ((current_mode_ == mode::SABER) && ((unsigned long)(current_time - left_fencer_time_of_registered_hit_) > SABER_LOCKOUT_MICROS_) ) ||
-          ((current_mode_ == mode::FOIL)  && ((unsigned long)(current_time - left_fencer_time_of_registered_hit_) > FOIL_LOCKOUT_MICROS_)  ) ||
-          ((current_mode_ == mode::EPEE)  && ((unsigned long)(current_time - left_fencer_time_of_registered_hit_) > EPEE_LOCKOUT_MICROS_)  )
-        )
-       )
-    {
-      locked_out_      = true;
-      time_of_lockout_ = current_time; 
-    }
-    
-    // if the right fencer has a valid hit and has had enough time pass since they confirmed it (according to their weapon), lock out
-    if ( ( right_fencer_hit_on_target_ || right_fencer_hit_off_target_ ) &&
-        (
-          ((current_mode_ == mode::SABER) && ((unsigned long)(current_time - right_fencer_time_of_registered_hit_) > SABER_LOCKOUT_MICROS_) ) ||
-          ((current_mode_ == mode::FOIL)  && ((unsigned long)(current_time - right_fencer_time_of_registered_hit_) > FOIL_LOCKOUT_MICROS_)  ) ||
-          ((current_mode_ == mode::EPEE)  && ((unsigned long)(current_time - right_fencer_time_of_registered_hit_) > EPEE_LOCKOUT_MICROS_)  )
-        )
-       )
-    {
-      locked_out_      = true;
-      time_of_lockout_ = current_time; 
-    }
+    time_up_alert_pending_ = true;
   }
-}
-
 
-//==============================================================================================================================
-// TODO TODO REDO COMMENTS 
-// TODO note that order of the lames doesn't matter at all 
-// is_reading_off_target - determines whether the provided analog values constitute an off-target contact
-//    parameter:  unsigned long fencer_A_weapon_prong - the analog read value of one fencer's weapon line
-//    parameter:  unsigned long fencer_B_weapon_prong - the analog read value of the other fencer's one fencer's weapon line
-//    output:   bool, true if off-target contact is made, false otherwise
-//==============================================================================================================================
-bool is_reading_off_target(bool fencer_A_weapon_high, bool fencer_B_lame_high, bool fencer_A_lame_high)
-{
-  bool result = false;
+  bout_timer_was_running_ = bout_timer_running;
 
-  if (current_mode_ == mode::FOIL) // "off-target" is meaningless outside of foil 
+  // (restarted with more time before it got to flash; it's not time up any more) 
+  if (bout_timer_running)
   {
-    // you're hitting something, but it's not a lame!
-    result = fencer_A_weapon_high && !(fencer_A_lame_high || fencer_B_lame_high);
-  } 
-
-  return result; 
-}
-
-
-//==============================================================================================================================
-// TODO REDO REDO TODO 
-// is_reading_on_target - determines whether the provided analog values constitute an on-target contact
-//    parameter:  fencer_A_weapon_prong - the analog read value of one fencer's weapon line
-//    parameter:  fencer_B_weapon_prong - the analog read value of the other fencer's one fencer's weapon line
-//    output:   true if on-target contact is made, false otherwise
-//==============================================================================================================================
-bool is_reading_on_target(bool fencer_A_weapon_high, bool fencer_B_lame_high, bool fencer_A_lame_high)
-{
-  bool result = false;
-
-  if      (current_mode_ == mode::SABER)
-  {
-    result = fencer_B_lame_high;                              // in saber, it suffices just to check the target lame! Own weapon won't change, how we're wiring it 
+    time_up_alert_pending_ = false;
   }
-  else if (current_mode_ == mode::FOIL)
-  {
-    result = (fencer_A_weapon_high && fencer_B_lame_high);    // in foil, the A and target B lines (weapon and opponent lame) are joined on a hit, and                                                            //
-  }                                                           // the A line is also severed from the C line (weapon from own ground) allowing electricity to flow elsewhere 
-  else if (current_mode_ == mode::EPEE)
-  {
-    result = (fencer_A_weapon_high && fencer_A_lame_high);    // in epee, the A and B lines (weapon and own lame) are joined on a hit 
-  }
-
-  return result;
-}
-
-//==============================================================================================================================
-// TODO REDO REDO TODO ALL NEW 
-// is_reading_on_target - determines whether the provided analog values constitute an on-target contact
-//    parameter:  fencer_A_weapon_prong - the analog read value of one fencer's weapon line
-//    parameter:  fencer_B_weapon_prong - the analog read value of the other fencer's one fencer's weapon line
-//    output:   true if on-target contact is made, false otherwise
-//==============================================================================================================================
-bool is_reading_short_circuit(bool fencer_A_weapon_high, bool fencer_B_lame_high, bool fencer_A_lame_high)
-{
-  bool result = false;
 
-  if      (current_mode_ == mode::SABER)
+  if (time_up_alert_pending_ && !hit_detector_->is_contact_pending())
   {
-    result = fencer_A_lame_high;                              // in saber, it suffices just to check the own lame! Own weapon won't change, how we're wiring it 
+    lights_->flash_alert();
+    time_up_alert_pending_ = false;
   }
-  else if (current_mode_ == mode::FOIL)
-  {
-    result = (fencer_A_weapon_high && fencer_A_lame_high);    // in foil, the A and B lines (weapon and own lame) are joined on a self-hit, and                                                            //
-  }                                                           // the A line is also severed from the C line (weapon from own ground) allowing electricity to flow elsewhere 
-  else if (current_mode_ == mode::EPEE)
-  {
-    result = false;                                           // this is just possible in epee. Try not to hit yourself! 
-  }
-
-  return result;
 }
 
 
@@ -688,7 +616,7 @@ bool is_reading_short_circuit(bool fencer_A_weapon_high, bool fencer_B_lame_high
 void signal_hits(unsigned long current_time)
 {
   // if there's not at least one contact-less reading, refuse to signal another hit (prevents continued shrieking on no change)
-  if (left_fencer_contact_made_ == false && right_fencer_contact_made_ == false)
+  if (hit_detector_->is_left_contact_made() == false && hit_detector_->is_right_contact_made() == false)
   {
     contact_reset_after_hit_signaled_ = true;
   }
@@ -696,13 +624,13 @@ void signal_hits(unsigned long current_time)
   // TODO TODO encapsulate this in an "if (contact_reset_after_hit_signaled_)" too, to avoid the lights change???
   // if a fencer's gotten a hit, light up that light (hits can't get awarded if locked_out, so no need to check once there)
   // NB: these get called over and over and over, but Fencing_Lights does redundancy checks anyway
-  if (left_fencer_hit_on_target_)   lights_->display_left_on_target();
-  if (left_fencer_hit_off_target_)  lights_->display_left_off_target();
-  if (right_fencer_hit_on_target_)  lights_->display_right_on_target();
-  if (right_fencer_hit_off_target_) lights_->display_right_off_target();
+  if (hit_detector_->is_left_hit_on_target())   lights_->display_left_on_target();
+  if (hit_detector_->is_left_hit_off_target())  lights_->display_left_off_target();
+  if (hit_detector_->is_right_hit_on_target())  lights_->display_right_on_target();
+  if (hit_detector_->is_right_hit_off_target()) lights_->display_right_off_target();
 
   // if nothing new can happen, we're good to start signalling!
-  if (locked_out_)
+  if (hit_detector_->is_locked_out())
   {
     // only sound the buzzer if this isn't a constant-hitting situation
     if (contact_reset_after_hit_signaled_) 
@@ -712,42 +640,47 @@ void signal_hits(unsigned long current_time)
       contact_reset_after_hit_signaled_ = false;
 
       // stop the clock TODO I suspect this is costly, even when only called once? 
-      clock_->stop();
+      clock_->stop_timer(Fencing_Clock::BOUT_TIMER);
       
       // sound the buzzer 
       buzzer_->buzz();
     }
 
-    // if light delay has been achieved, reset the lights 
+    // if light delay has been achieved, reset from this hit, then the lights 
     // NB: we assume here that the light duration will be longer than the buzzer duration 
-    if ((unsigned long) (current_time - time_of_lockout_) > LIGHT_DURATION_MICROS)
+    if (hit_detector_->end_touch_if_over(current_time))
     {
       // reset the lights
       lights_->reset_lights();
 
-      // reset from this hit
-      reset_values();
+      // the whole pipeline for this touch has played out, so report on it 
+      if (DEBUG == 3)
+      {
+        Latency_Probe::print_report();
+
+        // along with what the lights cost, going dark included (so get that out now rather than at the end of the pass) 
+        lights_->commit();
+        print_light_blackout_statistics();
+      }
     }
   }
 }
 
-//===============================================
-// reset_values - prepares system for next point
+//=====================================================================================
+// reset_hit_detection - forgets everything about the lines and any touch in progress,
+//                       as if the box had just been switched on
 //    output:   none
-//===============================================
-void reset_values()
+//=====================================================================================
+void reset_hit_detection()
 {
-  locked_out_                           = false;
+  left_fencer_b_weapon_line_reading_high_  = false;
+  right_fencer_b_weapon_line_reading_high_ = false;
+  left_fencer_a_lame_line_reading_high_    = false;
+  right_fencer_a_lame_line_reading_high_   = false;
 
-  right_fencer_hit_on_target_           = false;
-  right_fencer_hit_off_target_          = false;
-  left_fencer_hit_on_target_            = false;
-  left_fencer_hit_off_target_           = false;
+  contact_reset_after_hit_signaled_        = true;
 
-  left_fencer_time_of_registered_hit_   = 0;
-  right_fencer_time_of_registered_hit_  = 0;
-
-  time_of_lockout_                      = 0;
+  hit_detector_->reset();
 }
 
 
@@ -894,8 +827,9 @@ void handle_clock_adjustment_buttons(unsigned long current_time)
 //                Mode One: Increase right fencer score by one
 //                Mode Two: Decrease right fencer score by one
 //                Button C:
-//                Mode One: Start / stop the fencing clock
-//                Mode Two: Reset the clock to CLOCK_STANDARD_START_MICROS_
+//                Mode One: Start / stop the timer shown (the bout, unless another's been switched to)
+//                Mode Two: First hold: switch to showing the next timer (bout, break, injury, warm-up), leaving them all running as they were
+//                          Second hold: switch back to the timer shown when pressed, and reset it (the bout to CLOCK_STANDARD_START_MICROS_)
 //                Button D:
 //                Mode One: Toggle the quiet mode
 //                Mode Two: Reset the score to 0-0
@@ -994,7 +928,8 @@ void handle_remote_input(unsigned long current_time)
   {
     if (remote_button_c_pressed_ == false) // meaning it was JUST pressed 
     {
-      remote_button_c_time_of_depression_ = current_time; 
+      remote_button_c_time_of_depression_  = current_time; 
+      remote_button_c_timer_at_depression_ = clock_->get_shown_timer(); 
     }
     remote_button_c_pressed_ = true;
 
@@ -1006,7 +941,23 @@ void handle_remote_input(unsigned long current_time)
       remote_button_c_last_tick_reacted_to_ = current_tick;
       // fire the button's second mode
       buzzer_ ->chirp();
-      clock_  ->set_time(CLOCK_STANDARD_START_MICROS_);  // current decided alt action: reset the clock
+      if (current_tick == 1)
+      {
+        clock_->show_next_timer();  // current decided alt action: show the next timer along
+      }
+      else if (current_tick == 2)
+      {
+        // held on past that: put back the one that was up, and reset it 
+        clock_->show_timer(remote_button_c_timer_at_depression_); 
+        if (remote_button_c_timer_at_depression_ == Fencing_Clock::BOUT_TIMER)
+        {
+          clock_->set_time(CLOCK_STANDARD_START_MICROS_);
+        }
+        else
+        {
+          clock_->reset_timer(remote_button_c_timer_at_depression_); 
+        }
+      }
     } 
   }
   else
@@ -1069,6 +1020,339 @@ void handle_remote_input(unsigned long current_time)
 }
 
 
+//=========================================================================================
+// run_component_benchmarks - counts the per-call cost, in CPU cycles, of the main loop's
+//                            heavy hitters and prints the results, then puts everything
+//                            back the way it was (debugging only; needs Cycle_Counter going)
+//    output:   none
+//=========================================================================================
+void run_component_benchmarks()
+{
+  Timing_Statistics stats;
+  unsigned long     start;
+  unsigned long     overhead = Cycle_Counter::get_overhead();
+
+  Serial.print("Benchmarking, ");
+  Serial.print(BENCHMARK_ITERATIONS_);
+  Serial.print(" calls each, in CPU cycles (");
+  Serial.print(Cycle_Counter::CYCLES_PER_MICRO_);
+  Serial.println(" per microsecond):");
+
+  // one digits transaction (an address and four digits) sent in one go, by way of digitalWrite() and then with the 
+  // pins fixed at compile time; goes to the clock display, so it gets everything resent afterwards 
+  Seven_Segment_Transfer::transaction                                digits = { {0xC0, 0x00, 0x00, 0x00, 0x00}, 5, 0, true };
+  Seven_Segment_Transfer                                             runtime_transfer(TIME_DISPLAY_CLK_PIN_, TIME_DISPLAY_DATA_PIN_);
+  Fixed_Pin_Transfer<TIME_DISPLAY_CLK_PIN_, TIME_DISPLAY_DATA_PIN_>  fixed_transfer; 
+
+  stats.reset();
+  for (unsigned long i = 0; i < BENCHMARK_ITERATIONS_; i++)
+  {
+    runtime_transfer.begin(digits);
+    start = Cycle_Counter::now();
+    runtime_transfer.step(255);
+    stats.add_sample((Cycle_Counter::now() - start - overhead) / digits.length);
+  }
+  stats.print("  Seven_Segment_Transfer, per byte  ", "cyc");
+
+  stats.reset();
+  for (unsigned long i = 0; i < BENCHMARK_ITERATIONS_; i++)
+  {
+    fixed_transfer.begin(digits);
+    start = Cycle_Counter::now();
+    fixed_transfer.step(255);
+    stats.add_sample((Cycle_Counter::now() - start - overhead) / digits.length);
+  }
+  stats.print("  Fixed_Pin_Transfer, per byte      ", "cyc");
+
+  clock_->clock_->refresh(); 
+
+  // Seven_Segment_Display::tick, with a fresh four-digit message to push out every so often 
+  stats.reset();
+  for (unsigned long i = 0; i < BENCHMARK_ITERATIONS_; i++)
+  {
+    if (i % 40 == 0) clock_->clock_->set_display_contents((i / 40) % 2 == 0 ? "1234" : "5678");
+
+    unsigned long now = micros(); 
+    start = Cycle_Counter::now();
+    clock_->clock_->tick(now);
+    display_bus_->tick(now);
+    stats.add_sample(Cycle_Counter::now() - start - overhead);
+  }
+  stats.print("  Seven_Segment_Display::tick       ", "cyc");
+
+  // Fencing_Clock::tick, with the clock running so the seconds actually roll over 
+  stats.reset();
+  clock_->start();
+  for (unsigned long i = 0; i < BENCHMARK_ITERATIONS_; i++)
+  {
+    unsigned long now = micros(); 
+    start = Cycle_Counter::now();
+    clock_->tick(now);
+    stats.add_sample(Cycle_Counter::now() - start - overhead);
+  }
+  stats.print("  Fencing_Clock::tick               ", "cyc");
+
+  // Fencing_Point_Displays::handle_score_change, by way of set_scores() with a new score every call 
+  stats.reset();
+  for (unsigned long i = 0; i < BENCHMARK_ITERATIONS_; i++)
+  {
+    start = Cycle_Counter::now();
+    scoreboard_->set_scores(i % 100, (i + 1) % 100);
+    stats.add_sample(Cycle_Counter::now() - start - overhead);
+  }
+  stats.print("  Fencing_Point_Displays::set_scores", "cyc");
+
+  // the hit detection, one phase per call, with both fencers in contact so the timing checks all run 
+  stats.reset();
+  for (unsigned long i = 0; i < BENCHMARK_ITERATIONS_; i++)
+  {
+    unsigned long now = micros(); 
+    start = Cycle_Counter::now();
+    if (i % 2 == 0) hit_detector_->process_left_phase (now, true, true, true);
+    else            hit_detector_->process_right_phase(now, true, true, true);
+    stats.add_sample(Cycle_Counter::now() - start - overhead);
+  }
+  stats.print("  Hit_Detector, one phase           ", "cyc");
+
+  // a ring light change, on and off again, not counting the show() that'd send it 
+  stats.reset();
+  for (unsigned long i = 0; i < BENCHMARK_ITERATIONS_; i++)
+  {
+    start = Cycle_Counter::now();
+    if (i % 2 == 0) lights_->display_left_on_target();
+    else            lights_->reset_lights();
+    stats.add_sample(Cycle_Counter::now() - start - overhead);
+  }
+  stats.print("  Fencing_Light_Displays, a change  ", "cyc");
+
+  // put everything back the way we found it 
+  lights_    ->reset_lights();
+  lights_    ->commit();
+  reset_hit_detection();
+  clock_     ->set_time(CLOCK_STANDARD_START_MICROS_);
+  scoreboard_->set_scores(0, 0);
+}
+
+
+//=========================================================================================
+// tick_components_counting_cycles - does the main loop's component ticks, counting every
+//                                   one (and the whole loop pass) in CPU cycles, and
+//                                   prints the tallies every CYCLES_PER_TIMING_EVENT_
+//                                   passes (debugging only; needs Cycle_Counter going)
+//    parameter:  current_time - the time in microseconds passed since the last processing
+//    output:   none
+//=========================================================================================
+void tick_components_counting_cycles(unsigned long current_time)
+{
+  // statics, so they only take up memory in builds that actually use this 
+  static Timing_Statistics loop_cycles, scoreboard_cycles, clock_cycles, display_bus_cycles, buzzer_cycles, lights_cycles;
+  static unsigned long     last_loop_start = 0;
+
+  unsigned long overhead = Cycle_Counter::get_overhead();
+  unsigned long start    = Cycle_Counter::now();
+
+  // the whole previous pass, from this call to this call 
+  if (last_loop_start != 0) loop_cycles.add_sample(start - last_loop_start);
+  last_loop_start = start;
+
+  start = Cycle_Counter::now();
+  scoreboard_->tick(current_time);
+  scoreboard_cycles.add_sample(Cycle_Counter::now() - start - overhead);
+
+  start = Cycle_Counter::now();
+  clock_->tick(current_time);
+  clock_cycles.add_sample(Cycle_Counter::now() - start - overhead);
+
+  start = Cycle_Counter::now();
+  tick_display_bus(current_time);
+  display_bus_cycles.add_sample(Cycle_Counter::now() - start - overhead);
+
+  start = Cycle_Counter::now();
+  buzzer_->tick(current_time);
+  buzzer_cycles.add_sample(Cycle_Counter::now() - start - overhead);
+
+  start = Cycle_Counter::now();
+  lights_->tick(current_time);
+  lights_cycles.add_sample(Cycle_Counter::now() - start - overhead);
+
+  // report and start over every so often 
+  if (scoreboard_cycles.get_count() >= CYCLES_PER_TIMING_EVENT_)
+  {
+    loop_cycles      .print("loop() pass              ", "cyc");
+    scoreboard_cycles.print("  scoreboard_->tick      ", "cyc");
+    clock_cycles     .print("  clock_->tick           ", "cyc");
+    display_bus_cycles.print("  display bus            ", "cyc");
+    buzzer_cycles    .print("  buzzer_->tick          ", "cyc");
+    lights_cycles    .print("  lights_->tick          ", "cyc");
+
+    loop_cycles      .reset();
+    scoreboard_cycles.reset();
+    clock_cycles     .reset();
+    display_bus_cycles.reset();
+    buzzer_cycles    .reset();
+    lights_cycles    .reset();
+
+    // the printing itself shouldn't count against the next pass 
+    last_loop_start = 0;
+  }
+}
+
+
+//=========================================================================================
+// tick_display_bus - does this loop's sending to the seven-segment displays, the clock's
+//                    first while a bout's running so the seconds never lag
+//    parameter:  current_time - the time in microseconds passed since the last processing
+//    output:   none
+//=========================================================================================
+void tick_display_bus(unsigned long current_time)
+{
+  display_bus_->set_first_in_line(clock_->is_running() ? clock_->clock_ : NULL);
+  display_bus_->tick(current_time);
+}
+
+
+//=========================================================================================
+// print_display_bus_statistics - prints and then zeroes the TM1637 bus traffic accounting
+//                                for each seven-segment display (debugging only)
+//    output:   none
+//=========================================================================================
+void print_display_bus_statistics()
+{
+  Seven_Segment_Display* displays[] = { clock_->clock_, scoreboard_->left_fencer_score_display_, scoreboard_->right_fencer_score_display_ };
+  const char*            names[]    = { "clock", "left score", "right score" };
+
+  for (uint8_t i = 0; i < sizeof(displays) / sizeof(displays[0]); i++)
+  {
+    Seven_Segment_Display::bus_statistics stats = displays[i]->get_bus_statistics();
+
+    Serial.print(names[i]);
+    Serial.print(" display\tbytes: ");
+    Serial.print(stats.bytes_sent);
+    Serial.print("\tstart/stops: ");
+    Serial.print(stats.start_stop_pairs);
+    Serial.print("\tACK waits: ");
+    Serial.print(stats.ack_waits);
+    Serial.print("\tACK failures: ");
+    Serial.print(stats.ack_failures);
+    Serial.print(displays[i]->is_degraded() ? " (DEGRADED)" : "");
+    Serial.print("\tupdates: ");
+    Serial.print(stats.updates_latched);
+    Serial.print("\tbytes/update: ");
+    Serial.print(stats.updates_latched == 0 ? 0.0 : (float)stats.bytes_sent / stats.updates_latched);
+    Serial.print("\tlast time-to-visible: ");
+    Serial.print(stats.last_time_to_visible_micros);
+    Serial.print("us\tworst: ");
+    Serial.print(stats.worst_time_to_visible_micros);
+    Serial.println("us");
+
+    displays[i]->reset_bus_statistics();
+  }
+
+  Serial.print("shared sends: ");
+  Serial.print(display_bus_->get_broadcast_count());
+  Serial.print("\tbytes saved: ");
+  Serial.println(display_bus_->get_bytes_saved());
+
+  display_bus_->reset_statistics();
+
+  if (Seven_Segment_Background::is_running())
+  {
+    Seven_Segment_Background::statistics background = Seven_Segment_Background::get_statistics();
+
+    Serial.print("background units: ");
+    Serial.print(background.units_sent);
+    Serial.print("\tframes: ");
+    Serial.print(background.frames_sent);
+    Serial.print("\tACK failures: ");
+    Serial.println(background.ack_failures);
+
+    Seven_Segment_Background::reset_statistics();
+  }
+}
+
+
+//=========================================================================================
+// print_light_blackout_statistics - prints and then zeroes how many ring light show()s
+//                                   there have been and how long they kept interrupts
+//                                   off for (debugging only)
+//    output:   none
+//=========================================================================================
+void print_light_blackout_statistics()
+{
+  Fencing_Light_Displays::blackout_statistics stats = lights_->get_blackout_statistics();
+
+  Serial.print("ring lights\tshow()s: ");
+  Serial.print(stats.shows);
+  Serial.print("\tinterrupts off: ");
+  Serial.print(stats.blackout_micros);
+  Serial.println(RING_LIGHTS_CHAINED_ ? "us (chained)" : "us");
+
+  lights_->reset_blackout_statistics();
+}
+
+
+//=========================================================================================
+// print_clock_lag_statistics - prints and then zeroes how far after the true tenth / second
+//                              the clock's digits showed up (debugging only); an 'L' over
+//                              Serial flips whether they're sent early, for an A/B of the
+//                              lag on a real box (see host/clock_lag_report for one on
+//                              the simulated Uno)
+//    output:   none
+//=========================================================================================
+void print_clock_lag_statistics()
+{
+  Fencing_Clock::display_lag_statistics stats = clock_->get_display_lag_statistics();
+
+  Serial.print("clock lag (");
+  Serial.print(clock_->is_display_lead_enabled() ? "sent early" : "sent on time");
+  Serial.print(")\tchanges: ");
+  Serial.print(stats.samples);
+  Serial.print("\tmean: ");
+  Serial.print(stats.samples == 0 ? 0 : stats.total_lag_micros / (long)stats.samples);
+  Serial.print("us\tearliest: ");
+  Serial.print(stats.earliest_lag_micros);
+  Serial.print("us\tlatest: ");
+  Serial.print(stats.latest_lag_micros);
+  Serial.print("us\tjitter: ");
+  Serial.print(stats.latest_lag_micros - stats.earliest_lag_micros);
+  Serial.print("us\tlead: ");
+  Serial.print(stats.lead_micros);
+  Serial.println("us");
+
+  clock_->reset_display_lag_statistics();
+
+  // flip whether they're sent early, if asked to; the next report's then the other half of the A/B 
+  while (Serial.available() > 0)
+  {
+    if (Serial.read() == 'L')
+    {
+      clock_->set_display_lead_enabled(!clock_->is_display_lead_enabled());
+    }
+  }
+}
+
+
+//=========================================================================================
+// print_heap_growth - prints how far the heap has grown since the end of setup(), which
+//                     should be never; an all-day box can't afford to fragment 2K of SRAM
+//                     (debugging only)
+//    output:   none
+//=========================================================================================
+void print_heap_growth()
+{
+  if (__brkval == heap_top_after_setup_)
+  {
+    Serial.println("heap: no growth since setup");
+  }
+  else
+  {
+    Serial.print("HEAP GREW SINCE SETUP: ");
+    Serial.print((unsigned long)(__brkval - heap_top_after_setup_));
+    Serial.println(" bytes");
+  }
+}
+
+
 //======================================================================================
 // handle_mode_switch_button - implements mode change button, with wrap-around feature!
 //    output:   none
@@ -1129,13 +1413,16 @@ void handle_mode_switch_button()
         break;
       case mode::EPEE:
         current_mode_ = mode::SABER;
-        clock_      ->clock_                     ->set_display_contents("SA", false, true, DISPLAY_MODE_CHANGE_TEXT_LENGTH_ );
-        scoreboard_ -> left_fencer_score_display_->set_display_contents("SA", false, true, DISPLAY_MODE_CHANGE_TEXT_LENGTH_ );
-        scoreboard_ ->right_fencer_score_display_->set_display_contents("SA", false, true, DISPLAY_MODE_CHANGE_TEXT_LENGTH_ );
+        clock_      ->clock_                     ->set_display_contents("SAbr", false, true, DISPLAY_MODE_CHANGE_TEXT_LENGTH_ );
+        scoreboard_ -> left_fencer_score_display_->set_display_contents("SAbr", false, true, DISPLAY_MODE_CHANGE_TEXT_LENGTH_ );
+        scoreboard_ ->right_fencer_score_display_->set_display_contents("SAbr", false, true, DISPLAY_MODE_CHANGE_TEXT_LENGTH_ );
         break;
       default:
         current_mode_ = mode::SABER;
     }
+
+    // and judge the lines by the new weapon's rules from now on 
+    hit_detector_->set_mode(current_mode_);
   }
 }
 
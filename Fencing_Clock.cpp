@@ -11,6 +11,25 @@
 // interface include
 #include "Fencing_Clock.h"
 
+// how long each timer is when it's reset, in timer_id order: a bout period, the one-minute break, the five-minute 
+// injury timer and a warm-up 
+static const unsigned long TIMER_STANDARD_MICROS_[Fencing_Clock::TIMER_COUNT_] = 
+{
+  3 * Fencing_Clock::SECS_IN_MIN_ * Fencing_Clock::MICROS_IN_SEC_, 
+  1 * Fencing_Clock::SECS_IN_MIN_ * Fencing_Clock::MICROS_IN_SEC_, 
+  5 * Fencing_Clock::SECS_IN_MIN_ * Fencing_Clock::MICROS_IN_SEC_, 
+  3 * Fencing_Clock::SECS_IN_MIN_ * Fencing_Clock::MICROS_IN_SEC_ 
+};
+
+// what's flashed up when each timer's switched to, in timer_id order 
+static const char TIMER_NAMES_[Fencing_Clock::TIMER_COUNT_][Seven_Segment_Display::DISPLAY_SIZE_ + 1] = 
+{
+  "bout", 
+  "brk ", 
+  "inj ", 
+  "UP  " 
+};
+
 // Constructor 
 //    uint8_t clock_pin - the Arduino pin attached to the CLK pin of the clock display 
 //    uint8_t data_pin  - the Arduino pin attached to the DATA pin of the clock display
@@ -18,6 +37,14 @@ Fencing_Clock::Fencing_Clock(uint8_t clock_pin, uint8_t data_pin)
 {
   // make the underlying SSD object 
   this->clock_ = new Seven_Segment_Display(clock_pin, data_pin);
+
+  // every timer starts paused, at its standard length 
+  for (uint8_t i = 0; i < TIMER_COUNT_; i++)
+  {
+    this->timers_[i].running        = false; 
+    this->timers_[i].set_micros     = TIMER_STANDARD_MICROS_[i]; 
+    this->timers_[i].started_micros = 0; 
+  }
   
   // make sure everything's displayed properly
   this->tick(0);
@@ -44,168 +71,541 @@ void Fencing_Clock::tick(unsigned long current_time_micros)
     this->most_recently_seen_external_time_ = current_time_micros; 
   } 
 
-  // either way, we're gonna need the remaining time 
+  // see whether the last change to the time has made it onto the display 
+  if (this->lag_watch_ == LAG_WATCH_SENDING && !this->clock_->is_update_pending())
+  {
+    this->note_display_lag(); 
+  }
+
+  // if a timer's due to run out, stop whichever have (only the soonest is ever looked at, however many are running) 
+  if (this->expiry_pending_ && 
+      (unsigned long)(this->most_recently_seen_external_time_ - this->expiry_reference_micros_) >= this->micros_to_next_expiry_)
+  {
+    for (uint8_t i = 0; i < TIMER_COUNT_; i++)
+    {
+      if (this->timers_[i].running && this->get_timer_remaining_micros(i) == 0)
+      {
+        this->stop_timer(i); 
+      }
+    }
+  }
+
+  // either way, we're gonna need the remaining time on the timer shown 
   unsigned long remaining_micros = this->get_remaining_micros(); 
 
-  // if we're running but out of time, we should stop running
-  if (remaining_micros == 0 && this->is_running_)
+  // while it's running, count down that much before each tenth, so the change is up on the display by the time it's due 
+  unsigned long lead_micros      = (this->display_lead_enabled_ && this->is_running()) ? this->display_lead_micros_ : 0; 
+  bool          boundary_crossed = false; 
+  unsigned long boundary_micros  = 0; 
+
+  // the time's been set; line the counter up from scratch (the only time we divide) 
+  if (this->time_digits_need_sync_)
   {
-      this->stop(); // handles the time setting itself 
+    this->sync_digits_to_micros(remaining_micros); 
   }
 
-  // use int math abuse to see how many whole seconds are left on the clock 
-  unsigned long remaining_whole_seconds = remaining_micros / this->MICROS_IN_SEC_; 
+  // otherwise count down a tenth at a time as the time left drops past each one 
+  else if (this->time_digits_floor_micros_ != 0 && remaining_micros < this->time_digits_floor_micros_ + lead_micros)
+  {
+    if (remaining_micros < this->time_digits_floor_micros_ && 
+        this->time_digits_floor_micros_ - remaining_micros > this->MAX_CATCH_UP_MICROS_)
+    {
+      this->sync_digits_to_micros(remaining_micros); 
+    }
+    else
+    {
+      bool was_showing_tenths = this->showing_tenths(); 
+
+      while (this->time_digits_floor_micros_ != 0 && remaining_micros < this->time_digits_floor_micros_ + lead_micros)
+      {
+        // when the time left reaches the bottom of this tenth is when the change should land (maybe already gone) 
+        boundary_micros                  = this->most_recently_seen_external_time_ + remaining_micros - this->time_digits_floor_micros_; 
+        this->time_digits_floor_micros_ -= this->MICROS_IN_TENTH_; 
+
+        // whole seconds only need redoing when more than the tenths changed 
+        if (this->count_down_one_tenth() || was_showing_tenths)
+        {
+          this->time_string_needs_sending_ = true; 
+          boundary_crossed                 = true; 
+        }
+      }
+
+      // (and the first tenth under ten seconds) 
+      if (this->showing_tenths() != was_showing_tenths)
+      {
+        this->time_string_needs_sending_ = true; 
+        boundary_crossed                 = true; 
+      }
+    }
+  }
 
   // redundancy check - don't bother figuring out what to display for the time 
-  //  if the number of whole seconds hasn't changed 
-  if (this->last_sent_number_of_whole_seconds_ != remaining_whole_seconds)
+  //  if what's shown hasn't changed 
+  if (this->time_string_needs_sending_)
   {  
     // do the actual displaying 
-    this->clock_->set_display_contents(this->get_time_string_from_micros(remaining_micros), true); 
+    char time_string[Seven_Segment_Display::DISPLAY_SIZE_]; 
+    this->get_time_string_from_digits(time_string); 
+    this->clock_->set_display_characters(time_string, Seven_Segment_Display::DISPLAY_SIZE_, true); 
+
+    this->time_string_needs_sending_ = false; 
 
-    // update our understanding of the last time sent 
-    this->last_sent_number_of_whole_seconds_ = remaining_whole_seconds; 
+    // a change from the time ticking down (rather than being set) is one to watch on its way out 
+    if (boundary_crossed)
+    {
+      this->lag_watch_           = LAG_WATCH_STAGED; 
+      this->lag_boundary_micros_ = boundary_micros; 
+      this->lag_staged_micros_   = this->most_recently_seen_external_time_; 
+    }
   }
   
   // tell the underlying SSDs how much time has passed so it will update
   // it's also important for overriding messages and stuff 
   this->clock_->tick(current_time_micros);
+
+  // the change is only on its way if it actually changed what's up (a timer's name could be covering it, say) 
+  if (this->lag_watch_ == LAG_WATCH_STAGED)
+  {
+    this->lag_watch_ = this->clock_->is_update_pending() ? LAG_WATCH_SENDING : LAG_WATCH_IDLE; 
+  }
 }
 
 
-// Set the clock to be running
+// Set the clock (the timer shown) to be running
 void Fencing_Clock::start()
 {
-  if (!this->is_running_)   // we only need to worry if we're not already running 
+  this->start_timer(this->shown_timer_); 
+}
+
+
+// Set the clock (the timer shown) to be paused 
+void Fencing_Clock::stop()
+{
+  this->stop_timer(this->shown_timer_); 
+}
+
+
+// Start the clock (the timer shown) if stopped, stop it if started 
+void Fencing_Clock::toggle()
+{
+  this->toggle_timer(this->shown_timer_); 
+}
+
+
+// Whether the clock (the timer shown) is currently running 
+bool Fencing_Clock::is_running()
+{
+  return this->is_timer_running(this->shown_timer_); 
+}
+
+
+// Return the remaining time left on the clock (the timer shown), in microseconds
+unsigned long Fencing_Clock::get_remaining_micros()
+{
+  return this->get_timer_remaining_micros(this->shown_timer_); 
+}
+
+
+// set the remaining time on the clock (the timer shown)
+//    unsigned long new_micros - what the clock should be set to, in microseconds  
+void Fencing_Clock::set_time(unsigned long new_micros)
+{
+  this->set_timer_time(this->shown_timer_, new_micros); 
+}
+
+
+// Set a timer to be running; a break, injury or warm-up timer that's run out starts again from the top 
+//    uint8_t timer - which one (see timer_id) 
+void Fencing_Clock::start_timer(uint8_t timer)
+{
+  if (timer >= TIMER_COUNT_ || this->timers_[timer].running)   // we only need to worry if we're not already running 
   {
-      this->is_running_                 = true; 
-      this->time_of_most_recent_start_  = this->most_recently_seen_external_time_; 
+    return; 
   }
+
+  // the bout stays at zero until someone sets it; the others are just run again 
+  if (timer != BOUT_TIMER && this->timers_[timer].set_micros == 0)
+  {
+    this->reset_timer(timer); 
+  }
+
+  this->timers_[timer].running        = true; 
+  this->timers_[timer].started_micros = this->most_recently_seen_external_time_; 
+
+  this->update_next_expiry(); 
 }
 
 
-// Set the clock to be paused 
-void Fencing_Clock::stop()
+// Set a timer to be paused 
+//    uint8_t timer - which one (see timer_id) 
+void Fencing_Clock::stop_timer(uint8_t timer)
 {
-  if (this->is_running_) // we only need to worry if we're already running 
+  if (timer >= TIMER_COUNT_ || !this->timers_[timer].running)  // we only need to worry if we're already running 
   {
-    // do the last calculation before stopping the time 
-    unsigned long new_time = this->get_remaining_micros();
+    return; 
+  }
 
-    // stop the counting of time 
-    this->is_running_ = false;
-    
-    // set the internal micros count using our own method 
-    this->set_time(new_time);
+  // do the last calculation before stopping the time 
+  this->timers_[timer].set_micros     = this->get_timer_remaining_micros(timer); 
+  this->timers_[timer].running        = false; 
 
-    // zero the start tracker (NOT the most recent time seen!) 
-    this->time_of_most_recent_start_ = 0;  
+  // zero the start tracker (NOT the most recent time seen!) 
+  this->timers_[timer].started_micros = 0; 
+
+  // the digits may have been counted down early, ahead of the change landing; stopped inside that lead, the time left 
+  // is what's showing (at most a lead's worth off), rather than the display going back up a tenth or a second 
+  if (timer == this->shown_timer_)
+  {
+    unsigned long shown_ceiling_micros = this->time_digits_floor_micros_ + this->MICROS_IN_TENTH_; 
+
+    if (!this->time_digits_need_sync_ && 
+        this->timers_[timer].set_micros >= shown_ceiling_micros && 
+        this->timers_[timer].set_micros <  shown_ceiling_micros + this->display_lead_micros_)
+    {
+      this->timers_[timer].set_micros = shown_ceiling_micros - 1; 
+    }
+
+    this->time_digits_need_sync_      = true; 
   }
+
+  this->update_next_expiry(); 
 }
 
 
-// Start the clock if stopped, stop the clock if started 
-void Fencing_Clock::toggle()
+// Start a timer if stopped, stop it if started 
+//    uint8_t timer - which one (see timer_id) 
+void Fencing_Clock::toggle_timer(uint8_t timer)
 {
-  if (this->is_running_)
+  if (this->is_timer_running(timer))
   {
-    this->stop();     
+    this->stop_timer(timer);     
   }
   else
   {
-    this->start();  
+    this->start_timer(timer);  
   }
 }
 
 
-// Return the remaining time left on the clock, in microseconds
-unsigned long Fencing_Clock::get_remaining_micros()
+// Whether a timer is currently running 
+//    uint8_t timer - which one (see timer_id) 
+bool Fencing_Clock::is_timer_running(uint8_t timer)
 {
-  unsigned long remaining_micros = 0; 
+  return timer < TIMER_COUNT_ && this->timers_[timer].running; 
+}
+
 
-  if (this->is_running_)
+// Return the remaining time left on a timer, in microseconds
+//    uint8_t timer - which one (see timer_id) 
+unsigned long Fencing_Clock::get_timer_remaining_micros(uint8_t timer)
+{
+  if (timer >= TIMER_COUNT_)
   {
-    // calculate the time passed since the most recent start command 
-    unsigned long elapsed_time = (unsigned long)(this->most_recently_seen_external_time_ - this->time_of_most_recent_start_); 
-    
-    if (elapsed_time >= this->current_clock_time_micros_) // dodge overflow issues if we're out of time 
-    {
-      remaining_micros = 0;   
-    }
-    else // otherwise calculate the remaining time 
-    {
-      remaining_micros = this->current_clock_time_micros_- elapsed_time;
-    }
+    return 0; 
+  }
+
+  const countdown& countdown = this->timers_[timer]; 
+
+  if (!countdown.running)
+  {
+    return countdown.set_micros; 
   }
-  else // i.e., we're not running 
+
+  // calculate the time passed since the most recent start command 
+  unsigned long elapsed_time = (unsigned long)(this->most_recently_seen_external_time_ - countdown.started_micros); 
+
+  if (elapsed_time >= countdown.set_micros) // dodge overflow issues if we're out of time 
   {
-    remaining_micros = this->current_clock_time_micros_; 
+    return 0; 
   }
-  
-  return remaining_micros; 
+
+  return countdown.set_micros - elapsed_time; 
 }
 
 
-// set the remaining time on the clock
-//    unsigned long new_micros - what the clock should be set to, in microseconds  
-void Fencing_Clock::set_time(unsigned long new_micros)
+// set the remaining time on a timer 
+//    uint8_t       timer      - which one (see timer_id) 
+//    unsigned long new_micros - what the timer should be set to, in microseconds  
+void Fencing_Clock::set_timer_time(uint8_t timer, unsigned long new_micros)
 {
-  // don't adjust on the fly! 
-  if(this->is_running_)
+  if (timer >= TIMER_COUNT_)
   {
-    this->stop();  
+    return; 
   }
+
+  // don't adjust on the fly! 
+  this->stop_timer(timer); 
   
   // check your inputs so you don't overflow the timer  
   if (new_micros > this->MAX_MICROS_) new_micros = this->MAX_MICROS_;
 
   // set the tracking data member 
-  this->current_clock_time_micros_ = new_micros; 
+  this->timers_[timer].set_micros = new_micros; 
+
+  // only the timer shown has digits to line up again 
+  if (timer == this->shown_timer_)
+  {
+    this->time_digits_need_sync_ = true; 
+
+    // call tick with no time just to update the display 
+    this->tick(0); 
+  }
+}
+
+
+// put a timer back to its standard length (three minutes for the bout, one for the break, and so on) 
+//    uint8_t timer - which one (see timer_id) 
+void Fencing_Clock::reset_timer(uint8_t timer)
+{
+  if (timer < TIMER_COUNT_)
+  {
+    this->set_timer_time(timer, TIMER_STANDARD_MICROS_[timer]); 
+  }
+}
+
+
+// show a different timer on the display (flashing its name up first); none of them stop or start 
+//    uint8_t timer - which one (see timer_id) 
+void Fencing_Clock::show_timer(uint8_t timer)
+{
+  if (timer >= TIMER_COUNT_)
+  {
+    return; 
+  }
+
+  this->shown_timer_           = timer; 
+  this->time_digits_need_sync_ = true; 
+
+  // the name goes up over the digits for a moment; the digits carry on underneath 
+  this->clock_->set_display_characters(TIMER_NAMES_[timer], Seven_Segment_Display::DISPLAY_SIZE_, false, true, this->TIMER_NAME_MICROS_); 
+
+  // call tick with no time just to update the display 
+  this->tick(0); 
+}
+
+
+// show the next timer along, wrapping round 
+void Fencing_Clock::show_next_timer()
+{
+  this->show_timer((this->shown_timer_ + 1) % TIMER_COUNT_); 
+}
+
+
+// which timer's shown 
+uint8_t Fencing_Clock::get_shown_timer()
+{
+  return this->shown_timer_; 
+}
+
+// choose whether the last ten seconds show tenths (s:t) or stay whole seconds (m:ss) like the rest 
+//    bool enabled - true for tenths 
+void Fencing_Clock::set_tenths_enabled(bool enabled)
+{
+  this->tenths_enabled_            = enabled; 
+  this->time_string_needs_sending_ = true; 
 
   // call tick with no time just to update the display 
   this->tick(0); 
 }
 
 
+// whether the last ten seconds show tenths 
+bool Fencing_Clock::is_tenths_enabled()
+{
+  return this->tenths_enabled_; 
+}
+
+
+// choose whether changes to the digits are sent early enough to land on the true tenth / second (by however long 
+// the display's been taking to show one), or only once it's passed 
+//    bool enabled - true for early 
+void Fencing_Clock::set_display_lead_enabled(bool enabled)
+{
+  this->display_lead_enabled_ = enabled; 
+}
+
+
+// whether changes to the digits are sent early 
+bool Fencing_Clock::is_display_lead_enabled()
+{
+  return this->display_lead_enabled_; 
+}
+
+
+// Returns a copy of the display lag accounting 
+Fencing_Clock::display_lag_statistics Fencing_Clock::get_display_lag_statistics()
+{
+  display_lag_statistics copy = this->lag_statistics_; 
+  copy.lead_micros            = this->display_lead_enabled_ ? this->display_lead_micros_ : 0; 
+  return copy; 
+}
+
+
+// Zeroes the display lag accounting 
+void Fencing_Clock::reset_display_lag_statistics()
+{
+  this->lag_statistics_.samples             = 0; 
+  this->lag_statistics_.total_lag_micros    = 0; 
+  this->lag_statistics_.earliest_lag_micros = 0; 
+  this->lag_statistics_.latest_lag_micros   = 0; 
+}
+
+
 //
 //  private methods
 //
 
-// helper method; make conversion from unformatted microseconds to human-readable time string easy  
-String Fencing_Clock::get_time_string_from_micros(unsigned long microsecs)
+// helper method; records how late the watched change landed, and folds how long it took into the lead 
+void Fencing_Clock::note_display_lag()
 {
-  // start off with a blank string the size of our display
-  String return_string = "    "; // TODO kind of a magic number; should really use Seven_Segment_Display::DISPLAY_SIZE_ I guess
-                                 //      this is just the fastest way I've found so far 
+  long lag_micros = (long)(this->most_recently_seen_external_time_ - this->lag_boundary_micros_); 
 
+  if (this->lag_statistics_.samples == 0 || lag_micros < this->lag_statistics_.earliest_lag_micros)
+  {
+    this->lag_statistics_.earliest_lag_micros = lag_micros; 
+  }
+  if (this->lag_statistics_.samples == 0 || lag_micros > this->lag_statistics_.latest_lag_micros)
+  {
+    this->lag_statistics_.latest_lag_micros   = lag_micros; 
+  }
+  this->lag_statistics_.total_lag_micros     += lag_micros; 
+  this->lag_statistics_.samples++; 
+
+  // the lead is a running average of how long changes take to get from here to the display, whether or not it's 
+  // being used, so it's ready the moment it's turned on 
+  unsigned long time_to_visible = (unsigned long)(this->most_recently_seen_external_time_ - this->lag_staged_micros_); 
+  if (time_to_visible > this->MAX_DISPLAY_LEAD_MICROS_) time_to_visible = this->MAX_DISPLAY_LEAD_MICROS_; 
+
+  this->display_lead_micros_ = (long)this->display_lead_micros_ + 
+                               ((long)time_to_visible - (long)this->display_lead_micros_) / this->DISPLAY_LEAD_AVERAGING_; 
+
+  this->lag_watch_ = LAG_WATCH_IDLE; 
+}
+
+// helper method; works out the soonest time any running timer runs out 
+void Fencing_Clock::update_next_expiry()
+{
+  this->expiry_pending_ = false; 
+
+  for (uint8_t i = 0; i < TIMER_COUNT_; i++)
+  {
+    if (!this->timers_[i].running)
+    {
+      continue; 
+    }
+
+    unsigned long remaining_micros = this->get_timer_remaining_micros(i); 
+    if (!this->expiry_pending_ || remaining_micros < this->micros_to_next_expiry_)
+    {
+      this->micros_to_next_expiry_ = remaining_micros; 
+      this->expiry_pending_        = true; 
+    }
+  }
+
+  this->expiry_reference_micros_ = this->most_recently_seen_external_time_; 
+}
+
+
+// helper method; lines the BCD counter up with the given time, the one place that divides 
+//    unsigned long microsecs - the time left 
+void Fencing_Clock::sync_digits_to_micros(unsigned long microsecs)
+{
   // check your inputs so you don't overflow the timer  
   if (microsecs > this->MAX_MICROS_) microsecs = this->MAX_MICROS_;
 
-  // abuse int math to get whole number of ten-mins-chunks
-  uint8_t tens_of_minutes = microsecs / (this->MICROS_IN_SEC_ * this->SECS_IN_MIN_ * 10); 
-  if (tens_of_minutes != 0) 
+  // one long division down to tenths; 70 minutes of them fits in 16 bits, so the rest is cheap 
+  uint16_t tenths  = microsecs / this->MICROS_IN_TENTH_; 
+  uint16_t seconds = tenths  / 10; 
+  uint8_t  minutes = seconds / this->SECS_IN_MIN_; 
+
+  this->time_digits_[TENS_OF_MINUTES] = minutes / 10; 
+  this->time_digits_[MINUTES]         = minutes % 10; 
+  this->time_digits_[TENS_OF_SECONDS] = (seconds % this->SECS_IN_MIN_) / 10; 
+  this->time_digits_[SECONDS]         = (seconds % this->SECS_IN_MIN_) % 10; 
+  this->time_digits_[TENTHS]          = tenths % 10; 
+
+  // the bottom of the tenth we're showing; we count down once the time left drops below it 
+  this->time_digits_floor_micros_     = (unsigned long)tenths * this->MICROS_IN_TENTH_; 
+
+  this->time_digits_need_sync_        = false; 
+  this->time_string_needs_sending_    = true; 
+}
+
+
+// helper method; takes a tenth off the BCD counter, borrowing as needed; returns true if more than the 
+// tenths digit changed 
+bool Fencing_Clock::count_down_one_tenth()
+{
+  // what each digit wraps round to when it's borrowed from 
+  static const uint8_t DIGIT_MAXES[TIME_DIGIT_COUNT_] = {9, 9, 5, 9, 9}; 
+
+  // least significant first; a digit with something in it just drops by one, a zero borrows from the next 
+  for (int8_t i = TENTHS; i >= 0; i--)
   {
-    return_string.setCharAt(0, '0' + tens_of_minutes);  // [0] is the first digit in the time string and therefore the tens-of-minutes place 
+    if (this->time_digits_[i] != 0)
+    {
+      this->time_digits_[i]--; 
+      return i != TENTHS; 
+    }
+
+    this->time_digits_[i] = DIGIT_MAXES[i]; 
   }
-  
-  // modulo gets the remainder (micros minus all the ten minutes) which we can then further convert (and int math drops off decimals)
-  uint8_t minutes         = (microsecs % (this->MICROS_IN_SEC_ * this->SECS_IN_MIN_ * 10)) / (this->MICROS_IN_SEC_ * this->SECS_IN_MIN_); 
-  if (!(minutes == 0 && tens_of_minutes == 0)) // if they're both zero, you want to leave it blank (no digits so far)
+
+  // already all zero (which we never count down from); put it back 
+  for (uint8_t i = 0; i < TIME_DIGIT_COUNT_; i++)
+  {
+    this->time_digits_[i] = 0; 
+  }
+  return false; 
+}
+
+
+// helper method; whether what's up right now should be in tenths 
+bool Fencing_Clock::showing_tenths()
+{
+  return this->tenths_enabled_                      && 
+         this->time_digits_[TENS_OF_MINUTES] == 0   && 
+         this->time_digits_[MINUTES]         == 0   && 
+         this->time_digits_[TENS_OF_SECONDS] == 0; 
+}
+
+
+// helper method; turns the BCD counter into characters for the display 
+//    char time_string[] - where to put it; Seven_Segment_Display::DISPLAY_SIZE_ characters, no NUL 
+void Fencing_Clock::get_time_string_from_digits(char time_string[])
+{
+  // start off with a blank string the size of our display
+  memset(time_string, ' ', Seven_Segment_Display::DISPLAY_SIZE_); 
+
+  // under ten seconds: seconds, then tenths after the ":" 
+  if (this->showing_tenths())
+  {
+    time_string[1] = '0' + this->time_digits_[SECONDS]; 
+    time_string[2] = '0' + this->time_digits_[TENTHS]; 
+    return; 
+  }
+
+  // [0] is the first digit in the time string and therefore the tens-of-minutes place 
+  bool leading = true; 
+  if (this->time_digits_[TENS_OF_MINUTES] != 0)
   {
-    return_string.setCharAt(1, '0' + minutes);  // [1] is the second digit in the time string and therefore the minutes place 
+    time_string[0] = '0' + this->time_digits_[TENS_OF_MINUTES]; 
+    leading        = false; 
   }
 
-  // modulo gets the remainder (micros minus all the minutes) which we can then further convert (and int math drops off decimals)
-  uint8_t tens_of_seconds = (microsecs % (this->MICROS_IN_SEC_ * this->SECS_IN_MIN_)) / (this->MICROS_IN_SEC_ * 10); 
-  if (!(tens_of_seconds == 0 && minutes == 0 && tens_of_minutes == 0)) // if they're all zero, you want to leave it blank (no digits so far)
+  // [1] is the minutes place; blank if there are no digits so far 
+  if (!(leading && this->time_digits_[MINUTES] == 0))
   {
-    return_string.setCharAt(2, '0' + tens_of_seconds);  // [2] is the third digit in the time string and therefore the tens-of-seconds place 
+    time_string[1] = '0' + this->time_digits_[MINUTES]; 
+    leading        = false; 
   }
 
-  // modulo gets the remainder (micros minus all the ten-second-chunks) which we can then further convert (and int math drops off decimals)
-  // [3] is the fourth digit in the time string and therefore the seconds place 
-  return_string.setCharAt(3, '0' + ((microsecs % (this->MICROS_IN_SEC_ * 10)) / (this->MICROS_IN_SEC_)) ); 
+  // [2] is the tens-of-seconds place; likewise 
+  if (!(leading && this->time_digits_[TENS_OF_SECONDS] == 0))
+  {
+    time_string[2] = '0' + this->time_digits_[TENS_OF_SECONDS]; 
+  }
 
-  // send it back
-  return return_string;
+  // [3] is the seconds place, always shown 
+  time_string[3] = '0' + this->time_digits_[SECONDS]; 
 }
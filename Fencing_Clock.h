@@ -4,7 +4,30 @@
 //  Dev     : Nate Cope,                                                      //
 //  Version : 1.2                                                             //
 //  Date    : Jan 2023                                                        //
-//  Notes   :                                                                 //
+//  Notes   : - What's shown is kept as a little BCD counter (tens of         //
+//              minutes, minutes, tens of seconds, seconds, tenths) that      //
+//              counts down a tenth at a time, borrowing from the digit to    //
+//              its left, whenever the time left drops past the next tenth;   //
+//              tick() is a subtraction and a compare, with no 32-bit         //
+//              division (a slow software routine on AVR) anywhere near it.   //
+//              Only setting the time divides, to line the digits back up     //
+//            - Under ten seconds, tenths are shown (" 9:5 "), per FIE rules; //
+//              see set_tenths_enabled()                                      //
+//            - Hosts several timers on the one display: the bout, the        //
+//              one-minute break, the injury timer and a warm-up. They all    //
+//              keep running whichever is shown; start() and friends act on   //
+//              the one shown, the *_timer() versions on any. tick() only     //
+//              looks at the soonest time any of them runs out, so more       //
+//              timers don't make it any dearer                               //
+//            - Each change to the digits is sent a little early, by a        //
+//              running average of how long the display's been taking to      //
+//              show one, so it lands on the true tenth / second instead of   //
+//              however long after it the loop and the display got round to   //
+//              it; see set_display_lead_enabled() and                        //
+//              get_display_lag_statistics()                                  //
+//            - Stopped inside that lead, the time left is snapped down to    //
+//              what's showing (it's out by the lead at most), so the digits  //
+//              never go back up when the clock stops                         //
 //============================================================================//
 
 #ifndef FENCING_CLOCK_H
@@ -32,22 +55,90 @@ class Fencing_Clock
     // if "0" is passed in specifically, we're just updating the display, and no time checks are done 
     void tick(unsigned long current_time_micros); 
 
-    // Set the clock to be running
+    // the timers, in the order show_next_timer() goes through them 
+    enum timer_id
+    {
+      BOUT_TIMER,
+      BREAK_TIMER,
+      INJURY_TIMER,
+      WARM_UP_TIMER,
+      TIMER_COUNT_
+    };
+
+    // Set the clock (the timer shown) to be running
     void start();
 
-    // Set the clock to be paused 
+    // Set the clock (the timer shown) to be paused 
     void stop();
 
-    // Start the clock if stopped, stop the clock if started 
+    // Start the clock (the timer shown) if stopped, stop it if started 
     void toggle();
 
-    // Return the remaining time left on the clock, in microseconds
+    // Whether the clock (the timer shown) is currently running 
+    bool is_running(); 
+
+    // Return the remaining time left on the clock (the timer shown), in microseconds
     unsigned long get_remaining_micros(); 
 
-    // set the remaining time on the clock
+    // set the remaining time on the clock (the timer shown)
     //    unsigned long new_micros - what the clock should be set to, in microseconds  
     void set_time(unsigned long new_micros);
 
+    // As above, for any timer 
+    //    uint8_t timer - which one (see timer_id) 
+    void          start_timer(uint8_t timer);       // (a break, injury or warm-up timer that's run out starts again from the top) 
+    void          stop_timer(uint8_t timer); 
+    void          toggle_timer(uint8_t timer); 
+    bool          is_timer_running(uint8_t timer); 
+    unsigned long get_timer_remaining_micros(uint8_t timer); 
+    void          set_timer_time(uint8_t timer, unsigned long new_micros); 
+
+    // put a timer back to its standard length (three minutes for the bout, one for the break, and so on) 
+    //    uint8_t timer - which one (see timer_id) 
+    void reset_timer(uint8_t timer); 
+
+    // show a different timer on the display (flashing its name up first); none of them stop or start 
+    //    uint8_t timer - which one (see timer_id) 
+    void show_timer(uint8_t timer); 
+
+    // show the next timer along, wrapping round 
+    void show_next_timer(); 
+
+    // which timer's shown 
+    uint8_t get_shown_timer(); 
+
+    // choose whether the last ten seconds show tenths (s:t) or stay whole seconds (m:ss) like the rest 
+    //    bool enabled - true for tenths 
+    void set_tenths_enabled(bool enabled);
+
+    // whether the last ten seconds show tenths 
+    bool is_tenths_enabled(); 
+
+    // choose whether changes to the digits are sent early enough to land on the true tenth / second (by however long 
+    // the display's been taking to show one), or only once it's passed 
+    //    bool enabled - true for early 
+    void set_display_lead_enabled(bool enabled); 
+
+    // whether changes to the digits are sent early 
+    bool is_display_lead_enabled(); 
+
+    // how far after the true tenth / second each change to the time showed up on the display (negative is before), as 
+    // seen by tick(), since construction or the last reset 
+    struct display_lag_statistics
+    {
+      unsigned long samples;                // changes seen to land 
+      long          total_lag_micros;       // for the mean 
+      long          earliest_lag_micros; 
+      long          latest_lag_micros;      // the jitter's the gap between this and the earliest 
+      unsigned long lead_micros;            // how early changes are being sent right now 
+    };
+
+    // Returns a copy of the display lag accounting 
+    display_lag_statistics get_display_lag_statistics(); 
+
+    // Zeroes the display lag accounting 
+    void reset_display_lag_statistics(); 
+
     // pointer to the display being used as a clock 
     //    I trusted you with public level access to this, okay? So don't abuse it. Be good. 
     //    Only touch it for what you actually need and can't get through the normal interface
@@ -61,26 +152,105 @@ class Fencing_Clock
   private:
 
     // time constants only relevant to this 
-    const unsigned long STARTING_MICROS_        = 3  * SECS_IN_MIN_ * MICROS_IN_SEC_; 
     const unsigned long MAX_MICROS_             = 70 * SECS_IN_MIN_ * MICROS_IN_SEC_; // due to unsigned long constraints  
 
-    // track the clock's active status; we want to begin with the clock paused 
-    boolean is_running_ = false;  
+    // how long a timer's name is shown for when it's switched to 
+    const static unsigned long TIMER_NAME_MICROS_     = 1 * MICROS_IN_SEC_; 
+
+    // one timer 
+    struct countdown
+    {
+      bool          running;          // we want to begin with them all paused 
+      unsigned long set_micros;       // how much was left on it when it was last started or set 
+      unsigned long started_micros;   // when it was last started 
+    };
+
+    // the timers, and which is shown 
+    countdown timers_ [TIMER_COUNT_]; 
+    uint8_t   shown_timer_                           = BOUT_TIMER; 
 
-    // track how much is left on the timer 
-    unsigned long current_clock_time_micros_ = this->STARTING_MICROS_; 
+    // the soonest time any running timer runs out, kept as a span from when it was worked out (so it's safe 
+    // across micros() rolling over, even for the longest timer) 
+    bool          expiry_pending_                    = false; 
+    unsigned long expiry_reference_micros_           = 0; 
+    unsigned long micros_to_next_expiry_             = 0; 
 
-    // helper method; make conversion from unformatted microseconds to human-readable time string easy  
-    String get_time_string_from_micros(unsigned long microsecs);
+    // helper method; works out the soonest time any running timer runs out 
+    void update_next_expiry(); 
 
-    // track the time since we started to do time math better 
-    unsigned long time_of_most_recent_start_         = 0; 
+    // the digits of the BCD counter, most significant first 
+    enum time_digit
+    {
+      TENS_OF_MINUTES,
+      MINUTES,
+      TENS_OF_SECONDS,
+      SECONDS,
+      TENTHS,
+      TIME_DIGIT_COUNT_
+    };
+
+    // how long a tenth is, the counter's unit 
+    const static unsigned long MICROS_IN_TENTH_       = MICROS_IN_SEC_ / 10; 
+
+    // falling further behind than this (a long stall, say) lines the digits back up instead of counting down to catch up 
+    const static unsigned long MAX_CATCH_UP_MICROS_   = MICROS_IN_SEC_; 
+
+    // helper method; lines the BCD counter up with the given time, the one place that divides 
+    //    unsigned long microsecs - the time left 
+    void sync_digits_to_micros(unsigned long microsecs); 
+
+    // helper method; takes a tenth off the BCD counter, borrowing as needed; returns true if more than the 
+    // tenths digit changed 
+    bool count_down_one_tenth(); 
+
+    // helper method; whether what's up right now should be in tenths 
+    bool showing_tenths(); 
+
+    // helper method; turns the BCD counter into characters for the display 
+    //    char time_string[] - where to put it; Seven_Segment_Display::DISPLAY_SIZE_ characters, no NUL 
+    void get_time_string_from_digits(char time_string[]);
+
+    // the BCD counter: what's shown, to the tenth, and the time left at which it next counts down (i.e., the 
+    // bottom of the tenth it's showing) 
+    uint8_t       time_digits_ [TIME_DIGIT_COUNT_]   = {0, 0, 0, 0, 0}; 
+    unsigned long time_digits_floor_micros_          = 0; 
+
+    // the counter needs lining back up (the time's been set) / the display needs redoing 
+    bool          time_digits_need_sync_             = true; 
+    bool          time_string_needs_sending_         = true; 
+
+    // whether the last ten seconds show tenths 
+    bool          tenths_enabled_                    = true; 
+
+    // the most changes are ever sent early, so a display that's stopped answering can't drag the digits ahead 
+    const static unsigned long MAX_DISPLAY_LEAD_MICROS_     = 50000; 
+
+    // the lead's a running average; each new time-to-visible counts for 1 / this of it 
+    const static long          DISPLAY_LEAD_AVERAGING_      = 8; 
+
+    // whether changes are sent early, and by how much 
+    bool          display_lead_enabled_              = true; 
+    unsigned long display_lead_micros_               = 0; 
+
+    // the change to the time being watched on its way to the display: handed to it this tick / going out 
+    enum lag_watch
+    {
+      LAG_WATCH_IDLE,
+      LAG_WATCH_STAGED,
+      LAG_WATCH_SENDING
+    };
+    uint8_t       lag_watch_                         = LAG_WATCH_IDLE; 
+    unsigned long lag_boundary_micros_               = 0;   // when it should land 
+    unsigned long lag_staged_micros_                 = 0;   // when it was handed over 
+
+    // display lag accounting 
+    display_lag_statistics lag_statistics_           = {0, 0, 0, 0, 0}; 
+
+    // helper method; records how late the watched change landed, and folds how long it took into the lead 
+    void note_display_lag(); 
 
     // track the time we're told about to make stopping and starting simpler
     unsigned long most_recently_seen_external_time_  = 0; 
-
-    // redundancy check so we're not packing new strings for the same result over and over 
-    unsigned long last_sent_number_of_whole_seconds_ = 0; 
 };
 
 #endif 
@@ -4,13 +4,59 @@
 //  Dev     : Nate Cope,                                                     //
 //  Date    : Jan 2023                                                       //
 //  Version : 1.2                                                            //
-//  Notes   : TODO a show-off on time running out, too??                     //
-//            TODO cool animation methods and resulting tick method          // 
+//  Notes   : - Nothing calls show() but commit(); see the header            //
+//            - Nor does an animation, which only draws into the pixel       //
+//              buffer, a frame per tick() at most                           //
 //===========================================================================//
 
 // interface includes
 #include "Fencing_Light.h"
 
+// every color at full brightness, in the color enum's order, in the ring's byte order (green, red, blue) 
+static const uint8_t FULL_BRIGHTNESS_COLORS_[][3] PROGMEM = 
+{
+  {0x00, 0xFF, 0x00},   // red 
+  {0xFF, 0x00, 0x00},   // green 
+  {0x7F, 0x7F, 0x7F},   // white; half brightness because all three lights working together makes it seem brighter anyway 
+  {0x00, 0x00, 0x00}    // none (dark) 
+};
+
+// which LEDs the "touching own lame" signal lights: some ARBITRARY pattern (currently a square) 
+static const uint8_t SHORT_CIRCUIT_PIXELS_[] PROGMEM = {1, 5, 9, 13}; 
+
+// the animations: which LEDs, what color, how many hundredths of a second a frame, how many more frames turning round 
+// a green spark, then a red one, round the ring, then a white flash 
+static const Fencing_Light::animation_keyframe STARTUP_ANIMATION_[] PROGMEM = 
+{
+  {0x0001, Fencing_Light::GREEN,  3, 15}, 
+  {0x0001, Fencing_Light::RED,    3, 15}, 
+  {0xFFFF, Fencing_Light::WHITE, 20,  0} 
+}; 
+
+// red and green back and forth, for one touch each to win 
+static const Fencing_Light::animation_keyframe LABELLE_ANIMATION_[] PROGMEM = 
+{
+  {0xFFFF, Fencing_Light::RED,   15, 0}, 
+  {0xFFFF, Fencing_Light::GREEN, 15, 0}, 
+  {0xFFFF, Fencing_Light::RED,   15, 0}, 
+  {0xFFFF, Fencing_Light::GREEN, 15, 0}, 
+  {0xFFFF, Fencing_Light::RED,   15, 0}, 
+  {0xFFFF, Fencing_Light::GREEN, 15, 0} 
+}; 
+
+// three white flashes (every other LED, so it can't be mistaken for an off-target light) 
+static const Fencing_Light::animation_keyframe ALERT_ANIMATION_[] PROGMEM = 
+{
+  {0x5555, Fencing_Light::WHITE, 10, 0}, 
+  {0x0000, Fencing_Light::NONE,  10, 0}, 
+  {0x5555, Fencing_Light::WHITE, 10, 0}, 
+  {0x0000, Fencing_Light::NONE,  10, 0}, 
+  {0x5555, Fencing_Light::WHITE, 10, 0} 
+}; 
+
+// how long a hundredth of a second is 
+static const unsigned long MICROS_IN_CENTI_ = 10000; 
+
 // TODO TODO TODO redundancy color checks! 
 // TODO short circuit light implementation logic is gonna need work 
 //      to keep it essentially independant from what the other lights 
@@ -31,13 +77,15 @@ Fencing_Light::Fencing_Light(uint8_t control_pin)
   pinMode(this->CONTROL_PIN_, OUTPUT);  
 
   // define the NeoPixel object, that last arg is some library thing we don't have to care about 
-  this->led_ring_ = new Adafruit_NeoPixel(this->LED_COUNT_, this->CONTROL_PIN_, NEO_GRB + NEO_KHZ800);
+  this->led_ring_      = new Adafruit_NeoPixel(this->LED_COUNT_, this->CONTROL_PIN_, NEO_GRB + NEO_KHZ800);
+  this->owns_led_ring_ = true; 
+  this->first_pixel_   = 0; 
 
   // INITIALIZE the NeoPixel object 
   this->led_ring_->begin();  
 
   // Set BRIGHTNESS to 1/5 the max of 255 as an arbitrary starting point 
-  this->led_ring_->setBrightness(this->MAX_BRIGHTNESS_ / 5); 
+  this->set_brightness(this->MAX_BRIGHTNESS_ / 5); 
 
   // if you call this line here, the whole thing hangs and won't respond
   //   and I don't know why. Fortunately, you don't need to. 
@@ -45,11 +93,34 @@ Fencing_Light::Fencing_Light(uint8_t control_pin)
 }
 
 
+// Constructor, for a ring chained on one data line with another; the strip's shared, so it isn't ours to 
+// begin() or delete 
+//    uint8_t            control_pin  - the Arduino pin the strip's data line is on 
+//    Adafruit_NeoPixel* shared_strip - the whole chain 
+//    uint8_t            first_pixel  - where on it this ring starts 
+Fencing_Light::Fencing_Light(uint8_t control_pin, Adafruit_NeoPixel* shared_strip, uint8_t first_pixel)
+{
+  // set the control pin (whoever made the strip has already set it up) 
+  this->CONTROL_PIN_   = control_pin;
+
+  // draw on our part of the shared strip 
+  this->led_ring_      = shared_strip; 
+  this->owns_led_ring_ = false; 
+  this->first_pixel_   = first_pixel; 
+
+  // the same arbitrary starting point as our own ring would get 
+  this->set_brightness(this->MAX_BRIGHTNESS_ / 5); 
+}
+
+
 // Destructor 
 Fencing_Light::~Fencing_Light()
 {
-  // delete the underlying object we allocated memory for 
-  delete this->led_ring_;      
+  // delete the underlying object we allocated memory for (if it was us) 
+  if (this->owns_led_ring_)
+  {
+    delete this->led_ring_;      
+  }
 }
 
 // Lets the object know what the current time is. For the sake of streamlining 
@@ -58,7 +129,45 @@ Fencing_Light::~Fencing_Light()
 // if "0" is passed in specifically, we're just updating the display, and no time checks are done 
 void Fencing_Light::tick(unsigned long current_time_micros)
 {
-  // currently NO-OP
+  // only an animation needs the time, and it waits while a fencer's in contact 
+  if (current_time_micros == 0 || this->animation_ == NULL || this->contact_pending_)
+  {
+    return; 
+  }
+
+  // not due yet 
+  if (this->animation_frame_drawn_ && (long)(current_time_micros - this->next_frame_micros_) < 0)
+  {
+    return; 
+  }
+
+  // after the first frame, move on one: round the sweep, or on to the next step 
+  if (this->animation_frame_drawn_)
+  {
+    if (this->animation_rotation_ < pgm_read_byte(&this->animation_[this->animation_step_].rotations))
+    {
+      this->animation_rotation_++; 
+    }
+    else
+    {
+      this->animation_step_++; 
+      this->animation_rotation_ = 0; 
+
+      // all done; leave the ring dark 
+      if (this->animation_step_ == this->animation_count_)
+      {
+        this->animation_            = NULL; 
+        this->set_all_leds_to_color(this->color::NONE); 
+        this->frame_is_animation_   = true; 
+        this->current_display_state = this->display_state::DARK; 
+        return; 
+      }
+    }
+  }
+
+  this->draw_animation_frame(); 
+  this->animation_frame_drawn_ = true; 
+  this->next_frame_micros_     = current_time_micros + pgm_read_byte(&this->animation_[this->animation_step_].hold_centis) * MICROS_IN_CENTI_; 
 }
 
 
@@ -67,6 +176,7 @@ void Fencing_Light::light_up_green()
 {
   if (this->current_display_state != this->display_state::ALL_GREEN)  // redundancy check 
   {
+    this->stop_animation(); 
     set_all_leds_to_color(this->color::GREEN); 
     this->current_display_state = this->display_state::ALL_GREEN; 
   }
@@ -78,6 +188,7 @@ void Fencing_Light::light_up_red()
 {
   if (this->current_display_state != this->display_state::ALL_RED)  // redundancy check 
   {
+    this->stop_animation(); 
     set_all_leds_to_color(this->color::RED); 
     this->current_display_state = this->display_state::ALL_RED;
   }
@@ -89,6 +200,7 @@ void Fencing_Light::light_up_white()
 {
   if (this->current_display_state != this->display_state::ALL_WHITE)   // redundancy check 
   {
+    this->stop_animation(); 
     set_all_leds_to_color(this->color::WHITE);
     this->current_display_state = this->display_state::ALL_WHITE; 
   }
@@ -101,15 +213,8 @@ void Fencing_Light::light_up_short_circuit_light()
   // redundancy check 
   if (!this->short_circuit_signal_on)
   {
-    //  set some ARBITRARY pattern (currently a square of 1, 5, 9, 13) to white
-    this->led_ring_->setPixelColor( 1,  this->get_color_code(this->color::WHITE) );      
-    this->led_ring_->setPixelColor( 5,  this->get_color_code(this->color::WHITE) );   
-    this->led_ring_->setPixelColor( 9,  this->get_color_code(this->color::WHITE) );      
-    this->led_ring_->setPixelColor( 13, this->get_color_code(this->color::WHITE) );     
-    
-    //  Update ring to match set colors TODO TODO redundancy check 
-    this->led_ring_->show();  
-  
+    this->stop_animation(); 
+    this->draw_short_circuit_overlay(); 
     this->short_circuit_signal_on = true; 
   }
 }
@@ -124,8 +229,10 @@ void Fencing_Light::set_brightness(uint8_t brightness)
   // update the internal parameter
   this->brightness_ = brightness;
 
-  // set the object's characteristics 
-  this->led_ring_->setBrightness(this->brightness_);
+  // rescale the colors and put what's up back in with them; the library's own brightness is left alone (at no 
+  // scaling), since nothing goes through its setPixelColor() to be scaled 
+  this->scale_colors(); 
+  this->redraw(); 
 }
 
 
@@ -134,6 +241,7 @@ void Fencing_Light::go_dark()
 {
   if (this->current_display_state != this->display_state::DARK)   // redundancy check 
   {
+    this->stop_animation(); 
     set_all_leds_to_color(this->color::NONE); 
     this->current_display_state   = this->display_state::DARK;
     this->short_circuit_signal_on = false;  // TODO this is gonna need work; short circuit needs to be kinda independent...
@@ -144,14 +252,103 @@ void Fencing_Light::go_dark()
 // do something cool to greet the world!  
 void Fencing_Light::show_off_on_startup()
 {
-  // currently no-op
+  this->play_animation(STARTUP_ANIMATION_, sizeof(STARTUP_ANIMATION_) / sizeof(STARTUP_ANIMATION_[0])); 
 }
 
 
 // do something cool for 4-4 or 15-15!
 void Fencing_Light::show_off_on_labelle()
 {
-  // currently no-op
+  this->play_animation(LABELLE_ANIMATION_, sizeof(LABELLE_ANIMATION_) / sizeof(LABELLE_ANIMATION_[0])); 
+}
+
+
+// flash to get attention, e.g. for time running out 
+void Fencing_Light::flash_alert()
+{
+  this->play_animation(ALERT_ANIMATION_, sizeof(ALERT_ANIMATION_) / sizeof(ALERT_ANIMATION_[0])); 
+}
+
+
+// Plays an animation on the ring, a frame at a time as tick() finds them due; lighting anything else up 
+// cancels it, and it leaves the ring dark when it's done. Does nothing while a hit or short circuit's lit up 
+//    const animation_keyframe frames[] - the steps, in PROGMEM 
+//    uint8_t                  count    - how many there are 
+void Fencing_Light::play_animation(const animation_keyframe frames[], uint8_t count)
+{
+  if (frames == NULL || count == 0)
+  {
+    return; 
+  }
+
+  // a touch's lights stay up for as long as the touch says; nothing gets drawn over them 
+  if (this->current_display_state == this->display_state::ALL_RED   || 
+      this->current_display_state == this->display_state::ALL_GREEN || 
+      this->current_display_state == this->display_state::ALL_WHITE || 
+      this->short_circuit_signal_on)
+  {
+    return; 
+  }
+
+  // whatever was up gets drawn over; the first frame goes in at the next tick 
+  this->animation_                = frames; 
+  this->animation_count_          = count; 
+  this->animation_step_           = 0; 
+  this->animation_rotation_       = 0; 
+  this->animation_frame_drawn_    = false; 
+  this->current_display_state     = this->display_state::ANIMATING; 
+  this->short_circuit_signal_on   = false; 
+}
+
+
+// whether an animation's playing 
+bool Fencing_Light::is_animating()
+{
+  return this->animation_ != NULL; 
+}
+
+
+// tells the ring whether a fencer's in contact or a touch is being decided; while one is, animations hold 
+// still, and any frame already drawn waits to be sent 
+//    bool pending - true while a contact's pending 
+void Fencing_Light::set_contact_pending(bool pending)
+{
+  this->contact_pending_ = pending; 
+}
+
+
+// Sends whatever's changed since the last commit out to the ring in one show(); returns how many pixels went 
+// out (the whole strip, if it's shared), or 0 if nothing had changed and so nothing did 
+uint16_t Fencing_Light::commit()
+{
+  if (!this->needs_commit())
+  {
+    return 0; 
+  }
+
+  //  Update ring to match set colors 
+  Latency_Probe::mark(Latency_Probe::SHOW_BEGIN);
+  this->led_ring_->show();                    
+  Latency_Probe::mark(Latency_Probe::SHOW_END);
+
+  this->frame_dirty_ = false; 
+
+  return this->led_ring_->numPixels(); 
+}
+
+
+// whether anything's changed since the last commit 
+bool Fencing_Light::needs_commit()
+{
+  // an animation frame never costs a blackout while a contact's pending; it can go out afterwards 
+  return this->frame_dirty_ && !(this->frame_is_animation_ && this->contact_pending_); 
+}
+
+
+// for a shared strip, when the other ring on it has just sent it (and so this ring's changes too) 
+void Fencing_Light::note_committed()
+{
+  this->frame_dirty_ = false; 
 }
 
 //
@@ -162,54 +359,119 @@ void Fencing_Light::show_off_on_labelle()
 //  to the provided color (provided as an enum)
 void Fencing_Light::set_all_leds_to_color(color color_enum_val)
 {
-  // For each pixel in strip...
-  for (int i = 0; i < this->led_ring_->numPixels(); i++) 
+  // copy the ready-scaled color straight into each of our ring's pixels 
+  const uint8_t* color_bytes = this->scaled_colors_[color_enum_val]; 
+  uint8_t*       pixel       = this->led_ring_->getPixels() + this->first_pixel_ * this->BYTES_PER_PIXEL_; 
+
+  for (uint8_t i = 0; i < this->LED_COUNT_; i++) 
   { 
-    //  Set pixel's colors
-    this->led_ring_->setPixelColor( i, this->get_color_code(color_enum_val) );         
+    pixel[0]  = color_bytes[0]; 
+    pixel[1]  = color_bytes[1]; 
+    pixel[2]  = color_bytes[2]; 
+    pixel    += this->BYTES_PER_PIXEL_; 
   }
 
-  //  Update ring to match set colors 
-  this->led_ring_->show();                    
+  //  the ring's updated to match at the next commit 
+  this->frame_dirty_ = true; 
+}
+
+
+// helper method; puts the "touching own lame" pattern over whatever's in the ring 
+void Fencing_Light::draw_short_circuit_overlay()
+{
+  const uint8_t* color_bytes = this->scaled_colors_[this->color::WHITE]; 
+  uint8_t*       ring        = this->led_ring_->getPixels() + this->first_pixel_ * this->BYTES_PER_PIXEL_; 
+
+  for (uint8_t i = 0; i < sizeof(SHORT_CIRCUIT_PIXELS_); i++)
+  {
+    uint8_t* pixel = ring + pgm_read_byte(&SHORT_CIRCUIT_PIXELS_[i]) * this->BYTES_PER_PIXEL_; 
+    pixel[0] = color_bytes[0]; 
+    pixel[1] = color_bytes[1]; 
+    pixel[2] = color_bytes[2]; 
+  }
+
+  //  the ring's updated to match at the next commit 
+  this->frame_dirty_ = true; 
 }
 
 
-// helper method to make code clean, just converts a color enum value 
-//  into an actual underying-class color value (some uint32_t) that 
-//  it can understand  
-// TODO should it be max brightness or scale based on what the brightness setting currently is?
-uint32_t Fencing_Light::get_color_code(color color_enum_val)
+// helper method; works out scaled_colors_ for the current brightness, the same way the library would scale them 
+void Fencing_Light::scale_colors()
 {
-    uint32_t return_val = 0; 
-    
-    switch (color_enum_val)
+  uint16_t scale = (uint16_t)this->brightness_ + 1; 
+
+  for (uint8_t i = 0; i < COLOR_COUNT_; i++)
+  {
+    for (uint8_t j = 0; j < this->BYTES_PER_PIXEL_; j++)
     {
-      case this->color::RED:
-        return_val = this->led_ring_->Color( this->MAX_BRIGHTNESS_,   
-                                             this->MIN_BRIGHTNESS_,   
-                                             this->MIN_BRIGHTNESS_
-                                          );
-        break;
-      case this->color::GREEN:
-        return_val = this->led_ring_->Color( this->MIN_BRIGHTNESS_,   
-                                             this->MAX_BRIGHTNESS_,   
-                                             this->MIN_BRIGHTNESS_
-                                          );
-        break;
-      case this->color::WHITE:
-        // half brightness because all three lights working together 
-        //  makes it seem brighter anyway 
-        return_val = this->led_ring_->Color( this->MAX_BRIGHTNESS_ / 2,   
-                                             this->MAX_BRIGHTNESS_ / 2,    
-                                             this->MAX_BRIGHTNESS_ / 2
-                                          );
-        break;
-      default:  // just zero (dark) on anything else. color::NONE ends up here, importantly 
-        return_val = this->led_ring_->Color( this->MIN_BRIGHTNESS_,   
-                                             this->MIN_BRIGHTNESS_,   
-                                             this->MIN_BRIGHTNESS_
-                                          );
+      this->scaled_colors_[i][j] = (pgm_read_byte(&FULL_BRIGHTNESS_COLORS_[i][j]) * scale) >> 8; 
     }
+  }
+}
+
+
+// helper method; draws whatever should be up back into the ring, e.g. after the brightness changes 
+void Fencing_Light::redraw()
+{
+  switch (this->current_display_state)
+  {
+    case this->display_state::ALL_RED:   this->set_all_leds_to_color(this->color::RED);   break; 
+    case this->display_state::ALL_GREEN: this->set_all_leds_to_color(this->color::GREEN); break; 
+    case this->display_state::ALL_WHITE: this->set_all_leds_to_color(this->color::WHITE); break; 
+    case this->display_state::ANIMATING: this->draw_animation_frame();                    break; 
+    default:                             this->set_all_leds_to_color(this->color::NONE);  break; 
+  }
+
+  if (this->short_circuit_signal_on)
+  {
+    this->draw_short_circuit_overlay(); 
+  }
+}
+
+
+// helper method; draws the animation's current frame into the ring 
+void Fencing_Light::draw_animation_frame()
+{
+  if (this->animation_ == NULL)
+  {
+    return; 
+  }
+
+  animation_keyframe step; 
+  memcpy_P(&step, &this->animation_[this->animation_step_], sizeof(step)); 
+
+  // turn the mask round for a sweep (the double-width shift brings the top bits back round to the bottom) 
+  uint32_t doubled = ((uint32_t)step.pixel_mask << 16) | step.pixel_mask; 
+  uint16_t lit     = (uint16_t)(doubled >> (16 - this->animation_rotation_ % this->LED_COUNT_)); 
+
+  const uint8_t* color_bytes = this->scaled_colors_[step.color < COLOR_COUNT_ ? step.color : NONE]; 
+  const uint8_t* dark_bytes  = this->scaled_colors_[NONE]; 
+  uint8_t*       pixel       = this->led_ring_->getPixels() + this->first_pixel_ * this->BYTES_PER_PIXEL_; 
+
+  for (uint8_t i = 0; i < this->LED_COUNT_; i++) 
+  { 
+    const uint8_t* bytes = (lit & (1 << i)) ? color_bytes : dark_bytes; 
+    pixel[0]  = bytes[0]; 
+    pixel[1]  = bytes[1]; 
+    pixel[2]  = bytes[2]; 
+    pixel    += this->BYTES_PER_PIXEL_; 
+  }
+
+  this->frame_dirty_        = true; 
+  this->frame_is_animation_ = true; 
+}
+
+
+// helper method; cancels any animation, leaving the ring dark for whatever's lit up instead 
+void Fencing_Light::stop_animation()
+{
+  if (this->current_display_state == this->display_state::ANIMATING)
+  {
+    this->animation_            = NULL; 
+    this->set_all_leds_to_color(this->color::NONE); 
+    this->current_display_state = this->display_state::DARK; 
+  }
 
-    return return_val; 
+  // what's drawn next isn't an animation frame, so it goes out whether or not a contact's pending 
+  this->frame_is_animation_ = false; 
 }
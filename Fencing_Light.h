@@ -4,9 +4,21 @@
 //  Dev     : Nate Cope,                                                     //
 //  Date    : Jan 2023                                                       //
 //  Version : 1.2                                                            //
-//  Notes   : TODO a show-off on time running out, too??                     //
-//            TODO cool animation methods and resulting tick method          // 
-//            Requires NeoPixel Library to be installed                      //
+//  Notes   : Requires NeoPixel Library to be installed                      //
+//            - Every show() turns interrupts off for the whole frame (about //
+//              30us a pixel), so nothing here calls it straight away: the   //
+//              light changes build up in the pixel buffer and go out in one //
+//              show() when commit() is called, once a loop                  //
+//            - Can draw on its own ring, or on its part of a strip shared   //
+//              with another ring chained on the same data line              //
+//            - The colors are kept ready-scaled to the brightness, in the   //
+//              ring's own byte order, and copied straight into the pixel    //
+//              buffer; the library's per-pixel Color() / setPixelColor()    //
+//              / brightness scaling only happens when the brightness does   //
+//            - Animations are lists of keyframes in flash, drawn a frame at //
+//              a time from tick() as they come due; never while a contact's //
+//              pending (see set_contact_pending()), and anything else lit   //
+//              up cancels them, so they can't get in the way of a touch     //
 //===========================================================================//
 
 #ifndef FENCING_LIGHT_H
@@ -18,6 +30,7 @@
 
 // local includes
 #include <Adafruit_NeoPixel.h>
+#include "Latency_Probe.h"
 
 // A class to control a ring light for a fencing scoring machine 
 class Fencing_Light
@@ -28,6 +41,13 @@ class Fencing_Light
     //    uint8_t control_pin - the Arduino pin control terminal of the fencing light  
     Fencing_Light(uint8_t control_pin);
 
+    // Constructor, for a ring chained on one data line with another; the strip's shared, so it isn't ours to 
+    // begin() or delete 
+    //    uint8_t            control_pin  - the Arduino pin the strip's data line is on 
+    //    Adafruit_NeoPixel* shared_strip - the whole chain 
+    //    uint8_t            first_pixel  - where on it this ring starts 
+    Fencing_Light(uint8_t control_pin, Adafruit_NeoPixel* shared_strip, uint8_t first_pixel);
+
     // Destructor 
     ~Fencing_Light();
 
@@ -61,6 +81,56 @@ class Fencing_Light
     // do something cool for 4-4 or 15-15!
     void show_off_on_labelle();
 
+    // flash to get attention, e.g. for time running out 
+    void flash_alert();
+
+    // the colors the ring can show 
+    enum color
+    {
+      RED,
+      GREEN,
+      WHITE,
+      NONE,
+      COLOR_COUNT_
+    };
+
+    // one step of an animation; kept in flash (PROGMEM), so an animation costs no RAM 
+    struct animation_keyframe
+    {
+      uint16_t pixel_mask;    // which of the ring's LEDs are lit, bit 0 being LED 0; the rest are dark 
+      uint8_t  color;         // what they're lit (see color) 
+      uint8_t  hold_centis;   // how long each frame of the step shows, in hundredths of a second 
+      uint8_t  rotations;     // 0 for a still frame; otherwise, how many more frames the step goes on for, 
+                              // turning the mask one LED round each time (a sweep) 
+    };
+
+    // Plays an animation on the ring, a frame at a time as tick() finds them due; lighting anything else up 
+    // cancels it, and it leaves the ring dark when it's done. Does nothing while a hit or short circuit's lit up 
+    //    const animation_keyframe frames[] - the steps, in PROGMEM 
+    //    uint8_t                  count    - how many there are 
+    void play_animation(const animation_keyframe frames[], uint8_t count);
+
+    // whether an animation's playing 
+    bool is_animating();
+
+    // tells the ring whether a fencer's in contact or a touch is being decided; while one is, animations hold 
+    // still, and any frame already drawn waits to be sent 
+    //    bool pending - true while a contact's pending 
+    void set_contact_pending(bool pending);
+
+    // Sends whatever's changed since the last commit out to the ring in one show(); returns how many pixels went 
+    // out (the whole strip, if it's shared), or 0 if nothing had changed and so nothing did 
+    uint16_t commit();
+
+    // whether anything's changed since the last commit 
+    bool needs_commit();
+
+    // for a shared strip, when the other ring on it has just sent it (and so this ring's changes too) 
+    void note_committed();
+
+    // number of LEDs in the ring, inherent in the component 
+    static const uint8_t LED_COUNT_ = 16; 
+
 
   private: 
 
@@ -71,31 +141,20 @@ class Fencing_Light
     // pin controlling the LED ring, not actually a const because it gets mad at assignment 
     uint8_t CONTROL_PIN_;
 
-    // number of LEDs in the ring, inherent in the component 
-    const uint8_t LED_COUNT_ = 16; 
-
     // max brightess value constant; set by underlying library
     const uint8_t MAX_BRIGHTNESS_ = 255; 
 
     // min brightness value constant; set by underlying library 
     const uint8_t MIN_BRIGHTNESS_ = 0; 
 
-    // readable reference!
-    enum color
-    {
-      RED,
-      GREEN,
-      WHITE,
-      NONE
-    };
-
     // readable references relating to redundancy reduction
     enum display_state
     {
       ALL_RED,
       ALL_GREEN,
       ALL_WHITE,
-      DARK
+      DARK,
+      ANIMATING
     };
     display_state current_display_state   = display_state::DARK; 
     bool          short_circuit_signal_on = false; 
@@ -105,8 +164,31 @@ class Fencing_Light
     // Data members 
     //
     
-    // the main sub-library object 
+    // the main sub-library object, whether we made it (and so delete it), and where on it our ring starts 
     Adafruit_NeoPixel* led_ring_;
+    bool               owns_led_ring_;
+    uint8_t            first_pixel_;
+
+    // whether the pixel buffer's changed since the last show() 
+    bool               frame_dirty_  = false; 
+
+    // bytes in the pixel buffer per LED: green, red, blue, in that order on the wire 
+    static const uint8_t BYTES_PER_PIXEL_ = 3; 
+
+    // every color, scaled to the current brightness and in wire order, ready to copy in 
+    uint8_t            scaled_colors_ [COLOR_COUNT_][BYTES_PER_PIXEL_]; 
+
+    // the animation playing (NULL if none), where it's got to, and when the next frame's due 
+    const animation_keyframe* animation_               = NULL; 
+    uint8_t                   animation_count_         = 0; 
+    uint8_t                   animation_step_          = 0; 
+    uint8_t                   animation_rotation_      = 0; 
+    bool                      animation_frame_drawn_   = false; 
+    unsigned long             next_frame_micros_       = 0; 
+
+    // whether a contact's pending, and whether what's waiting to be sent is only an animation frame (and so can wait) 
+    bool                      contact_pending_         = false; 
+    bool                      frame_is_animation_      = false; 
     
     // ring light intensity 
     uint8_t brightness_; 
@@ -120,10 +202,20 @@ class Fencing_Light
     //  to the provided color (provided as an enum)
     void set_all_leds_to_color(color color_enum_value);
 
-    // helper method to make code clean, just converts a color enum value 
-    //  into an actual underying-class color value (some uint32_t) that 
-    //  it can understand  
-    uint32_t get_color_code(color color_enum_val);
+    // helper method; puts the "touching own lame" pattern over whatever's in the ring 
+    void draw_short_circuit_overlay(); 
+
+    // helper method; works out scaled_colors_ for the current brightness 
+    void scale_colors(); 
+
+    // helper method; draws whatever should be up back into the ring, e.g. after the brightness changes 
+    void redraw(); 
+
+    // helper method; draws the animation's current frame into the ring 
+    void draw_animation_frame(); 
+
+    // helper method; cancels any animation, leaving the ring dark for whatever's lit up instead 
+    void stop_animation(); 
 };
 
 #endif 
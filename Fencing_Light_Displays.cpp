@@ -13,11 +13,28 @@
 // Constructor 
 //    uint8_t left_fencer_light_control_pin   - the Arduino pin attached to the control pin of the left fencer's ring light
 //    uint8_t right_fencer_light_control_pin  - the Arduino pin attached to the control pin of the right fencer's ring light
-Fencing_Light_Displays::Fencing_Light_Displays(uint8_t left_fencer_light_control_pin, uint8_t right_fencer_light_control_pin)
+//    bool    rings_chained                   - if true, the right fencer's ring is chained on after the left's (its DIN on the 
+//                                              left ring's DOUT), so both go out on the left's pin in one show(), and the right's 
+//                                              pin is left alone 
+Fencing_Light_Displays::Fencing_Light_Displays(uint8_t left_fencer_light_control_pin, uint8_t right_fencer_light_control_pin, bool rings_chained)
 {
-  // initialize the individual light display pointers 
-  this->left_fencer_light_  = new Fencing_Light( left_fencer_light_control_pin); 
-  this->right_fencer_light_ = new Fencing_Light(right_fencer_light_control_pin);       
+  if (rings_chained)
+  {
+    // one strip, both rings' worth of pixels; the same library thing as Fencing_Light's own 
+    pinMode(left_fencer_light_control_pin, OUTPUT);  
+    this->shared_strip_ = new Adafruit_NeoPixel(2 * Fencing_Light::LED_COUNT_, left_fencer_light_control_pin, NEO_GRB + NEO_KHZ800);
+    this->shared_strip_->begin();
+
+    // initialize the individual light display pointers, the left ring first on the line 
+    this->left_fencer_light_  = new Fencing_Light(left_fencer_light_control_pin, this->shared_strip_, 0); 
+    this->right_fencer_light_ = new Fencing_Light(left_fencer_light_control_pin, this->shared_strip_, Fencing_Light::LED_COUNT_); 
+  }
+  else
+  {
+    // initialize the individual light display pointers 
+    this->left_fencer_light_  = new Fencing_Light( left_fencer_light_control_pin); 
+    this->right_fencer_light_ = new Fencing_Light(right_fencer_light_control_pin);       
+  }
 }
 
 // Destructor 
@@ -26,6 +43,9 @@ Fencing_Light_Displays::~Fencing_Light_Displays()
   // delete the underlying Fencing_Lights we allocated memory for 
   delete this->left_fencer_light_ ; 
   delete this->right_fencer_light_;       
+
+  // and the strip they were sharing, if they were (delete on NULL is fine) 
+  delete this->shared_strip_; 
 }
 
     
@@ -36,7 +56,7 @@ Fencing_Light_Displays::~Fencing_Light_Displays()
 // if "0" is passed in specifically, we're just updating the displays, and no time checks are done 
 void Fencing_Light_Displays::tick(unsigned long current_time_micros)
 {
-  // currently no-op (beyond passing on the tick)
+  // pass on the tick; it's what moves any animations along 
   this->left_fencer_light_ ->tick(current_time_micros);
   this->right_fencer_light_->tick(current_time_micros);
 }
@@ -90,10 +110,80 @@ void Fencing_Light_Displays::set_brightness(uint8_t brightness)
 
 void Fencing_Light_Displays::show_off_on_startup()
 {
-  // currently no-op
+  this->left_fencer_light_ ->show_off_on_startup();
+  this->right_fencer_light_->show_off_on_startup();
 }
 
 void Fencing_Light_Displays::show_off_on_labelle()
 {
-  // currently no-op
+  this->left_fencer_light_ ->show_off_on_labelle();
+  this->right_fencer_light_->show_off_on_labelle();
+}
+
+void Fencing_Light_Displays::flash_alert()
+{
+  this->left_fencer_light_ ->flash_alert();
+  this->right_fencer_light_->flash_alert();
+}
+
+
+// tells the lights whether a fencer's in contact or a touch is being decided; while one is, no animation frame is 
+// drawn or sent, so a show-off can't cost a blackout in the middle of a touch 
+//    bool pending - true while a contact's pending 
+void Fencing_Light_Displays::set_contact_pending(bool pending)
+{
+  this->left_fencer_light_ ->set_contact_pending(pending);
+  this->right_fencer_light_->set_contact_pending(pending);
+}
+
+
+// Sends every light change since the last commit out, one show() per ring that changed (one for both, if 
+// they're chained); call it once a loop, somewhere it's safe for interrupts to go off for a while 
+void Fencing_Light_Displays::commit()
+{
+  if (this->left_fencer_light_->needs_commit())
+  {
+    this->note_blackout(this->left_fencer_light_->commit()); 
+
+    // a chained strip sent the right ring's changes along with the left's 
+    if (this->shared_strip_ != NULL)
+    {
+      this->right_fencer_light_->note_committed(); 
+    }
+  }
+
+  if (this->right_fencer_light_->needs_commit())
+  {
+    this->note_blackout(this->right_fencer_light_->commit()); 
+  }
+}
+
+
+// Returns a copy of the blackout accounting 
+Fencing_Light_Displays::blackout_statistics Fencing_Light_Displays::get_blackout_statistics()
+{
+  return this->blackout_statistics_; 
+}
+
+
+// Zeroes the blackout accounting 
+void Fencing_Light_Displays::reset_blackout_statistics()
+{
+  this->blackout_statistics_.shows           = 0; 
+  this->blackout_statistics_.blackout_micros = 0; 
+}
+
+
+//
+//  private methods 
+//
+
+// helper method; notes a show() of the given number of pixels, if there was one 
+void Fencing_Light_Displays::note_blackout(uint16_t pixels_sent)
+{
+  if (pixels_sent != 0)
+  {
+    this->blackout_statistics_.shows++; 
+    this->blackout_statistics_.blackout_micros += pixels_sent * this->BLACKOUT_MICROS_PER_PIXEL_; 
+  }
 }
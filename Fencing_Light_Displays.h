@@ -4,7 +4,10 @@
 //  Dev     : Nate Cope,                                                     //
 //  Date    : Dec 2022                                                       //
 //  Version : 1.1                                                            //
-//  Notes   :                                                                //
+//  Notes   : - Light changes only go out at commit(), once a loop, so a     //
+//              double hit is one interrupt blackout per ring, not one per   //
+//              call; with the rings chained on one data line, it's one in   //
+//              all                                                          //
 //===========================================================================//
 
 #ifndef FENCING_LIGHT_DISPLAYS_H
@@ -21,7 +24,10 @@ class Fencing_Light_Displays
     // Constructor 
     //    uint8_t left_fencer_light_control_pin   - the Arduino pin attached to the control pin of the left fencer's ring light
     //    uint8_t right_fencer_light_control_pin  - the Arduino pin attached to the control pin of the right fencer's ring light
-    Fencing_Light_Displays(uint8_t left_fencer_light_control_pin, uint8_t right_fencer_light_control_pin);
+    //    bool    rings_chained                   - if true, the right fencer's ring is chained on after the left's (its DIN on the 
+    //                                              left ring's DOUT), so both go out on the left's pin in one show(), and the right's 
+    //                                              pin is left alone 
+    Fencing_Light_Displays(uint8_t left_fencer_light_control_pin, uint8_t right_fencer_light_control_pin, bool rings_chained = false);
 
     // Destructor 
     ~Fencing_Light_Displays();
@@ -43,12 +49,47 @@ class Fencing_Light_Displays
     void set_brightness(uint8_t brightness); 
     void show_off_on_startup();
     void show_off_on_labelle();
+    void flash_alert();
+
+    // tells the lights whether a fencer's in contact or a touch is being decided; while one is, no animation frame is 
+    // drawn or sent, so a show-off can't cost a blackout in the middle of a touch 
+    //    bool pending - true while a contact's pending 
+    void set_contact_pending(bool pending);
+
+    // Sends every light change since the last commit out, one show() per ring that changed (one for both, if 
+    // they're chained); call it once a loop, somewhere it's safe for interrupts to go off for a while 
+    void commit();
+
+    // the interrupt blackouts show() has cost, since construction or the last reset 
+    struct blackout_statistics
+    {
+      unsigned long shows;              // every show(), i.e. every blackout 
+      unsigned long blackout_micros;    // how long interrupts were off for, all told (worked out from the pixels sent) 
+    };
+
+    // Returns a copy of the blackout accounting 
+    blackout_statistics get_blackout_statistics(); 
+
+    // Zeroes the blackout accounting 
+    void reset_blackout_statistics(); 
     
   private:
   
     // the individual light displays 
     Fencing_Light* left_fencer_light_; 
     Fencing_Light* right_fencer_light_; 
+
+    // the strip both rings are on, if they're chained (NULL if not) 
+    Adafruit_NeoPixel* shared_strip_              = NULL; 
+
+    // blackout accounting 
+    blackout_statistics blackout_statistics_      = {0, 0}; 
+
+    // helper method; notes a show() of the given number of pixels, if there was one 
+    void note_blackout(uint16_t pixels_sent); 
+
+    // how long show() keeps interrupts off per pixel: 24 bits at 800kHz 
+    static const unsigned long BLACKOUT_MICROS_PER_PIXEL_ = 30; 
 };
 
 #endif 
@@ -0,0 +1,131 @@
+//============================================================================//
+//  Name    : Fixed_Pin_Transfer.h                                            //
+//  Desc    : C++ Interface and Implementation for sending TM1637             //
+//            transactions on pins fixed at compile time                      //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - digitalWrite() looks the pin up in three tables (port, bit,   //
+//              timer) and turns interrupts off and on again every call; with //
+//              the pins as template parameters, every edge here is one       //
+//              sbi / cbi instead (then a few cycles' wait, so the chip sees  //
+//              it), and every ACK look one sbic                              //
+//            - Same units, in the same order, as Seven_Segment_Transfer,     //
+//              which it stands in for: hand one to                           //
+//              Seven_Segment_Display::use_transfer()                         //
+//            - Pin numbers are the Uno's (ATmega328P): 0-7 are PORTD, 8-13   //
+//              PORTB and 14-19 (A0-A5) PORTC                                 //
+//            - All in the header, since it's a template                      //
+//============================================================================//
+
+#ifndef FIXED_PIN_TRANSFER_H
+#define FIXED_PIN_TRANSFER_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+#include <avr/io.h>
+
+// local includes
+#include "Seven_Segment_Transfer.h"
+
+// A class to send TM1637 transactions a bounded amount at a time, on pins fixed at compile time
+//    CLOCK_PIN - the Arduino pin attached to the CLK pin of the display
+//    DATA_PIN  - the Arduino pin attached to the DATA pin of the display
+template <uint8_t CLOCK_PIN, uint8_t DATA_PIN>
+class Fixed_Pin_Transfer : public Seven_Segment_Transfer
+{
+  static_assert(CLOCK_PIN < 20 && DATA_PIN < 20, "Fixed_Pin_Transfer only knows the Uno's pins");
+
+  public:
+
+    // Constructor
+    Fixed_Pin_Transfer() : Seven_Segment_Transfer(CLOCK_PIN, DATA_PIN)
+    {
+    }
+
+  protected:
+
+    // helper method; sends the "prepare to receive command / data" signal
+    virtual void send_start()
+    {
+      clock_high();
+      data_high();
+      data_low();
+      clock_low();
+    }
+
+    // helper method; sends the next bit of the current byte (LSB first)
+    virtual void send_bit()
+    {
+      clock_low();
+      if (this->current_bit()) data_high();
+      else                     data_low();
+      clock_high();
+
+      // leave the clock low, so nothing another display does on the shared data pin looks like a start or stop to this one
+      clock_low();
+    }
+
+    // helper method; lets the display acknowledge the byte it was just sent, right after its eighth bit (a bounded
+    // few looks, never a wait)
+    virtual void send_ack()
+    {
+      bool acked = false;
+
+      // let go of the data line first (the way pinMode(INPUT) does it: no pullup); the display's already pulling it low
+      data_release();
+      clock_high();
+
+      // look for the display pulling the data line low
+      for (uint8_t i = 0; i < ACK_SAMPLES_ && !acked; i++)
+      {
+        if (data_is_low())
+        {
+          acked = true;
+        }
+        else
+        {
+          this->transaction_.ack_polls++;
+        }
+      }
+
+      if (!acked)
+      {
+        this->transaction_.acknowledged = false;
+      }
+
+      // the display lets go on the ninth falling edge; the line's ours again after that
+      clock_low();
+      data_drive();
+    }
+
+    // helper method; sends the "finish receiving command / data" signal
+    virtual void send_stop()
+    {
+      clock_low();
+      data_low();
+      clock_high();
+      data_high();
+    }
+
+  private:
+
+    // where the pins are
+    static const uint8_t CLOCK_PORT_ = uno_pin_port_io_address(CLOCK_PIN);
+    static const uint8_t CLOCK_MASK_ = 1 << uno_pin_port_bit(CLOCK_PIN);
+    static const uint8_t DATA_PORT_  = uno_pin_port_io_address(DATA_PIN);
+    static const uint8_t DATA_MASK_  = 1 << uno_pin_port_bit(DATA_PIN);
+
+    // helper methods; one instruction each, and then long enough for the chip to see it (see EDGE_HOLD_CYCLES_)
+    static inline void clock_high()   { _SFR_IO8(CLOCK_PORT_)    |=  CLOCK_MASK_; hold(); }
+    static inline void clock_low()    { _SFR_IO8(CLOCK_PORT_)    &= ~CLOCK_MASK_; hold(); }
+    static inline void data_high()    { _SFR_IO8(DATA_PORT_)     |=  DATA_MASK_;  hold(); }
+    static inline void data_low()     { _SFR_IO8(DATA_PORT_)     &= ~DATA_MASK_;  hold(); }
+    static inline void data_release() { _SFR_IO8(DATA_PORT_ - 1) &= ~DATA_MASK_; _SFR_IO8(DATA_PORT_) &= ~DATA_MASK_; hold(); }
+    static inline void data_drive()   { _SFR_IO8(DATA_PORT_ - 1) |=  DATA_MASK_;  hold(); }
+    static inline bool data_is_low()  { return (_SFR_IO8(DATA_PORT_ - 2) & DATA_MASK_) == 0; }
+    static inline void hold()         { __builtin_avr_delay_cycles(EDGE_HOLD_CYCLES_); }
+};
+
+#endif
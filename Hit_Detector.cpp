@@ -0,0 +1,430 @@
+//============================================================================//
+//  Name    : Hit_Detector.cpp                                                //
+//  Desc    : C++ Implementation for the hit detection state machine          //
+//  Dev     : Wnew (base), Nate Cope (updates)                                //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Lifted out of the sketch as it was; see the header for why    //
+//============================================================================//
+
+// interface include
+#include "Hit_Detector.h"
+
+// Constructor
+Hit_Detector::Hit_Detector()
+{
+  this->reset();
+}
+
+
+// which weapon's rules the lines are judged by
+//    uint8_t mode - one of weapon_mode
+void Hit_Detector::set_mode(uint8_t mode)
+{
+  // anything unheard of is saber, same as the mode switch's wraparound
+  this->current_mode_ = (mode < MODE_COUNT_) ? mode : SABER;
+}
+
+uint8_t Hit_Detector::get_mode()
+{
+  return this->current_mode_;
+}
+
+
+// judges the readings taken with the left fencer's weapon powered
+//    unsigned long current_time     - when the readings were taken
+//    bool          left_weapon_high - the left fencer's B (weapon) line
+//    bool          left_lame_high   - the left fencer's A (lame) line
+//    bool          right_lame_high  - the right fencer's A (lame) line
+void Hit_Detector::process_left_phase(unsigned long current_time, bool left_weapon_high, bool left_lame_high, bool right_lame_high)
+{
+  this->left_fencer_b_weapon_line_reading_high_ = left_weapon_high;
+  this->left_fencer_a_lame_line_reading_high_   = left_lame_high;
+  this->right_fencer_a_lame_line_reading_high_  = right_lame_high;
+
+  this->process_hits(current_time, true);
+}
+
+
+// judges the readings taken with the right fencer's weapon powered
+//    unsigned long current_time      - when the readings were taken
+//    bool          right_weapon_high - the right fencer's B (weapon) line
+//    bool          left_lame_high    - the left fencer's A (lame) line
+//    bool          right_lame_high   - the right fencer's A (lame) line
+void Hit_Detector::process_right_phase(unsigned long current_time, bool right_weapon_high, bool left_lame_high, bool right_lame_high)
+{
+  this->right_fencer_b_weapon_line_reading_high_ = right_weapon_high;
+  this->left_fencer_a_lame_line_reading_high_    = left_lame_high;
+  this->right_fencer_a_lame_line_reading_high_   = right_lame_high;
+
+  this->process_hits(current_time, false);
+}
+
+
+// everything one pass of the main loop does to the detection, from a Line_Trace sample
+//    unsigned long current_time - when the sample was taken
+//    uint8_t       lines        - the Line_Trace::LINE_* bits of the sample
+void Hit_Detector::process_line_sample(unsigned long current_time, uint8_t lines)
+{
+  this->process_left_phase (current_time, lines & Line_Trace::LINE_LEFT_PHASE_LEFT_WEAPON_,
+                                          lines & Line_Trace::LINE_LEFT_PHASE_LEFT_LAME_,
+                                          lines & Line_Trace::LINE_LEFT_PHASE_RIGHT_LAME_);
+  this->process_right_phase(current_time, lines & Line_Trace::LINE_RIGHT_PHASE_RIGHT_WEAPON_,
+                                          lines & Line_Trace::LINE_RIGHT_PHASE_LEFT_LAME_,
+                                          lines & Line_Trace::LINE_RIGHT_PHASE_RIGHT_LAME_);
+  this->end_touch_if_over(current_time);
+}
+
+
+// ends the touch once the lights have been on long enough; returns true if it just did
+//    unsigned long current_time - the time now
+bool Hit_Detector::end_touch_if_over(unsigned long current_time)
+{
+  // NB: we assume here that the light duration will be longer than the buzzer duration
+  if (this->locked_out_ && (uint32_t)(current_time - this->time_of_lockout_) > this->light_duration_micros_)
+  {
+    this->reset_touch();
+    return true;
+  }
+
+  return false;
+}
+
+
+// forgets the touch in progress, ready for the next point
+void Hit_Detector::reset_touch()
+{
+  this->locked_out_                           = false;
+
+  this->right_fencer_hit_on_target_           = false;
+  this->right_fencer_hit_off_target_          = false;
+  this->left_fencer_hit_on_target_            = false;
+  this->left_fencer_hit_off_target_           = false;
+
+  this->left_fencer_time_of_registered_hit_   = 0;
+  this->right_fencer_time_of_registered_hit_  = 0;
+
+  this->time_of_lockout_                      = 0;
+
+  // the next hit starts a fresh latency measurement (no-op unless DEBUG 3)
+  Latency_Probe::end_touch();
+}
+
+
+// forgets everything about the lines and any touch in progress
+void Hit_Detector::reset()
+{
+  this->left_fencer_b_weapon_line_reading_high_  = false;
+  this->right_fencer_b_weapon_line_reading_high_ = false;
+  this->left_fencer_a_lame_line_reading_high_    = false;
+  this->right_fencer_a_lame_line_reading_high_   = false;
+
+  this->left_fencer_contact_made_                = false;
+  this->right_fencer_contact_made_               = false;
+  this->left_fencer_contact_start_time_          = 0;
+  this->right_fencer_contact_start_time_         = 0;
+
+  this->reset_touch();
+}
+
+
+// Hopefully all self-explanatory
+bool Hit_Detector::is_left_hit_on_target()   { return this->left_fencer_hit_on_target_;   }
+bool Hit_Detector::is_left_hit_off_target()  { return this->left_fencer_hit_off_target_;  }
+bool Hit_Detector::is_right_hit_on_target()  { return this->right_fencer_hit_on_target_;  }
+bool Hit_Detector::is_right_hit_off_target() { return this->right_fencer_hit_off_target_; }
+bool Hit_Detector::has_left_hit()            { return this->left_fencer_hit_on_target_  || this->left_fencer_hit_off_target_;  }
+bool Hit_Detector::has_right_hit()           { return this->right_fencer_hit_on_target_ || this->right_fencer_hit_off_target_; }
+bool Hit_Detector::is_locked_out()           { return this->locked_out_; }
+
+
+// all of the above, packed into DECISION_* bits
+uint8_t Hit_Detector::get_decision()
+{
+  return (this->left_fencer_hit_on_target_   ? DECISION_LEFT_ON_TARGET_   : 0) |
+         (this->left_fencer_hit_off_target_  ? DECISION_LEFT_OFF_TARGET_  : 0) |
+         (this->right_fencer_hit_on_target_  ? DECISION_RIGHT_ON_TARGET_  : 0) |
+         (this->right_fencer_hit_off_target_ ? DECISION_RIGHT_OFF_TARGET_ : 0) |
+         (this->locked_out_                  ? DECISION_LOCKED_OUT_       : 0);
+}
+
+
+// when the hits and the lockout happened
+unsigned long Hit_Detector::get_left_hit_micros()  { return this->left_fencer_time_of_registered_hit_;  }
+unsigned long Hit_Detector::get_right_hit_micros() { return this->right_fencer_time_of_registered_hit_; }
+unsigned long Hit_Detector::get_lockout_micros()   { return this->time_of_lockout_; }
+
+
+// whether each fencer's in contact right now
+bool Hit_Detector::is_left_contact_made()  { return this->left_fencer_contact_made_;  }
+bool Hit_Detector::is_right_contact_made() { return this->right_fencer_contact_made_; }
+
+
+// whether a touch is in progress that nothing should get in the way of
+bool Hit_Detector::is_contact_pending()
+{
+  return this->left_fencer_contact_made_   || this->right_fencer_contact_made_  ||
+         this->left_fencer_hit_on_target_  || this->left_fencer_hit_off_target_ ||
+         this->right_fencer_hit_on_target_ || this->right_fencer_hit_off_target_;
+}
+
+
+// the timing in force
+//    uint8_t       mode   - one of weapon_mode
+//    unsigned long micros - the new time
+void Hit_Detector::set_contact_micros(uint8_t mode, unsigned long micros)
+{
+  if (mode < MODE_COUNT_) this->contact_micros_by_mode_[mode] = micros;
+}
+
+void Hit_Detector::set_lockout_micros(uint8_t mode, unsigned long micros)
+{
+  if (mode < MODE_COUNT_) this->lockout_micros_by_mode_[mode] = micros;
+}
+
+void Hit_Detector::set_light_duration_micros(unsigned long micros)
+{
+  this->light_duration_micros_ = micros;
+}
+
+unsigned long Hit_Detector::get_contact_micros(uint8_t mode)
+{
+  return (mode < MODE_COUNT_) ? this->contact_micros_by_mode_[mode] : 0;
+}
+
+unsigned long Hit_Detector::get_lockout_micros(uint8_t mode)
+{
+  return (mode < MODE_COUNT_) ? this->lockout_micros_by_mode_[mode] : 0;
+}
+
+unsigned long Hit_Detector::get_light_duration_micros()
+{
+  return this->light_duration_micros_;
+}
+
+
+//
+//  private methods
+//
+
+//=================================================================================================================
+// process_hits - determines hit, lockout, and timeout statuses based on current equipment inputs and current mode
+//    parameter:  current_time - the time in microseconds passed since the last processing
+//    output:   none
+//================================================================================================================
+void Hit_Detector::process_hits(unsigned long current_time, bool left_fencer_weapon_powered)
+{
+  // first, check for hits!
+
+  // check the left fencer's circuit if it's the one currently live
+  if (left_fencer_weapon_powered)
+  {
+    // if the left fencer already has a hit, no need to confirm it again
+    if ((!this->locked_out_) && !(this->left_fencer_hit_on_target_ || this->left_fencer_hit_off_target_) )
+    {
+      // if the left fencer's registering a hit, then add that time to their tally (or start the tally if they weren't already hitting) NB: these methods account for mode already
+      if (
+           this->is_reading_on_target (this->left_fencer_b_weapon_line_reading_high_, this->right_fencer_a_lame_line_reading_high_, this->left_fencer_a_lame_line_reading_high_)   ||
+           this->is_reading_off_target(this->left_fencer_b_weapon_line_reading_high_, this->right_fencer_a_lame_line_reading_high_, this->left_fencer_a_lame_line_reading_high_)
+         )
+      {
+        if (!this->left_fencer_contact_made_)
+        {
+          // note the contact
+          this->left_fencer_contact_made_ = true;
+
+          // record when the contact started
+          this->left_fencer_contact_start_time_ = current_time;
+
+          // scope / stats marker for the start of the hit pipeline (no-op unless DEBUG 3)
+          Latency_Probe::mark(Latency_Probe::LINE_EDGE);
+        }
+      }
+      else
+      {
+        // if there's no contact, then reset the counters
+        this->left_fencer_contact_made_       = false;
+        this->left_fencer_contact_start_time_ = 0;
+      }
+
+      // if the left fencer is in contact and has exceeded the necessary contact time, mark a hit
+      // TODO NB: there's a weird situation where foil can start on-target and slide to off-target and the on-target depressed time counts. Is that right?
+      if ( this->left_fencer_contact_made_ &&
+           ((uint32_t)(current_time - this->left_fencer_contact_start_time_) > this->contact_micros_by_mode_[this->current_mode_]) )
+      {
+        // if you're foil, you gotta check if you're off target (NB: the method accounts for mode)
+        if (this->is_reading_off_target(this->left_fencer_b_weapon_line_reading_high_, this->right_fencer_a_lame_line_reading_high_, this->left_fencer_a_lame_line_reading_high_))
+        {
+          this->left_fencer_hit_off_target_          = true;
+          this->left_fencer_time_of_registered_hit_  = current_time;
+        }
+        // every other weapon can only get here by being on-target, as off-targets don't exist TODO TODO still check on target as an error checking measure???
+        else
+        {
+          this->left_fencer_hit_on_target_           = true;
+          this->left_fencer_time_of_registered_hit_  = current_time;
+        }
+
+        // scope / stats marker for the hit (no-op unless DEBUG 3)
+        Latency_Probe::mark_hit_qualified(this->left_fencer_contact_start_time_);
+      } // end if just got a valid hit
+    } // end if not locked out or if already has a hit registered
+  } // end if the left fencer weapon is the one that's powered
+
+  // check the right fencer's circuit if it's the one currently live
+  else // i.e., the left fencer's circuit isn't the one that's on right now
+  {
+    // if the right fencer already has a hit, no need to confirm it again
+    if ((!this->locked_out_) && !(this->right_fencer_hit_on_target_ || this->right_fencer_hit_off_target_) )
+    {
+      // if the right fencer's registering a hit, then add that time to their tally (or start the tally if they weren't already hitting) NB: these methods account for mode already
+      if (
+           this->is_reading_on_target (this->right_fencer_b_weapon_line_reading_high_, this->left_fencer_a_lame_line_reading_high_, this->right_fencer_a_lame_line_reading_high_)   ||
+           this->is_reading_off_target(this->right_fencer_b_weapon_line_reading_high_, this->left_fencer_a_lame_line_reading_high_, this->right_fencer_a_lame_line_reading_high_)
+         )
+      {
+        if (!this->right_fencer_contact_made_)
+        {
+          // note the contact
+          this->right_fencer_contact_made_ = true;
+
+          // record when the contact started
+          this->right_fencer_contact_start_time_ = current_time;
+
+          // scope / stats marker for the start of the hit pipeline (no-op unless DEBUG 3)
+          Latency_Probe::mark(Latency_Probe::LINE_EDGE);
+        }
+      }
+      else
+      {
+        // if there's no contact, then reset the counters
+        this->right_fencer_contact_made_       = false;
+        this->right_fencer_contact_start_time_ = 0;
+      }
+
+      // if the right fencer is in contact and has exceeded the necessary contact time, mark a hit
+      // TODO NB: there's a weird situation where foil can start on-target and slide to off-target and the on-target depressed time counts. Is that right?
+      if ( this->right_fencer_contact_made_ &&
+           ((uint32_t)(current_time - this->right_fencer_contact_start_time_) > this->contact_micros_by_mode_[this->current_mode_]) )
+      {
+        // if you're foil, you gotta check if you're off target (NB: the method accounts for mode)
+        if (this->is_reading_off_target(this->right_fencer_b_weapon_line_reading_high_, this->left_fencer_a_lame_line_reading_high_, this->right_fencer_a_lame_line_reading_high_))
+        {
+          this->right_fencer_hit_off_target_         = true;
+          this->right_fencer_time_of_registered_hit_ = current_time;
+        }
+        // every other weapon can only get here by being on-target, as off-targets don't exist TODO TODO still check on target as an error checking measure???
+        else
+        {
+          this->right_fencer_hit_on_target_          = true;
+          this->right_fencer_time_of_registered_hit_ = current_time;
+        }
+
+        // scope / stats marker for the hit (no-op unless DEBUG 3)
+        Latency_Probe::mark_hit_qualified(this->right_fencer_contact_start_time_);
+      } // end if just got a valid hit
+    } // end if not locked out or if already has a hit registered
+  } // end if the right fencer weapon is the one that's powered
+
+
+  // now, check for lockouts!
+
+  // if we're already locked out, no need to check for lockout again TODO TODO don't think I need check for which circuit is powered here?
+  if (!this->locked_out_)
+  {
+    // if the left fencer has a valid hit and has had enough time pass since they confirmed it (according to their weapon), lock out
+    if ( ( this->left_fencer_hit_on_target_ || this->left_fencer_hit_off_target_ ) &&
+         ((uint32_t)(current_time - this->left_fencer_time_of_registered_hit_) > this->lockout_micros_by_mode_[this->current_mode_]) )
+    {
+      this->locked_out_      = true;
+      this->time_of_lockout_ = current_time;
+      Latency_Probe::mark(Latency_Probe::LOCKOUT);  // no-op unless DEBUG 3
+    }
+
+    // if the right fencer has a valid hit and has had enough time pass since they confirmed it (according to their weapon), lock out
+    if ( ( this->right_fencer_hit_on_target_ || this->right_fencer_hit_off_target_ ) &&
+         ((uint32_t)(current_time - this->right_fencer_time_of_registered_hit_) > this->lockout_micros_by_mode_[this->current_mode_]) )
+    {
+      this->locked_out_      = true;
+      this->time_of_lockout_ = current_time;
+      Latency_Probe::mark(Latency_Probe::LOCKOUT);  // no-op unless DEBUG 3
+    }
+  }
+}
+
+
+//==============================================================================================================================
+// TODO TODO REDO COMMENTS
+// TODO note that order of the lames doesn't matter at all
+// is_reading_off_target - determines whether the provided analog values constitute an off-target contact
+//    parameter:  unsigned long fencer_A_weapon_prong - the analog read value of one fencer's weapon line
+//    parameter:  unsigned long fencer_B_weapon_prong - the analog read value of the other fencer's one fencer's weapon line
+//    output:   bool, true if off-target contact is made, false otherwise
+//==============================================================================================================================
+bool Hit_Detector::is_reading_off_target(bool fencer_A_weapon_high, bool fencer_B_lame_high, bool fencer_A_lame_high)
+{
+  bool result = false;
+
+  if (this->current_mode_ == FOIL) // "off-target" is meaningless outside of foil
+  {
+    // you're hitting something, but it's not a lame!
+    result = fencer_A_weapon_high && !(fencer_A_lame_high || fencer_B_lame_high);
+  }
+
+  return result;
+}
+
+
+//==============================================================================================================================
+// TODO REDO REDO TODO
+// is_reading_on_target - determines whether the provided analog values constitute an on-target contact
+//    parameter:  fencer_A_weapon_prong - the analog read value of one fencer's weapon line
+//    parameter:  fencer_B_weapon_prong - the analog read value of the other fencer's one fencer's weapon line
+//    output:   true if on-target contact is made, false otherwise
+//==============================================================================================================================
+bool Hit_Detector::is_reading_on_target(bool fencer_A_weapon_high, bool fencer_B_lame_high, bool fencer_A_lame_high)
+{
+  bool result = false;
+
+  if      (this->current_mode_ == SABER)
+  {
+    result = fencer_B_lame_high;                              // in saber, it suffices just to check the target lame! Own weapon won't change, how we're wiring it
+  }
+  else if (this->current_mode_ == FOIL)
+  {
+    result = (fencer_A_weapon_high && fencer_B_lame_high);    // in foil, the A and target B lines (weapon and opponent lame) are joined on a hit, and
+  }                                                           // the A line is also severed from the C line (weapon from own ground) allowing electricity to flow elsewhere
+  else if (this->current_mode_ == EPEE)
+  {
+    result = (fencer_A_weapon_high && fencer_A_lame_high);    // in epee, the A and B lines (weapon and own lame) are joined on a hit
+  }
+
+  return result;
+}
+
+//==============================================================================================================================
+// TODO REDO REDO TODO ALL NEW
+// is_reading_short_circuit - determines whether the provided analog values constitute a short circuit
+//    parameter:  fencer_A_weapon_prong - the analog read value of one fencer's weapon line
+//    parameter:  fencer_B_weapon_prong - the analog read value of the other fencer's one fencer's weapon line
+//    output:   true if a short circuit is made, false otherwise
+//==============================================================================================================================
+bool Hit_Detector::is_reading_short_circuit(bool fencer_A_weapon_high, bool fencer_B_lame_high, bool fencer_A_lame_high)
+{
+  bool result = false;
+
+  if      (this->current_mode_ == SABER)
+  {
+    result = fencer_A_lame_high;                              // in saber, it suffices just to check the own lame! Own weapon won't change, how we're wiring it
+  }
+  else if (this->current_mode_ == FOIL)
+  {
+    result = (fencer_A_weapon_high && fencer_A_lame_high);    // in foil, the A and B lines (weapon and own lame) are joined on a self-hit, and
+  }                                                           // the A line is also severed from the C line (weapon from own ground) allowing electricity to flow elsewhere
+  else if (this->current_mode_ == EPEE)
+  {
+    result = false;                                           // this is just possible in epee. Try not to hit yourself!
+  }
+
+  return result;
+}
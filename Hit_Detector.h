@@ -0,0 +1,190 @@
+//============================================================================//
+//  Name    : Hit_Detector.h                                                  //
+//  Desc    : C++ Interface for the hit detection state machine: contacts,    //
+//            hits, lockout and the end of a touch, judged from the weapon    //
+//            line readings                                                   //
+//  Dev     : Wnew (base), Nate Cope (updates)                                //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - What used to be process_hits() and friends in the sketch,     //
+//              with the state they kept in globals moved in here, so the     //
+//              very same detection can be run (and timed, and replayed       //
+//              against, many at once) off the box                            //
+//            - Knows nothing about pins, lights or buzzers: the sketch reads //
+//              the lines and hands the readings over, then signals whatever  //
+//              this says happened                                            //
+//            - Elapsed times are worked out as uint32_t, which is what       //
+//              unsigned long is on the AVR, so they wrap along with micros() //
+//              on a 64-bit host build too                                    //
+//            - Modes match the sketch's mode enum (0 SABER, 1 FOIL, 2 EPEE), //
+//              and line bits are Line_Trace's                                //
+//============================================================================//
+
+#ifndef HIT_DETECTOR_H
+#define HIT_DETECTOR_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+
+// local includes
+#include "Line_Trace.h"
+#include "Latency_Probe.h"
+
+// A class to work out hits and lockouts from the weapon lines
+class Hit_Detector
+{
+  public:
+
+    // the weapon modes, in the same order as the sketch's mode enum
+    enum weapon_mode
+    {
+      SABER,
+      FOIL,
+      EPEE,
+      MODE_COUNT_
+    };
+
+    // Lockout & Depress Times
+    // the lockout time between hits for foil is 300ms +/-25ms
+    // the minimum amount of time the tip needs to be depressed for foil 14ms +/-1ms
+    // the lockout time between hits for epee is 45ms +/-5ms
+    // the minimum amount of time the tip needs to be depressed for epee 2ms
+    // the lockout time between hits for sabre is 170ms +/-10ms
+    // the minimum amount of time blade needs to be in contact for sabre 0.1ms <-> 1ms
+    // These values are stored as micro seconds for more accuracy
+    // we use the minimum times for contact so that we have the most edge on any processing lag,
+    // we use the middle times for lockout to balance post-hit processing lag (lights) with pre-hit processing lag
+    static const unsigned long SABER_LOCKOUT_MICROS_  = 170000;
+    static const unsigned long FOIL_LOCKOUT_MICROS_   = 300000;
+    static const unsigned long EPEE_LOCKOUT_MICROS_   = 45000;
+    static const unsigned long SABER_CONTACT_MICROS_  = 100;
+    static const unsigned long FOIL_CONTACT_MICROS_   = 13000;
+    static const unsigned long EPEE_CONTACT_MICROS_   = 2000;
+
+    // length of time the lights are kept on after a hit (microseconds), i.e. how long a touch lasts
+    static const unsigned long LIGHT_DURATION_MICROS_ = 3000000;
+
+    // the bits of get_decision()
+    static const uint8_t DECISION_LEFT_ON_TARGET_   = 0x01;
+    static const uint8_t DECISION_LEFT_OFF_TARGET_  = 0x02;
+    static const uint8_t DECISION_RIGHT_ON_TARGET_  = 0x04;
+    static const uint8_t DECISION_RIGHT_OFF_TARGET_ = 0x08;
+    static const uint8_t DECISION_LOCKED_OUT_       = 0x10;
+
+    // Constructor
+    Hit_Detector();
+
+    // which weapon's rules the lines are judged by
+    //    uint8_t mode - one of weapon_mode
+    void    set_mode(uint8_t mode);
+    uint8_t get_mode();
+
+    // judges the readings taken with the left fencer's weapon powered (once per pass, before the right's)
+    //    unsigned long current_time     - when the readings were taken
+    //    bool          left_weapon_high - the left fencer's B (weapon) line
+    //    bool          left_lame_high   - the left fencer's A (lame) line
+    //    bool          right_lame_high  - the right fencer's A (lame) line
+    void process_left_phase(unsigned long current_time, bool left_weapon_high, bool left_lame_high, bool right_lame_high);
+
+    // judges the readings taken with the right fencer's weapon powered
+    //    unsigned long current_time      - when the readings were taken
+    //    bool          right_weapon_high - the right fencer's B (weapon) line
+    //    bool          left_lame_high    - the left fencer's A (lame) line
+    //    bool          right_lame_high   - the right fencer's A (lame) line
+    void process_right_phase(unsigned long current_time, bool right_weapon_high, bool left_lame_high, bool right_lame_high);
+
+    // everything one pass of the main loop does to the detection, from a Line_Trace sample: both phases, then the
+    // end of the touch if it's over
+    //    unsigned long current_time - when the sample was taken
+    //    uint8_t       lines        - the Line_Trace::LINE_* bits of the sample
+    void process_line_sample(unsigned long current_time, uint8_t lines);
+
+    // ends the touch (forgetting its hits and lockout) once the lights have been on long enough; returns true if
+    // it just did
+    //    unsigned long current_time - the time now
+    bool end_touch_if_over(unsigned long current_time);
+
+    // forgets the touch in progress, ready for the next point (what reset_values() used to do)
+    void reset_touch();
+
+    // forgets everything about the lines and any touch in progress, as if the box had just been switched on
+    void reset();
+
+    // what's been decided so far this touch
+    bool is_left_hit_on_target();
+    bool is_left_hit_off_target();
+    bool is_right_hit_on_target();
+    bool is_right_hit_off_target();
+    bool has_left_hit();
+    bool has_right_hit();
+    bool is_locked_out();
+
+    // all of the above, packed into DECISION_* bits (handy for spotting a change, or printing one)
+    uint8_t get_decision();
+
+    // when the hits and the lockout happened (only meaningful once they have)
+    unsigned long get_left_hit_micros();
+    unsigned long get_right_hit_micros();
+    unsigned long get_lockout_micros();
+
+    // whether each fencer's in contact right now
+    bool is_left_contact_made();
+    bool is_right_contact_made();
+
+    // whether a fencer's in contact or a hit's waiting on the lockout (or the lights), i.e. whether a touch is in
+    // progress that nothing should get in the way of
+    bool is_contact_pending();
+
+    // the timing in force; the constants above to start with, but anything can be tried (e.g. a timing sweep)
+    //    uint8_t       mode   - one of weapon_mode
+    //    unsigned long micros - the new time
+    void          set_contact_micros(uint8_t mode, unsigned long micros);
+    void          set_lockout_micros(uint8_t mode, unsigned long micros);
+    void          set_light_duration_micros(unsigned long micros);
+    unsigned long get_contact_micros(uint8_t mode);
+    unsigned long get_lockout_micros(uint8_t mode);
+    unsigned long get_light_duration_micros();
+
+  private:
+
+    // helper method; the contact, hit and lockout checks for whichever fencer's weapon is powered
+    //    unsigned long current_time               - when the readings were taken
+    //    bool          left_fencer_weapon_powered - which phase this is
+    void process_hits(unsigned long current_time, bool left_fencer_weapon_powered);
+
+    // helper methods; what one fencer's readings amount to under the current mode
+    bool is_reading_off_target   (bool fencer_A_weapon_high, bool fencer_B_lame_high, bool fencer_A_lame_high);
+    bool is_reading_on_target    (bool fencer_A_weapon_high, bool fencer_B_lame_high, bool fencer_A_lame_high);
+    bool is_reading_short_circuit(bool fencer_A_weapon_high, bool fencer_B_lame_high, bool fencer_A_lame_high);
+
+    // main hit interpretation mode
+    uint8_t       current_mode_                           = SABER;
+
+    // weapon line statuses
+    bool          left_fencer_b_weapon_line_reading_high_  = false;
+    bool          right_fencer_b_weapon_line_reading_high_ = false;
+    bool          left_fencer_a_lame_line_reading_high_    = false;
+    bool          right_fencer_a_lame_line_reading_high_   = false;
+
+    // hit interpretation variables
+    unsigned long left_fencer_contact_start_time_         = 0;
+    unsigned long right_fencer_contact_start_time_        = 0;
+    bool          locked_out_                             = false;
+    unsigned long left_fencer_time_of_registered_hit_     = 0;
+    unsigned long right_fencer_time_of_registered_hit_    = 0;
+    unsigned long time_of_lockout_                        = 0;
+    bool          left_fencer_contact_made_               = false;
+    bool          right_fencer_contact_made_              = false;
+    bool          left_fencer_hit_on_target_              = false;
+    bool          left_fencer_hit_off_target_             = false;
+    bool          right_fencer_hit_on_target_             = false;
+    bool          right_fencer_hit_off_target_            = false;
+
+    // hit timing in force, indexed by mode
+    unsigned long contact_micros_by_mode_ [MODE_COUNT_]   = { SABER_CONTACT_MICROS_, FOIL_CONTACT_MICROS_, EPEE_CONTACT_MICROS_ };
+    unsigned long lockout_micros_by_mode_ [MODE_COUNT_]   = { SABER_LOCKOUT_MICROS_, FOIL_LOCKOUT_MICROS_, EPEE_LOCKOUT_MICROS_ };
+    unsigned long light_duration_micros_                  = LIGHT_DURATION_MICROS_;
+};
+
+#endif
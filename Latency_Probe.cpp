@@ -0,0 +1,143 @@
+//============================================================================//
+//  Name    : Latency_Probe.cpp                                               //
+//  Desc    : C++ Implementation for a measurement probe along the            //
+//            hit-to-light pipeline                                           //
+//  Dev     : Nate Cope,                                                      //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - See the header for how the stages and origin work             //
+//============================================================================//
+
+// interface include
+#include "Latency_Probe.h"
+
+// static data member definitions
+bool              Latency_Probe::enabled_       = false;
+uint8_t           Latency_Probe::probe_pin_     = 0;
+uint8_t           Latency_Probe::probe_level_   = LOW;
+bool              Latency_Probe::origin_set_    = false;
+unsigned long     Latency_Probe::origin_micros_ = 0;
+Timing_Statistics Latency_Probe::stage_statistics_[Latency_Probe::STAGE_COUNT];
+unsigned long     Latency_Probe::qualified_micros_ = 0;
+bool              Latency_Probe::awaiting_show_    = false;
+Timing_Statistics Latency_Probe::qualified_to_show_statistics_;
+
+
+// switch the probe on and take over the given pin as its output
+//    uint8_t probe_pin - a spare Arduino pin to toggle on every mark
+void Latency_Probe::begin(uint8_t probe_pin)
+{
+  probe_pin_   = probe_pin;
+  probe_level_ = LOW;
+
+  pinMode(probe_pin_, OUTPUT);
+  digitalWrite(probe_pin_, probe_level_);
+
+  reset_statistics();
+  enabled_ = true;
+}
+
+
+// note that a stage has been reached; latencies are measured from the start of the contact
+// that produced the first hit of the current touch
+//    stage pipeline_stage - which stage was just reached
+void Latency_Probe::mark(stage pipeline_stage)
+{
+  // free (well, nearly) when nobody's measuring
+  if (!enabled_) return;
+
+  toggle_probe_pin();
+
+  // a line edge IS the start of a contact, so there's nothing to measure yet; just count it
+  if (pipeline_stage == LINE_EDGE)
+  {
+    stage_statistics_[LINE_EDGE].add_sample(0);
+  }
+  // anything later is only meaningful as part of a touch
+  else if (origin_set_)
+  {
+    unsigned long now = micros();
+    stage_statistics_[pipeline_stage].add_sample((unsigned long)(now - origin_micros_));
+
+    // the first frame out after the hit counted
+    if (pipeline_stage == SHOW_BEGIN && awaiting_show_)
+    {
+      qualified_to_show_statistics_.add_sample((unsigned long)(now - qualified_micros_));
+      awaiting_show_ = false;
+    }
+  }
+}
+
+
+// note that a contact just qualified as a hit; the first one in a touch becomes the origin
+//    unsigned long contact_start_micros - when the qualifying contact was first seen
+void Latency_Probe::mark_hit_qualified(unsigned long contact_start_micros)
+{
+  if (!enabled_) return;
+
+  // the first hit of a touch is the one the lights and buzzer are racing to show
+  unsigned long now = micros();
+  if (!origin_set_)
+  {
+    origin_set_       = true;
+    origin_micros_    = contact_start_micros;
+    qualified_micros_ = now;
+    awaiting_show_    = true;
+  }
+
+  // measure this hit from its own contact start (it includes the required contact time, on purpose)
+  toggle_probe_pin();
+  stage_statistics_[HIT_QUALIFIED].add_sample((unsigned long)(now - contact_start_micros));
+}
+
+
+// note that the current touch is over, so the next hit starts a fresh measurement
+void Latency_Probe::end_touch()
+{
+  // (nothing to forget when nobody's measuring; this way a Hit_Detector can run without touching the probe at all)
+  if (!enabled_) return;
+
+  origin_set_    = false;
+  awaiting_show_ = false;
+}
+
+
+// print the statistics for every stage over Serial; Serial must already be started
+void Latency_Probe::print_report()
+{
+  if (!enabled_) return;
+
+  Serial.println("Latency from contact start, per stage:");
+  stage_statistics_[LINE_EDGE    ].print("  line edge    ");
+  stage_statistics_[HIT_QUALIFIED].print("  hit qualified");
+  stage_statistics_[LOCKOUT      ].print("  lockout      ");
+  stage_statistics_[SHOW_BEGIN   ].print("  show() begin ");
+  stage_statistics_[SHOW_END     ].print("  show() end   ");
+  stage_statistics_[BUZZER_START ].print("  buzzer start ");
+
+  Serial.println("Latency from the first hit qualifying to the lights starting to go out:");
+  qualified_to_show_statistics_   .print("  show() begin ");
+}
+
+
+// forget all the statistics gathered so far
+void Latency_Probe::reset_statistics()
+{
+  for (uint8_t i = 0; i < STAGE_COUNT; i++)
+  {
+    stage_statistics_[i].reset();
+  }
+  qualified_to_show_statistics_.reset();
+}
+
+
+//
+//  private methods
+//
+
+// helper method; flips the probe pin so every mark shows up as an edge on a scope
+void Latency_Probe::toggle_probe_pin()
+{
+  probe_level_ = (probe_level_ == LOW) ? HIGH : LOW;
+  digitalWrite(probe_pin_, probe_level_);
+}
@@ -0,0 +1,99 @@
+//============================================================================//
+//  Name    : Latency_Probe.h                                                 //
+//  Desc    : C++ Interface for a measurement probe along the hit-to-light    //
+//            pipeline (line edge -> hit -> lockout -> show() -> buzzer)      //
+//  Dev     : Nate Cope,                                                      //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Everything is static so that the components at the end of     //
+//              the pipeline (lights, buzzer) can mark their stages without   //
+//              having to be handed a probe object                            //
+//            - Does nothing at all until begin() is called, so the marks     //
+//              can stay in the normal code paths                             //
+//            - Each mark toggles the probe pin, so a scope on the probe pin  //
+//              and a weapon line shows the real physical latency, and each   //
+//              mark also records micros since the start of the contact that  //
+//              produced the touch, so the box can report it on its own       //
+//            - This is the one place that reads the time itself instead of   //
+//              being ticked; that's the whole point of it                    //
+//            - host/latency_report runs the sketch with the probe on against //
+//              the simulated Uno, and times the same stages from outside     //
+//============================================================================//
+
+#ifndef LATENCY_PROBE_H
+#define LATENCY_PROBE_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+
+// local includes
+#include "Timing_Statistics.h"
+
+// A static class to mark and time the stages between a fencer's contact and the box reacting to it
+class Latency_Probe
+{
+  public:
+
+    // the stages of the hit pipeline we can mark, in the order they normally happen
+    enum stage
+    {
+      LINE_EDGE,      // a contact was first seen on a weapon line
+      HIT_QUALIFIED,  // a contact lasted long enough to count as a hit
+      LOCKOUT,        // the lockout window closed
+      SHOW_BEGIN,     // a ring light started pushing a new frame out
+      SHOW_END,       // a ring light finished pushing a new frame out
+      BUZZER_START,   // the buzzer was told to sound for a touch
+      STAGE_COUNT     // not a stage; just how many there are
+    };
+
+    // switch the probe on and take over the given pin as its output
+    //    uint8_t probe_pin - a spare Arduino pin to toggle on every mark
+    static void begin(uint8_t probe_pin);
+
+    // note that a stage has been reached; latencies are measured from the start of the contact
+    // that produced the first hit of the current touch (see mark_hit_qualified())
+    //    stage pipeline_stage - which stage was just reached
+    static void mark(stage pipeline_stage);
+
+    // note that a contact just qualified as a hit; the first one in a touch becomes the origin
+    // every later stage of that touch is measured from
+    //    unsigned long contact_start_micros - when the qualifying contact was first seen
+    static void mark_hit_qualified(unsigned long contact_start_micros);
+
+    // note that the current touch is over, so the next hit starts a fresh measurement
+    static void end_touch();
+
+    // print the statistics for every stage over Serial; Serial must already be started
+    static void print_report();
+
+    // forget all the statistics gathered so far
+    static void reset_statistics();
+
+  private:
+
+    // whether begin() has been called
+    static bool          enabled_;
+
+    // the pin we toggle, and what we last set it to
+    static uint8_t       probe_pin_;
+    static uint8_t       probe_level_;
+
+    // the start of the contact that produced the first hit of the current touch
+    static bool          origin_set_;
+    static unsigned long origin_micros_;
+
+    // the latency statistics for every stage
+    static Timing_Statistics stage_statistics_[STAGE_COUNT];
+
+    // when the first hit of the current touch qualified, whether the lights have started going out for it yet, and
+    // how long they took to, i.e. what's between deciding there's a hit and showing it
+    static unsigned long     qualified_micros_;
+    static bool              awaiting_show_;
+    static Timing_Statistics qualified_to_show_statistics_;
+
+    // helper method; flips the probe pin so every mark shows up as an edge on a scope
+    static void toggle_probe_pin();
+};
+
+#endif
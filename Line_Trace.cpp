@@ -0,0 +1,214 @@
+//============================================================================//
+//  Name    : Line_Trace.cpp                                                  //
+//  Desc    : C++ Implementation for recording and replaying weapon line      //
+//            activity as a compact binary trace                              //
+//  Dev     : Nate Cope,                                                      //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - See the header for the trace format                           //
+//============================================================================//
+
+// interface include
+#include "Line_Trace.h"
+
+// the four bytes every trace starts with
+static const uint8_t TRACE_MAGIC[4] = { 'F', 'B', 'T', '1' };
+
+
+// Constructor
+//    Stream* stream - where the trace is written to or read from (usually &Serial)
+Line_Trace::Line_Trace(Stream* stream)
+{
+  this->stream_ = stream;
+}
+
+
+// Constructor, for replaying a whole trace that's already in memory
+//    const uint8_t* bytes  - the trace, header first
+//    unsigned long  length - how many bytes of it there are
+Line_Trace::Line_Trace(const uint8_t* bytes, unsigned long length)
+{
+  this->bytes_    = bytes;
+  this->length_   = length;
+  this->position_ = 0;
+}
+
+
+// pack the readings taken with the left fencer's weapon powered into line bits
+uint8_t Line_Trace::encode_left_phase(bool left_weapon_high, bool left_lame_high, bool right_lame_high)
+{
+  return (left_weapon_high ? LINE_LEFT_PHASE_LEFT_WEAPON_ : 0) |
+         (left_lame_high   ? LINE_LEFT_PHASE_LEFT_LAME_   : 0) |
+         (right_lame_high  ? LINE_LEFT_PHASE_RIGHT_LAME_  : 0);
+}
+
+
+// pack the readings taken with the right fencer's weapon powered into line bits
+uint8_t Line_Trace::encode_right_phase(bool right_weapon_high, bool left_lame_high, bool right_lame_high)
+{
+  return (right_weapon_high ? LINE_RIGHT_PHASE_RIGHT_WEAPON_ : 0) |
+         (left_lame_high    ? LINE_RIGHT_PHASE_LEFT_LAME_    : 0) |
+         (right_lame_high   ? LINE_RIGHT_PHASE_RIGHT_LAME_   : 0);
+}
+
+
+// write the header and start recording
+//    unsigned long start_micros         - the time of the first sample
+//    uint16_t      sample_period_micros - how often the recording box samples the lines, roughly
+void Line_Trace::begin_recording(unsigned long start_micros, uint16_t sample_period_micros)
+{
+  this->start_micros_         = start_micros;
+  this->sample_period_micros_ = sample_period_micros;
+  this->last_record_micros_   = start_micros;
+  this->last_lines_           = 0;
+  this->last_mode_            = 0;
+
+  this->stream_->write(TRACE_MAGIC, sizeof(TRACE_MAGIC));
+  this->write_uint32(start_micros);
+  this->write_uint16(sample_period_micros);
+  this->write_uint16(0);    // reserved
+}
+
+
+// note one sample of the lines; only actually writes anything if something changed
+//    unsigned long current_time_micros - when the sample was taken
+//    uint8_t       lines               - the LINE_* bits of the sample
+//    uint8_t       mode                - the weapon mode at the time
+void Line_Trace::record_sample(unsigned long current_time_micros, uint8_t lines, uint8_t mode)
+{
+  unsigned long delta = (unsigned long)(current_time_micros - this->last_record_micros_);
+
+  // keep the deltas representable on long quiet stretches by repeating the held state
+  while (delta > MAX_DELTA_MICROS_)
+  {
+    this->write_record(MAX_DELTA_MICROS_, this->last_lines_, this->last_mode_);
+    this->last_record_micros_ += MAX_DELTA_MICROS_;
+    delta                     -= MAX_DELTA_MICROS_;
+  }
+
+  // redundancy check; most samples are the same as the last one
+  if (lines == this->last_lines_ && mode == this->last_mode_)
+  {
+    return;
+  }
+
+  this->write_record(delta, lines, mode);
+  this->last_record_micros_ = current_time_micros;
+  this->last_lines_         = lines;
+  this->last_mode_          = mode;
+}
+
+
+// wait for and read a header; returns false if what showed up wasn't one
+bool Line_Trace::begin_replay()
+{
+  uint8_t header[HEADER_SIZE_];
+
+  if (this->read_bytes(header, HEADER_SIZE_) != HEADER_SIZE_)
+  {
+    return false;
+  }
+
+  for (uint8_t i = 0; i < sizeof(TRACE_MAGIC); i++)
+  {
+    if (header[i] != TRACE_MAGIC[i]) return false;
+  }
+
+  this->start_micros_         = this->read_uint32(&header[4]);
+  this->sample_period_micros_ = this->read_uint16(&header[8]);
+
+  return true;
+}
+
+
+// read the next record; returns false once the trace has ended
+//    record& next_record - filled in with the record
+bool Line_Trace::read_record(record& next_record)
+{
+  uint8_t bytes[RECORD_SIZE_];
+
+  // a short read means the sender stopped (Stream's timeout ran out), or we're at the end of the memory
+  if (this->read_bytes(bytes, RECORD_SIZE_) != RECORD_SIZE_)
+  {
+    return false;
+  }
+
+  next_record.delta_micros = this->read_uint16(&bytes[0]);
+  next_record.lines        = bytes[2];
+  next_record.mode         = bytes[3];
+
+  return true;
+}
+
+
+// header contents, valid once recording or replay has begun
+unsigned long Line_Trace::get_start_micros()
+{
+  return this->start_micros_;
+}
+
+
+uint16_t Line_Trace::get_sample_period_micros()
+{
+  return this->sample_period_micros_;
+}
+
+
+//
+//  private methods
+//
+
+// helper methods; little-endian reads and writes no matter what we're compiled on
+void Line_Trace::write_uint16(uint16_t value)
+{
+  this->stream_->write((uint8_t)(value      ));
+  this->stream_->write((uint8_t)(value >> 8 ));
+}
+
+
+void Line_Trace::write_uint32(unsigned long value)
+{
+  this->stream_->write((uint8_t)(value      ));
+  this->stream_->write((uint8_t)(value >> 8 ));
+  this->stream_->write((uint8_t)(value >> 16));
+  this->stream_->write((uint8_t)(value >> 24));
+}
+
+
+uint16_t Line_Trace::read_uint16(const uint8_t* bytes)
+{
+  return (uint16_t)bytes[0] | ((uint16_t)bytes[1] << 8);
+}
+
+
+unsigned long Line_Trace::read_uint32(const uint8_t* bytes)
+{
+  return  (unsigned long)bytes[0]        | ((unsigned long)bytes[1] << 8 ) |
+         ((unsigned long)bytes[2] << 16) | ((unsigned long)bytes[3] << 24);
+}
+
+
+// helper method; reads the next few bytes from wherever the trace is coming from; returns how many it got
+uint8_t Line_Trace::read_bytes(uint8_t* buffer, uint8_t count)
+{
+  if (this->stream_ != NULL)
+  {
+    return (uint8_t)this->stream_->readBytes(buffer, count);
+  }
+
+  uint8_t got = 0;
+  while (got < count && this->position_ < this->length_)
+  {
+    buffer[got++] = this->bytes_[this->position_++];
+  }
+  return got;
+}
+
+
+// helper method; writes one record
+void Line_Trace::write_record(uint16_t delta_micros, uint8_t lines, uint8_t mode)
+{
+  this->write_uint16(delta_micros);
+  this->stream_->write(lines);
+  this->stream_->write(mode);
+}
@@ -0,0 +1,134 @@
+//============================================================================//
+//  Name    : Line_Trace.h                                                    //
+//  Desc    : C++ Interface for recording and replaying weapon line activity  //
+//            as a compact binary trace                                       //
+//  Dev     : Nate Cope,                                                      //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Trace format, all little-endian, fixed size so a file of it   //
+//              can be memory-mapped and indexed directly:                    //
+//                header (12 bytes):                                          //
+//                  char[4]  magic                "FBT1"                      //
+//                  uint32_t start_micros         micros() at the first record//
+//                  uint16_t sample_period_micros how often to re-sample the  //
+//                                                held line state on replay   //
+//                  uint16_t reserved             zero                        //
+//                records (4 bytes each), one per change:                     //
+//                  uint16_t delta_micros  since the previous record          //
+//                  uint8_t  lines         LINE_* bits below                  //
+//                  uint8_t  mode          the weapon mode (0 SABER, 1 FOIL,  //
+//                                         2 EPEE)                            //
+//            - A record is only written when the lines or mode change, plus  //
+//              a repeat of the same state whenever the delta would overflow, //
+//              so a quiet multi-hour bout stays small                        //
+//            - Recording goes through a Stream, one record at a time, so the   //
+//              box never holds more than a record in memory; replay reads    //
+//              from a Stream too, or straight from a trace already in memory //
+//              (e.g. a file mapped with mmap(), as host/replay_traces does)  //
+//            - NB: a very noisy line can outrun a slow serial link while     //
+//              recording, since every change costs four bytes; raise the     //
+//              baud rate if records start to hold up the main loop           //
+//============================================================================//
+
+#ifndef LINE_TRACE_H
+#define LINE_TRACE_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+
+// A class to record and replay weapon line activity through a Stream
+class Line_Trace
+{
+  public:
+
+    // one change in the weapon lines
+    struct record
+    {
+      uint16_t delta_micros;
+      uint8_t  lines;
+      uint8_t  mode;
+    };
+
+    // line bits; the box reads the lines twice per loop, once with each fencer's weapon powered
+    static const uint8_t LINE_LEFT_PHASE_LEFT_WEAPON_   = 0x01;   // left B (weapon) line, left weapon powered
+    static const uint8_t LINE_LEFT_PHASE_LEFT_LAME_     = 0x02;   // left A (lame) line, left weapon powered
+    static const uint8_t LINE_LEFT_PHASE_RIGHT_LAME_    = 0x04;   // right A (lame) line, left weapon powered
+    static const uint8_t LINE_RIGHT_PHASE_RIGHT_WEAPON_ = 0x08;   // right B (weapon) line, right weapon powered
+    static const uint8_t LINE_RIGHT_PHASE_LEFT_LAME_    = 0x10;   // left A (lame) line, right weapon powered
+    static const uint8_t LINE_RIGHT_PHASE_RIGHT_LAME_   = 0x20;   // right A (lame) line, right weapon powered
+
+    // Constructor
+    //    Stream* stream - where the trace is written to or read from (usually &Serial)
+    Line_Trace(Stream* stream);
+
+    // Constructor, for replaying a whole trace that's already in memory; the bytes aren't copied, so they have to
+    // outlast the replay
+    //    const uint8_t* bytes  - the trace, header first
+    //    unsigned long  length - how many bytes of it there are
+    Line_Trace(const uint8_t* bytes, unsigned long length);
+
+    // pack the readings taken with the left fencer's weapon powered into line bits
+    static uint8_t encode_left_phase(bool left_weapon_high, bool left_lame_high, bool right_lame_high);
+
+    // pack the readings taken with the right fencer's weapon powered into line bits
+    static uint8_t encode_right_phase(bool right_weapon_high, bool left_lame_high, bool right_lame_high);
+
+    // write the header and start recording
+    //    unsigned long start_micros         - the time of the first sample
+    //    uint16_t      sample_period_micros - how often the recording box samples the lines, roughly
+    void begin_recording(unsigned long start_micros, uint16_t sample_period_micros);
+
+    // note one sample of the lines; only actually writes anything if something changed
+    //    unsigned long current_time_micros - when the sample was taken
+    //    uint8_t       lines               - the LINE_* bits of the sample
+    //    uint8_t       mode                - the weapon mode at the time
+    void record_sample(unsigned long current_time_micros, uint8_t lines, uint8_t mode);
+
+    // wait for and read a header; returns false if what showed up wasn't one
+    bool begin_replay();
+
+    // read the next record; returns false once the trace has ended
+    //    record& next_record - filled in with the record
+    bool read_record(record& next_record);
+
+    // header contents, valid once recording or replay has begun
+    unsigned long get_start_micros();
+    uint16_t      get_sample_period_micros();
+
+  private:
+
+    // where the trace goes or comes from: a stream, or else memory (and how far through it we've read)
+    Stream*        stream_               = NULL;
+    const uint8_t* bytes_                = NULL;
+    unsigned long  length_               = 0;
+    unsigned long  position_             = 0;
+
+    // header contents
+    unsigned long start_micros_         = 0;
+    uint16_t      sample_period_micros_ = 0;
+
+    // the last thing recorded, so we only write changes
+    unsigned long last_record_micros_   = 0;
+    uint8_t       last_lines_           = 0;
+    uint8_t       last_mode_            = 0;
+
+    // helper methods; little-endian reads and writes no matter what we're compiled on
+    void     write_uint16(uint16_t value);
+    void     write_uint32(unsigned long value);
+    uint16_t read_uint16(const uint8_t* bytes);
+    unsigned long read_uint32(const uint8_t* bytes);
+
+    // helper method; reads the next few bytes from wherever the trace is coming from; returns how many it got
+    uint8_t read_bytes(uint8_t* buffer, uint8_t count);
+
+    // helper method; writes one record
+    void write_record(uint16_t delta_micros, uint8_t lines, uint8_t mode);
+
+    // format constants
+    static const uint8_t  HEADER_SIZE_      = 12;
+    static const uint8_t  RECORD_SIZE_      = 4;
+    static const uint16_t MAX_DELTA_MICROS_ = 0xFFFF;
+};
+
+#endif
@@ -0,0 +1,312 @@
+//============================================================================//
+//  Name    : Seven_Segment_Background.cpp                                    //
+//  Desc    : C++ Implementation for sending TM1637 frames from a Timer1      //
+//            interrupt, in the background of the main loop                   //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - See the header for what this does to Timer1                   //
+//============================================================================//
+
+// interface include
+#include "Seven_Segment_Background.h"
+
+// static data member definitions
+Seven_Segment_Transfer*                         Seven_Segment_Background::transfers_ [MAX_DISPLAYS_]                = {NULL, NULL, NULL};
+volatile uint8_t                                Seven_Segment_Background::frames_    [MAX_DISPLAYS_][2][FRAME_SIZE_];
+volatile uint8_t                                Seven_Segment_Background::front_     [MAX_DISPLAYS_]                = {0, 0, 0};
+volatile bool                                   Seven_Segment_Background::fresh_     [MAX_DISPLAYS_]                = {false, false, false};
+volatile bool                                   Seven_Segment_Background::failed_    [MAX_DISPLAYS_]                = {false, false, false};
+uint8_t                                         Seven_Segment_Background::transfer_count_                           = 0;
+uint8_t                                         Seven_Segment_Background::frame_     [FRAME_SIZE_];
+volatile uint8_t                                Seven_Segment_Background::current_slot_                             = NO_SLOT_;
+uint8_t                                         Seven_Segment_Background::last_slot_                                = 0;
+uint8_t                                         Seven_Segment_Background::phase_                                    = 0;
+bool                                            Seven_Segment_Background::running_                                  = false;
+Seven_Segment_Background::statistics            Seven_Segment_Background::statistics_                               = {0, 0, 0};
+
+// the TM1637 commands a frame is made of
+static const uint8_t DATA_COMMAND_AUTO_INCREMENT_ = 0x40;
+static const uint8_t ADDRESS_COMMAND_FIRST_DIGIT_ = 0xC0;
+
+// Timer1 counts at an eighth of the CPU clock
+static const unsigned long TIMER1_COUNTS_PER_SEC_ = F_CPU / 8;
+
+
+// send the next unit
+ISR(TIMER1_COMPA_vect)
+{
+  Seven_Segment_Background::on_interrupt();
+}
+
+
+// take over Timer1 and start sending; returns false (and does nothing) if Timer1's already in use
+//    unsigned long unit_rate_hz - how many units to send per second
+bool Seven_Segment_Background::begin(unsigned long unit_rate_hz)
+{
+  // anyone else with a Timer1 interrupt on (e.g. Cycle_Counter) got there first
+  if (running_ || TIMSK1 != 0 || unit_rate_hz == 0)
+  {
+    return false;
+  }
+
+  unsigned long top = TIMER1_COUNTS_PER_SEC_ / unit_rate_hz;
+  if (top == 0)       top = 1;
+  if (top > 0x10000)  top = 0x10000;
+
+  uint8_t old_sreg = SREG;
+  noInterrupts();
+
+  TCCR1A     = 0;                         // no output compare pins
+  TCCR1B     = _BV(WGM12) | _BV(CS11);    // CTC on OCR1A, prescaler 8
+  OCR1A      = (uint16_t)(top - 1);
+  TCNT1      = 0;
+  TIFR1      = _BV(OCF1A);                // clear any stale match (written as a one, weirdly)
+  TIMSK1     = _BV(OCIE1A);               // compare match A interrupt only
+  running_   = true;
+
+  SREG = old_sreg;
+
+  return true;
+}
+
+
+// stop sending and give Timer1 back
+void Seven_Segment_Background::end()
+{
+  uint8_t old_sreg = SREG;
+  noInterrupts();
+
+  TIMSK1   = 0;
+  TCCR1B   = 0;
+  running_ = false;
+
+  SREG = old_sreg;
+}
+
+
+// whether begin() has been and end() hasn't
+bool Seven_Segment_Background::is_running()
+{
+  return running_;
+}
+
+
+// hand a display's sender over to the interrupt; returns the slot to stage its frames in, or NO_SLOT_
+//    Seven_Segment_Transfer* transfer - the display's sender; must be idle
+uint8_t Seven_Segment_Background::add_transfer(Seven_Segment_Transfer* transfer)
+{
+  if (transfer == NULL || !transfer->is_idle() || transfer_count_ == MAX_DISPLAYS_)
+  {
+    return NO_SLOT_;
+  }
+
+  uint8_t old_sreg = SREG;
+  noInterrupts();
+
+  uint8_t slot       = transfer_count_;
+  transfers_[slot]   = transfer;
+  fresh_[slot]       = false;
+  failed_[slot]      = false;
+  transfer_count_++;
+
+  SREG = old_sreg;
+
+  return slot;
+}
+
+
+// stage a frame for sending; replaces any staged frame for the same slot that hasn't gone out yet
+//    uint8_t       slot     - from add_transfer()
+//    const uint8_t digits[] - the display's four segment bytes, leftmost first
+//    uint8_t       control  - the display control command (on / off, brightness)
+void Seven_Segment_Background::stage_frame(uint8_t slot, const uint8_t digits[], uint8_t control)
+{
+  if (slot >= transfer_count_)
+  {
+    return;
+  }
+
+  // fill the buffer that isn't handed over; the interrupt copies a frame out the moment it takes it, so the
+  // only one it could ever be reading is the front one
+  uint8_t           back  = front_[slot] ^ 0x01;
+  volatile uint8_t* frame = frames_[slot][back];
+
+  for (uint8_t i = 0; i < CONTROL_INDEX_; i++)
+  {
+    frame[i] = digits[i];
+  }
+  frame[CONTROL_INDEX_] = control;
+
+  // then hand it over; each of these is a single byte write, so no interrupt can see one half done
+  front_[slot] = back;
+  fresh_[slot] = true;
+
+  // and wake the interrupt up, if it's switched itself off for want of anything to send (TIMSK1 isn't in bit
+  // instruction range, so this is a read-modify-write that mustn't be interrupted)
+  uint8_t old_sreg = SREG;
+  noInterrupts();
+
+  if (running_)
+  {
+    TIMSK1 |= _BV(OCIE1A);
+  }
+
+  SREG = old_sreg;
+}
+
+
+// whether the slot has a frame staged or on its way out
+bool Seven_Segment_Background::is_sending(uint8_t slot)
+{
+  return fresh_[slot] || current_slot_ == slot;
+}
+
+
+// whether a frame for the slot has been dropped because the display didn't ACK, since the last time this said so
+//    uint8_t slot - from add_transfer()
+bool Seven_Segment_Background::take_failure(uint8_t slot)
+{
+  if (slot >= transfer_count_)
+  {
+    return false;
+  }
+
+  uint8_t old_sreg = SREG;
+  noInterrupts();
+
+  bool failed   = failed_[slot];
+  failed_[slot] = false;
+
+  SREG = old_sreg;
+
+  return failed;
+}
+
+
+// Returns a copy of the background traffic accounting
+Seven_Segment_Background::statistics Seven_Segment_Background::get_statistics()
+{
+  uint8_t old_sreg = SREG;
+  noInterrupts();
+
+  statistics copy = statistics_;
+
+  SREG = old_sreg;
+
+  return copy;
+}
+
+
+// Zeroes the background traffic accounting
+void Seven_Segment_Background::reset_statistics()
+{
+  uint8_t old_sreg = SREG;
+  noInterrupts();
+
+  statistics_.units_sent   = 0;
+  statistics_.frames_sent  = 0;
+  statistics_.ack_failures = 0;
+
+  SREG = old_sreg;
+}
+
+
+// sends the next unit
+void Seven_Segment_Background::on_interrupt()
+{
+  // between frames, take the next staged one, going round the displays in turn
+  if (current_slot_ == NO_SLOT_)
+  {
+    for (uint8_t i = 1; i <= transfer_count_; i++)
+    {
+      uint8_t slot = (last_slot_ + i) % transfer_count_;
+
+      if (fresh_[slot])
+      {
+        const volatile uint8_t* frame = frames_[slot][front_[slot]];
+        for (uint8_t j = 0; j < FRAME_SIZE_; j++)
+        {
+          frame_[j] = frame[j];
+        }
+
+        fresh_[slot]  = false;
+        current_slot_ = slot;
+        last_slot_    = slot;
+        phase_        = PHASE_DATA_COMMAND;
+        begin_phase();
+        break;
+      }
+    }
+
+    // nothing to send, so stop firing until stage_frame() has something
+    if (current_slot_ == NO_SLOT_)
+    {
+      TIMSK1 &= ~_BV(OCIE1A);
+      return;
+    }
+  }
+
+  Seven_Segment_Transfer* transfer = transfers_[current_slot_];
+
+  statistics_.units_sent++;
+  if (!transfer->step(1))
+  {
+    return;
+  }
+
+  // a display that didn't answer has its frame dropped (and any it's staged since: it'll stage them again) and
+  // is told, so it can back off; retrying it here would be at the full interrupt rate
+  if (!transfer->get_transaction().acknowledged)
+  {
+    statistics_.ack_failures++;
+    fresh_[current_slot_]  = false;
+    failed_[current_slot_] = true;
+    current_slot_          = NO_SLOT_;
+    return;
+  }
+
+  phase_++;
+  if (phase_ == PHASE_COUNT_)
+  {
+    statistics_.frames_sent++;
+    current_slot_ = NO_SLOT_;
+    return;
+  }
+
+  begin_phase();
+}
+
+
+//
+//  private methods
+//
+
+// helper method; starts the transaction for the current phase of the frame being sent
+void Seven_Segment_Background::begin_phase()
+{
+  Seven_Segment_Transfer::transaction next;
+  next.length = 1;
+
+  switch (phase_)
+  {
+    case PHASE_DATA_COMMAND:
+      next.bytes[0] = DATA_COMMAND_AUTO_INCREMENT_;
+      break;
+
+    case PHASE_DIGITS:
+      next.bytes[0] = ADDRESS_COMMAND_FIRST_DIGIT_;
+      for (uint8_t i = 0; i < CONTROL_INDEX_; i++)
+      {
+        next.bytes[1 + i] = frame_[i];
+      }
+      next.length = 1 + CONTROL_INDEX_;
+      break;
+
+    case PHASE_CONTROL:
+      next.bytes[0] = frame_[CONTROL_INDEX_];
+      break;
+  }
+
+  transfers_[current_slot_]->begin(next);
+}
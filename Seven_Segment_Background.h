@@ -0,0 +1,140 @@
+//============================================================================//
+//  Name    : Seven_Segment_Background.h                                      //
+//  Desc    : C++ Interface for sending TM1637 frames from a Timer1           //
+//            interrupt, in the background of the main loop                   //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Driven from tick(), the displays only make progress as fast   //
+//              as the loop comes round, and the loop comes round slower the  //
+//              more the displays have to send. Here a Timer1 compare         //
+//              interrupt sends one unit (see Seven_Segment_Transfer) per     //
+//              firing instead, at a fixed rate, whatever the loop is doing   //
+//            - The main loop only stages frames: a display's four digits and //
+//              its display control byte. Each display has two frame buffers; //
+//              staging fills the one the interrupt isn't looking at, then    //
+//              flips a single byte to hand it over, so staging never waits   //
+//              and the interrupt never sees half a frame                     //
+//            - A frame goes out whole: the data command, the four digits and //
+//              the control byte. The interrupt takes staged frames from the  //
+//              displays in turn, so none can starve the others               //
+//            - A display that doesn't ACK has its frame dropped, not retried //
+//              here; take_failure() tells it, so it can back off and stage   //
+//              the frame again itself (see Seven_Segment_Display)            //
+//            - With no frame staged, the interrupt switches itself off;      //
+//              stage_frame() switches it back on                             //
+//            - Takes over Timer1 completely, so it can't run alongside       //
+//              Cycle_Counter (DEBUG 4); begin() refuses if that's running    //
+//            - All the displays sharing a data pin must send through here    //
+//              or none of them; nothing else may drive the data pin while    //
+//              this is running                                               //
+//============================================================================//
+
+#ifndef SEVEN_SEGMENT_BACKGROUND_H
+#define SEVEN_SEGMENT_BACKGROUND_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+
+// local includes
+#include "Seven_Segment_Transfer.h"
+
+// A static class to send seven-segment display frames from a timer interrupt
+class Seven_Segment_Background
+{
+  public:
+
+    // the most displays that can send through here
+    static const uint8_t MAX_DISPLAYS_              = 3;
+
+    // what add_transfer() hands back when there's no room
+    static const uint8_t NO_SLOT_                   = 0xFF;
+
+    // units sent per second unless told otherwise; a whole frame is 62 units, so about 6ms a display
+    static const unsigned long DEFAULT_UNIT_RATE_HZ_ = 10000;
+
+    // take over Timer1 and start sending; returns false (and does nothing) if Timer1's already in use
+    //    unsigned long unit_rate_hz - how many units to send per second (31 to 2000000)
+    static bool begin(unsigned long unit_rate_hz = DEFAULT_UNIT_RATE_HZ_);
+
+    // stop sending and give Timer1 back
+    static void end();
+
+    // whether begin() has been and end() hasn't
+    static bool is_running();
+
+    // hand a display's sender over to the interrupt; returns the slot to stage its frames in, or NO_SLOT_ if
+    // there's no room. The sender mustn't be used by anything else afterwards
+    //    Seven_Segment_Transfer* transfer - the display's sender; must be idle
+    static uint8_t add_transfer(Seven_Segment_Transfer* transfer);
+
+    // stage a frame for sending; replaces any staged frame for the same slot that hasn't gone out yet
+    //    uint8_t       slot     - from add_transfer()
+    //    const uint8_t digits[] - the display's four segment bytes, leftmost first
+    //    uint8_t       control  - the display control command (on / off, brightness)
+    static void stage_frame(uint8_t slot, const uint8_t digits[], uint8_t control);
+
+    // whether the slot has a frame staged or on its way out
+    static bool is_sending(uint8_t slot);
+
+    // whether a frame for the slot has been dropped because the display didn't ACK, since the last time this
+    // said so; the display's to back off and stage it again
+    //    uint8_t slot - from add_transfer()
+    static bool take_failure(uint8_t slot);
+
+    // background traffic accounting, since begin() or the last reset
+    struct statistics
+    {
+      unsigned long units_sent;     // starts, bits and stops
+      unsigned long frames_sent;    // frames that made it out whole
+      unsigned long ack_failures;   // frames cut short by a display that didn't ACK (they're dropped)
+    };
+
+    // Returns a copy of the background traffic accounting
+    static statistics get_statistics();
+
+    // Zeroes the background traffic accounting
+    static void reset_statistics();
+
+    // sends the next unit; NB: public only so the interrupt can get at it; don't call it
+    static void on_interrupt();
+
+  private:
+
+    // helper method; starts the transaction for the current phase of the frame being sent
+    static void begin_phase();
+
+    // how long a frame is: four digits and a control byte
+    static const uint8_t FRAME_SIZE_     = 5;
+    static const uint8_t CONTROL_INDEX_  = 4;
+
+    // the transactions a frame is sent as
+    enum frame_phase
+    {
+      PHASE_DATA_COMMAND,
+      PHASE_DIGITS,
+      PHASE_CONTROL,
+      PHASE_COUNT_
+    };
+
+    // the senders, and each one's pair of frame buffers (front_ is the one handed over; fresh_ means it hasn't
+    // been taken yet; failed_ means one was dropped for want of an ACK)
+    static Seven_Segment_Transfer* transfers_ [MAX_DISPLAYS_];
+    static volatile uint8_t        frames_    [MAX_DISPLAYS_][2][FRAME_SIZE_];
+    static volatile uint8_t        front_     [MAX_DISPLAYS_];
+    static volatile bool           fresh_     [MAX_DISPLAYS_];
+    static volatile bool           failed_    [MAX_DISPLAYS_];
+    static uint8_t                 transfer_count_;
+
+    // the frame being sent, copied out when it's taken, and where we are in it
+    static uint8_t                 frame_     [FRAME_SIZE_];
+    static volatile uint8_t        current_slot_;
+    static uint8_t                 last_slot_;
+    static uint8_t                 phase_;
+
+    static bool                    running_;
+    static statistics              statistics_;
+};
+
+#endif
@@ -0,0 +1,275 @@
+//============================================================================//
+//  Name    : Seven_Segment_Bus.cpp                                           //
+//  Desc    : C++ Implementation for TM1637 displays sharing a data pin, so   //
+//            the bytes they all need can be sent to all of them at once      //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - See the header for how steps are handed out, and when a       //
+//              transaction gets shared                                       //
+//============================================================================//
+
+// interface include
+#include "Seven_Segment_Bus.h"
+
+// Constructor
+//    uint8_t data_pin - the Arduino pin attached to the DATA pins of all the displays
+Seven_Segment_Bus::Seven_Segment_Bus(uint8_t data_pin)
+{
+  this->data_pin_ = data_pin;
+}
+
+// Destructor
+Seven_Segment_Bus::~Seven_Segment_Bus()
+{
+  // delete the underlying object we allocated memory for (if we ever did)
+  delete this->transfer_;
+}
+
+
+// Adds a display to the bus; returns false (and leaves the display sending alone) if it's full, or the display
+// isn't on our data pin
+//    Seven_Segment_Display* display - the display to add
+bool Seven_Segment_Bus::add_display(Seven_Segment_Display* display)
+{
+  // (a display sending from the timer interrupt already has the data pin to itself) 
+  if (this->display_count_ == MAX_DISPLAYS_ || display->data_pin_ != this->data_pin_ || this->members_ != 0 || 
+      display->background_slot_ != Seven_Segment_Background::NO_SLOT_)
+  {
+    return false;
+  }
+
+  // the first display decides which port we drive
+  uint8_t port = uno_pin_port_io_address(display->clock_pin_);
+  if (this->transfer_ == NULL)
+  {
+    this->clock_port_ = port;
+    this->transfer_   = new Seven_Segment_Transfer(port, 0, this->data_pin_);
+  }
+
+  // a clock pin on some other port can't be clocked alongside the rest
+  this->displays_   [this->display_count_] = display;
+  this->clock_masks_[this->display_count_] = (port == this->clock_port_) ? (1 << uno_pin_port_bit(display->clock_pin_)) : 0;
+  this->display_count_++;
+
+  // a new display is something to look at, whatever it wants
+  this->seen_generations_[this->display_count_ - 1] = display->send_generation_ - 1;
+
+  display->bus_ = this;
+
+  return true;
+}
+
+
+// Lets the bus know what the current time is; this is where all the sending for its displays happens,
+// a few steps' worth per call. If "0" is passed in specifically, nothing is sent
+void Seven_Segment_Bus::tick(unsigned long current_time_micros)
+{
+  if (current_time_micros == 0)
+  {
+    return;
+  }
+
+  for (uint8_t i = 0; i < this->steps_per_loop_; i++)
+  {
+    // nobody wants anything; no point asking again this loop
+    if (!this->step_once())
+    {
+      return;
+    }
+  }
+}
+
+
+// Sets how many steps each tick() may hand out; a step is one display (or one shared transaction) sending
+// its usual few units
+void Seven_Segment_Bus::set_steps_per_loop(uint8_t steps)
+{
+  this->steps_per_loop_ = (steps == 0) ? 1 : steps;
+}
+
+
+// Puts a display at the front of the line for steps (e.g. the clock, while a bout is running); NULL puts
+// everyone back in the order they were added
+//    Seven_Segment_Display* display - the display to serve first
+void Seven_Segment_Bus::set_first_in_line(Seven_Segment_Display* display)
+{
+  this->first_in_line_ = display;
+}
+
+
+// Sets how many units (starts, bits, stops) of a shared transaction each step may send
+void Seven_Segment_Bus::set_transfer_units_per_tick(uint8_t units)
+{
+  this->transfer_units_per_tick_ = (units == 0) ? 1 : units;
+}
+
+
+// How many shared transactions have gone out
+unsigned long Seven_Segment_Bus::get_broadcast_count()
+{
+  return this->broadcast_count_;
+}
+
+
+// How many bytes sending the shared transactions separately would have added
+unsigned long Seven_Segment_Bus::get_bytes_saved()
+{
+  return this->bytes_saved_;
+}
+
+
+// Zeroes the above
+void Seven_Segment_Bus::reset_statistics()
+{
+  this->broadcast_count_ = 0;
+  this->bytes_saved_     = 0;
+}
+
+
+//
+//  private methods
+//
+
+// helper method; hands out one step; returns false if nobody had anything to send
+bool Seven_Segment_Bus::step_once()
+{
+  // a transaction in progress has the line until it's done; another one starting partway through it would find that
+  // display's chip in the middle of a byte, so who goes next is only ever decided in between
+  if (this->sending_display_ != NO_DISPLAY_)
+  {
+    return this->step_display(this->sending_display_);
+  }
+
+  // something everyone wants goes ahead of anything just one display wants (and a shared transaction in progress
+  // keeps going, the same as anyone's)
+  if (this->members_ != 0 || this->try_begin_broadcast())
+  {
+    if (this->transfer_->step(this->transfer_units_per_tick_))
+    {
+      this->finish_broadcast();
+    }
+    return true;
+  }
+
+  // otherwise, the first in line with anything to send gets the step
+  for (uint8_t i = 0; i < this->display_count_; i++)
+  {
+    if (this->displays_[i] == this->first_in_line_ && this->step_display(i))
+    {
+      return true;
+    }
+  }
+
+  for (uint8_t i = 0; i < this->display_count_; i++)
+  {
+    if (this->displays_[i] != this->first_in_line_ && this->step_display(i))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+// helper method; gives one display a step, and the line until its transaction's done; returns false if it had nothing
+// to send
+//    uint8_t index - which display
+bool Seven_Segment_Bus::step_display(uint8_t index)
+{
+  bool stepped = this->displays_[index]->step_incremental_display();
+
+  this->sending_display_ = this->displays_[index]->transfer_->is_idle() ? NO_DISPLAY_ : index;
+
+  return stepped;
+}
+
+
+// helper method; starts a shared transaction if enough displays want the same one (and anything's changed since the
+// last look); returns true if it did
+bool Seven_Segment_Bus::try_begin_broadcast()
+{
+  Seven_Segment_Transfer::transaction wanted[MAX_DISPLAYS_];
+  bool                                ready [MAX_DISPLAYS_] = {false, false, false};
+
+  // nobody's wants have changed since the last look, so it would come to the same nothing; this gets asked every
+  // step, and building everyone's next transaction to compare isn't free
+  bool changed = false;
+  for (uint8_t i = 0; i < this->display_count_; i++)
+  {
+    if (this->displays_[i]->send_generation_ != this->seen_generations_[i])
+    {
+      this->seen_generations_[i] = this->displays_[i]->send_generation_;
+      changed                    = true;
+    }
+  }
+
+  if (!changed)
+  {
+    return false;
+  }
+
+  // what does everyone who could share want to send next?
+  // (asking a display that then doesn't take part is harmless; it just asks itself again on its next step)
+  // (a display that's stopped answering sends on its own until it answers again: the ACK on the shared data line is 
+  // any chip's, so in company another display's would pass for its own) 
+  for (uint8_t i = 0; i < this->display_count_; i++)
+  {
+    if (this->clock_masks_[i] != 0 && this->displays_[i]->transfer_->is_idle() && !this->displays_[i]->is_degraded())
+    {
+      ready[i] = this->displays_[i]->build_next_transaction(wanted[i]);
+    }
+  }
+
+  // the first group of two or more wanting exactly the same bytes goes
+  for (uint8_t i = 0; i < this->display_count_; i++)
+  {
+    if (!ready[i])
+    {
+      continue;
+    }
+
+    uint8_t members    = (1 << i);
+    uint8_t clock_mask = this->clock_masks_[i];
+    uint8_t count      = 1;
+
+    for (uint8_t j = i + 1; j < this->display_count_; j++)
+    {
+      if (ready[j] && wanted[j].length == wanted[i].length && memcmp(wanted[j].bytes, wanted[i].bytes, wanted[i].length) == 0)
+      {
+        members    |= (1 << j);
+        clock_mask |= this->clock_masks_[j];
+        count++;
+        ready[j]    = false;
+      }
+    }
+
+    if (count > 1)
+    {
+      this->transfer_->set_clock_mask(clock_mask);
+      this->transfer_->begin(wanted[i]);
+      this->members_          = members;
+      this->broadcast_count_ += 1;
+      this->bytes_saved_     += (unsigned long)wanted[i].length * (count - 1);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+// helper method; hands the finished shared transaction to everyone who took part
+void Seven_Segment_Bus::finish_broadcast()
+{
+  for (uint8_t i = 0; i < this->display_count_; i++)
+  {
+    if (this->members_ & (1 << i))
+    {
+      this->displays_[i]->complete_transaction(this->transfer_->get_transaction());
+    }
+  }
+
+  this->members_ = 0;
+}
@@ -0,0 +1,147 @@
+//============================================================================//
+//  Name    : Seven_Segment_Bus.h                                             //
+//  Desc    : C++ Interface for TM1637 displays sharing a data pin, so the    //
+//            bytes they all need can be sent to all of them at once          //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - The bus owns the shared data line: once a display is added, //
+//              its tick() stops sending anything itself, and the bus's       //
+//              tick() hands out a fixed number of steps per loop instead, to //
+//              whichever display wants one most (in priority order), so bus  //
+//              work is spread evenly over loops instead of bunching up when  //
+//              all the displays change at once                               //
+//            - Priority only counts between transactions: once one's begun,  //
+//              shared or not, it gets every step until its STOP. The chips   //
+//              share DIO, so anything else started in the middle would be    //
+//              talking over a chip that's partway through a byte             //
+//            - Each display still keeps track of what it needs sent. But     //
+//              when two or more idle displays want the very same transaction //
+//              next (the auto-increment data command at power-on, or the     //
+//              same text going up on all of them at a mode change), the bus  //
+//              sends it once, clocking all of their CLK pins with one port   //
+//              write                                                         //
+//            - Only displays with their CLK pins on the same port as the     //
+//              first one added can share; the rest just send on their own    //
+//            - A shared transaction's ACK is the shared data line pulled     //
+//              low, by any of the chips: there's no telling which answered.  //
+//              So a display that's stopped answering (degraded) never        //
+//              shares; it only joins in again once it's ACKed on its own.    //
+//              One that stops answering partway through a shared             //
+//              transaction isn't noticed until its next one of its own       //
+//============================================================================//
+
+#ifndef SEVEN_SEGMENT_BUS_H
+#define SEVEN_SEGMENT_BUS_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+
+// local includes
+#include "Seven_Segment_Display.h"
+#include "Seven_Segment_Transfer.h"
+
+// A class to send the same TM1637 transactions to several displays at once
+class Seven_Segment_Bus
+{
+  public:
+
+    // Constructor
+    //    uint8_t data_pin - the Arduino pin attached to the DATA pins of all the displays
+    Seven_Segment_Bus(uint8_t data_pin);
+
+    // Destructor
+    ~Seven_Segment_Bus();
+
+    // Adds a display to the bus; returns false (and leaves the display sending alone) if it's full, or the display
+    // isn't on our data pin
+    //    Seven_Segment_Display* display - the display to add
+    bool add_display(Seven_Segment_Display* display);
+
+    // Lets the bus know what the current time is; this is where all the sending for its displays happens,
+    // a few steps' worth per call. If "0" is passed in specifically, nothing is sent
+    void tick(unsigned long current_time_micros);
+
+    // Sets how many steps each tick() may hand out; a step is one display (or one shared transaction) sending
+    // its usual few units
+    void set_steps_per_loop(uint8_t steps);
+
+    // Puts a display at the front of the line for steps (e.g. the clock, while a bout is running); NULL puts
+    // everyone back in the order they were added
+    //    Seven_Segment_Display* display - the display to serve first
+    void set_first_in_line(Seven_Segment_Display* display);
+
+    // Sets how many units (starts, bits, stops) of a shared transaction each step may send
+    // (a display's own transactions go at its own set_transfer_units_per_tick() rate)
+    void set_transfer_units_per_tick(uint8_t units);
+
+    // How many shared transactions have gone out, and how many bytes sending them separately would have added
+    unsigned long get_broadcast_count();
+    unsigned long get_bytes_saved();
+
+    // Zeroes the above
+    void reset_statistics();
+
+    // most displays sharing a data pin
+    static const uint8_t MAX_DISPLAYS_ = 3;
+
+  private:
+
+    // helper method; hands out one step; returns false if nobody had anything to send
+    bool step_once();
+
+    // helper method; gives one display a step, and the line until its transaction's done; returns false if it had
+    // nothing to send
+    //    uint8_t index - which display
+    bool step_display(uint8_t index);
+
+    // helper method; starts a shared transaction if enough displays want the same one (and anything's changed
+    // since the last look); returns true if it did
+    bool try_begin_broadcast();
+
+    // helper method; hands the finished shared transaction to everyone who took part
+    void finish_broadcast();
+
+    // the displays, and which port bit each one's clock pin is (0 if it can't share)
+    Seven_Segment_Display* displays_    [MAX_DISPLAYS_] = {NULL, NULL, NULL};
+    uint8_t                clock_masks_ [MAX_DISPLAYS_] = {0, 0, 0};
+    uint8_t                display_count_               = 0;
+
+    // the port every sharing clock pin is on (its I/O address), the data pin, and the sender that drives them together
+    uint8_t                 clock_port_                 = 0;
+    uint8_t                 data_pin_;
+    Seven_Segment_Transfer* transfer_                   = NULL;
+    uint8_t                 transfer_units_per_tick_    = DEFAULT_TRANSFER_UNITS_PER_TICK_;
+
+    // how many steps a tick() hands out, and who's first in line for them
+    uint8_t                 steps_per_loop_             = DEFAULT_STEPS_PER_LOOP_;
+    Seven_Segment_Display*  first_in_line_              = NULL;
+
+    // one bit per display (by index) taking part in the shared transaction in progress; 0 if there isn't one
+    uint8_t                 members_                    = 0;
+
+    // the display (by index) partway through a transaction of its own, which gets every step until it's done;
+    // NO_DISPLAY_ if none is
+    uint8_t                 sending_display_            = NO_DISPLAY_;
+
+    // each display's send generation when we last looked for something to share; until one moves on, looking
+    // again would find the same nothing
+    uint8_t                 seen_generations_ [MAX_DISPLAYS_] = {0, 0, 0};
+
+    // accounting
+    unsigned long           broadcast_count_            = 0;
+    unsigned long           bytes_saved_                = 0;
+
+    // sending_display_ when nobody is
+    static const uint8_t NO_DISPLAY_                      = 0xFF;
+
+    // units per step unless told otherwise; matches a lone display's default
+    static const uint8_t DEFAULT_TRANSFER_UNITS_PER_TICK_ = 2;
+
+    // steps per tick() unless told otherwise; about what one busy display used to send on its own per loop,
+    // less than three of them used to all at once
+    static const uint8_t DEFAULT_STEPS_PER_LOOP_          = 2;
+};
+
+#endif
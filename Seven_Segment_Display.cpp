@@ -26,9 +26,30 @@
 // interface include
 #include "Seven_Segment_Display.h"
 
-// TODO theoretically changing brightness mid-stream could be a huge issue, 
-//      since it could collide with a currently-sending message 
-// TODO at some point, a major overhaul for beyond 4 character messages 
+// segment bytes for every 7-bit ASCII character, kept in flash; bit 0 is the top segment, then clockwise, with the 
+// middle one last (0x40). Letters that can't really be drawn get their closest look-alike, lower and upper case 
+// share a shape where only one of them works ('B' is an 8, 'R' an A, 'O' a 0), and anything with no sensible 
+// look-alike at all is blank 
+static const uint8_t SEGMENT_FONT_[128] PROGMEM = 
+{
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x00  NUL ^A  ^B  ^C  ^D  ^E  ^F  ^G
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x08  ^H  ^I  ^J  ^K  ^L  ^M  ^N  ^O
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x10  ^P  ^Q  ^R  ^S  ^T  ^U  ^V  ^W
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0x18  ^X  ^Y  ^Z  ^[  ^\  ^]  ^^  ^_
+  0x00, 0x0a, 0x22, 0x00, 0x00, 0x00, 0x00, 0x02,   // 0x20  ' ' !   "   #   $   %   &   '
+  0x39, 0x0f, 0x63, 0x00, 0x04, 0x40, 0x00, 0x52,   // 0x28  (   )   *   +   ,   -   .   /
+  0x3f, 0x06, 0x5b, 0x4f, 0x66, 0x6d, 0x7d, 0x07,   // 0x30  0   1   2   3   4   5   6   7
+  0x7f, 0x6f, 0x00, 0x00, 0x39, 0x48, 0x0f, 0x53,   // 0x38  8   9   :   ;   <   =   >   ?
+  0x00, 0x77, 0x7f, 0x39, 0x5e, 0x79, 0x71, 0x3d,   // 0x40  @   A   B   C   D   E   F   G
+  0x76, 0x06, 0x1e, 0x75, 0x38, 0x55, 0x37, 0x3f,   // 0x48  H   I   J   K   L   M   N   O
+  0x73, 0x67, 0x77, 0x6d, 0x78, 0x3e, 0x3e, 0x7e,   // 0x50  P   Q   R   S   T   U   V   W
+  0x76, 0x6e, 0x5b, 0x39, 0x64, 0x0f, 0x23, 0x08,   // 0x58  X   Y   Z   [   \   ]   ^   _
+  0x20, 0x77, 0x7c, 0x39, 0x5e, 0x79, 0x71, 0x3d,   // 0x60  `   a   b   c   d   e   f   g
+  0x74, 0x06, 0x1e, 0x75, 0x38, 0x55, 0x54, 0x3f,   // 0x68  h   i   j   k   l   m   n   o
+  0x73, 0x67, 0x50, 0x6d, 0x78, 0x1c, 0x1c, 0x7e,   // 0x70  p   q   r   s   t   u   v   w
+  0x76, 0x6e, 0x5b, 0x39, 0x30, 0x0f, 0x00, 0x00    // 0x78  x   y   z   {   |   }   ~   DEL
+};
+
 
 // Constructor 
 //    uint8_t clock_pin - the Arduino pin attached to the CLK pin of the display 
@@ -43,6 +64,35 @@ Seven_Segment_Display::Seven_Segment_Display(uint8_t clock_pin, uint8_t data_pin
   pinMode(this->clock_pin_, OUTPUT);
   pinMode(this->data_pin_,  OUTPUT);
 
+  // the incremental sender 
+  this->transfer_ = new Seven_Segment_Transfer(clock_pin, data_pin); 
+
+  // every layer starts out blank and covering every segment; only the normal one is ever up to start with 
+  for (uint8_t layer = 0; layer < LAYER_COUNT_; layer++)
+  {
+    for (uint8_t i = 0; i < this->DISPLAY_SIZE_; i++)
+    {
+      this->layers_[layer].segments[i] = 0x00; 
+      this->layers_[layer].masks[i]    = 0xFF; 
+    }
+    this->layers_[layer].active              = (layer == LAYER_NORMAL); 
+    this->layers_[layer].birth_micros        = 0; 
+    this->layers_[layer].lifespan_micros     = 0; 
+    this->layers_[layer].blink_period_micros = 0; 
+  }
+
+  // and nothing's scrolling 
+  for (uint8_t layer = 0; layer < SCROLL_LAYER_COUNT_; layer++)
+  {
+    this->scrolls_[layer].length           = 0; 
+    this->scrolls_[layer].offset           = 0; 
+    this->scrolls_[layer].points_flag      = 0x00; 
+    this->scrolls_[layer].r_to_l           = true; 
+    this->scrolls_[layer].active           = false; 
+    this->scrolls_[layer].step_micros      = 0; 
+    this->scrolls_[layer].last_step_micros = 0; 
+  }
+
   // initialization stuff 
   this->set_brightness(this->BRIGHTEST_);
 }
@@ -50,7 +100,8 @@ Seven_Segment_Display::Seven_Segment_Display(uint8_t clock_pin, uint8_t data_pin
 // Destructor 
 Seven_Segment_Display::~Seven_Segment_Display()
 {
-  // no-op currently   
+  // delete the underlying object we allocated memory for 
+  delete this->transfer_;   
 }
 
 // Lets the object know what the current time is. For the sake of streamlining 
@@ -64,34 +115,43 @@ void Seven_Segment_Display::tick(unsigned long current_time_micros)
   {
     this->most_recently_seen_external_time_ = current_time_micros; 
 
+    // move any scrolling messages along if they're due (even one that's covered, so it's where it should be when 
+    // it's uncovered) 
+    for (uint8_t layer = 0; layer < SCROLL_LAYER_COUNT_; layer++)
+    {
+      if (this->scrolls_[layer].active && 
+          (unsigned long)(current_time_micros - this->scrolls_[layer].last_step_micros) >= this->scrolls_[layer].step_micros)
+      {
+        this->step_scroll(layer); 
+      }
+    }
+
     // change the next display character if there's an active incrementally-sending message 
-    this->step_incremental_display(); 
+    // (unless we're on a bus, which hands out the sending between all its displays itself) 
+    // (or the timer interrupt's doing it in the background) 
+    if (this->bus_ == NULL && this->background_slot_ == Seven_Segment_Background::NO_SLOT_)
+    {
+      this->step_incremental_display(); 
+    }
   }
 
-  if (this->override_birth_time_ == 0) // i.e., there's no active high-priority message
+  // a layer expiring or blinking changes what should be up as surely as a new message does 
+  if (this->layer_event_pending_ && 
+      (long)(this->most_recently_seen_external_time_ - this->next_layer_event_micros_) >= 0)
   {
-    // push the normal message to the display
-    this->stage_message_for_sending(normal_display_message_); 
+    this->layers_changed_ = true; 
   }
-  else // i.e., there's an active high-priority message 
-  {
-    // check for override expiration 
-    if ((unsigned long)(this->most_recently_seen_external_time_ - this->override_birth_time_) > this->override_lifespan_micros_) // i.e. the high-priorty message just "died" (expired) 
-    {
-      // render the lifespan invalid so we don't go through these checks unnecessarily 
-      this->override_lifespan_micros_ = 0; 
 
-      // reset the start time, too 
-      this->override_birth_time_      = 0; 
+  // only rebuild what should be up when something's changed, so more layers don't make every tick dearer 
+  if (this->layers_changed_)
+  {
+    this->composite_layers(); 
+  }
 
-      // push the normal message to the display
-      this->stage_message_for_sending(normal_display_message_); 
-    }
-    else // i.e., the override message hasn't expired 
-    {
-      // push the override message to the display
-      this->stage_message_for_sending(override_display_message_);  
-    }   
+  // in the background, whatever should be up goes out as a whole frame 
+  if (this->background_slot_ != Seven_Segment_Background::NO_SLOT_)
+  {
+    this->stage_background_frame(); 
   }
 }
 
@@ -102,70 +162,130 @@ void Seven_Segment_Display::tick(unsigned long current_time_micros)
   //    boolean will_override           - if true, this message "takes priority" and shows instead of any other future non-override message for 
   //                                      a length of time equal to override_duration_micros, upon which the most recent non-priority message 
   //                                      displays again
-  //    unsigned long loop_speed_micros - the length for which the given message has override priority. Meaningless if will_override is false.  
-  //    boolean looping_enabled         - if true, the contents of data will "scroll" across the display instead of being shown statically. 
+  //    unsigned long override_duration_micros - the length for which the given message has override priority. Meaningless if will_override is false.  
+  //    boolean looping_enabled         - if true, the contents of data will "scroll" across the display instead of being shown statically 
+  //                                      (and can be up to MAX_SCROLL_LENGTH_ characters long). 
   //    boolean loop_direction_r_to_l   - controls direction of the scroll, right to left if true, left to right if false 
   //    unsigned long loop_speed_micros - controls the speed of the scrolling, in microseconds. 
 void Seven_Segment_Display::set_display_contents( String        data                    , 
                                                   boolean       clock_points            , // default value false
                                                   boolean       will_override           , // default value false
                                                   unsigned long override_duration_micros, // default value 1,000,000 (one second)
-                                                  boolean       looping_enabled         , // default value false                        currently no-op
-                                                  boolean       loop_direction_r_to_l   , // default value true                         currently no-op
-                                                  unsigned long loop_speed_micros         // default value 1,000,000 (one second)       currently no-op
+                                                  boolean       looping_enabled         , // default value false
+                                                  boolean       loop_direction_r_to_l   , // default value true
+                                                  unsigned long loop_speed_micros         // default value 1,000,000 (one second)
                                                 )
 {   
-  uint8_t message_length = data.length() < this->DISPLAY_SIZE_ ? data.length() : this->DISPLAY_SIZE_;  // TODO TODO what happens if data's too short???
+  this->set_display_characters(data.c_str(), data.length() < this->MAX_SCROLL_LENGTH_ ? data.length() : this->MAX_SCROLL_LENGTH_, 
+                               clock_points, will_override, override_duration_micros, 
+                               looping_enabled, loop_direction_r_to_l, loop_speed_micros); 
+}
 
-  if (will_override) // if this is a priority message 
-  {    
-    // clear the message to prevent lingering characters if a short message follows a long one  
-    this->clear_override_display_message();
-    
-    // update the priority message holder 
-    for (uint8_t i = 0; i < message_length; i++)
-    {
-      // add in the clock points marker if need be 
-      if (clock_points)
-      {
-        this->override_display_message_[i] = this->get_display_code_for_character(data[i]) + CLOCK_POINTS_DATA_FLAG_;
-      }
-      else
-      {
-        this->override_display_message_[i] = this->get_display_code_for_character(data[i]);
-      }
-    }
+// As above, but without an Arduino String (and so without touching the heap)
+//    const char* data - a NUL-terminated C string; only the first DISPLAY_SIZE_ characters are used (MAX_SCROLL_LENGTH_, if looping) 
+void Seven_Segment_Display::set_display_contents( const char*   data                    , 
+                                                  boolean       clock_points            , // default value false
+                                                  boolean       will_override           , // default value false
+                                                  unsigned long override_duration_micros, // default value 1,000,000 (one second)
+                                                  boolean       looping_enabled         , // default value false
+                                                  boolean       loop_direction_r_to_l   , // default value true
+                                                  unsigned long loop_speed_micros         // default value 1,000,000 (one second)
+                                                )
+{
+  if (looping_enabled)
+  {
+    uint8_t length = encode_string(data, this->get_scroll_segments(will_override), this->MAX_SCROLL_LENGTH_); 
+    this->start_scroll(length, clock_points, will_override, override_duration_micros, loop_direction_r_to_l, loop_speed_micros); 
+    return; 
+  }
 
-    // set the lifespan
-    this->override_lifespan_micros_ = override_duration_micros; 
+  uint8_t segments[DISPLAY_SIZE_]; 
+  encode_string(data, segments, DISPLAY_SIZE_); 
 
-    // zero the age (it just got born!) 
-    this->override_birth_time_      = this->most_recently_seen_external_time_;
-   
+  this->store_message(segments, clock_points, will_override, override_duration_micros); 
+}
+
+// As above, but pre-encoded; one seven-segment byte per digit, leftmost first 
+//    const uint8_t segments[] - DISPLAY_SIZE_ segment bytes 
+void Seven_Segment_Display::set_display_contents( const uint8_t segments[]              , 
+                                                  boolean       clock_points            , // default value false
+                                                  boolean       will_override           , // default value false
+                                                  unsigned long override_duration_micros, // default value 1,000,000 (one second)
+                                                  boolean       looping_enabled         , // default value false
+                                                  boolean       loop_direction_r_to_l   , // default value true
+                                                  unsigned long loop_speed_micros         // default value 1,000,000 (one second)
+                                                )
+{
+  if (looping_enabled)
+  {
+    memcpy(this->get_scroll_segments(will_override), segments, DISPLAY_SIZE_); 
+    this->start_scroll(DISPLAY_SIZE_, clock_points, will_override, override_duration_micros, loop_direction_r_to_l, loop_speed_micros); 
+    return; 
   }
-  else // just a normal message 
-  {    
-    // clear the message to prevent lingering characters if a short message follows a long one  
-    this->clear_normal_display_message();
-    
-    // update the normal message holder 
-    for (uint8_t i = 0; i < message_length; i++)
+
+  this->store_message(segments, clock_points, will_override, override_duration_micros); 
+}
+
+// As above, but for characters that aren't NUL-terminated 
+//    const char* data   - the characters to be shown 
+//    uint8_t     length - how many of them; anything past DISPLAY_SIZE_ is ignored (MAX_SCROLL_LENGTH_, if looping) 
+void Seven_Segment_Display::set_display_characters( const char*   data                    , 
+                                                    uint8_t       length                  , 
+                                                    boolean       clock_points            , // default value false
+                                                    boolean       will_override           , // default value false
+                                                    unsigned long override_duration_micros, // default value 1,000,000 (one second)
+                                                    boolean       looping_enabled         , // default value false
+                                                    boolean       loop_direction_r_to_l   , // default value true
+                                                    unsigned long loop_speed_micros         // default value 1,000,000 (one second)
+                                                  )
+{
+  // the whole message gets encoded once, up front; scrolling it is then just moving a window along 
+  if (looping_enabled)
+  {
+    if (length > this->MAX_SCROLL_LENGTH_) length = this->MAX_SCROLL_LENGTH_; 
+
+    uint8_t* scroll_segments = this->get_scroll_segments(will_override); 
+    for (uint8_t i = 0; i < length; i++)
     {
-      // add in the clock points marker if need be 
-      if (clock_points)
-      {
-        this->normal_display_message_[i] = this->get_display_code_for_character(data[i]) + CLOCK_POINTS_DATA_FLAG_;
-      }
-      else
-      {
-        this->normal_display_message_[i] = this->get_display_code_for_character(data[i]);
-      }
+      scroll_segments[i] = get_display_code_for_character(data[i]); 
     }
+
+    this->start_scroll(length, clock_points, will_override, override_duration_micros, loop_direction_r_to_l, loop_speed_micros); 
+    return; 
   }
 
-  // update everything through the one central update channel 
-  // (with no time passage - we're just updating)
-  this->tick(0); 
+  // blank anything a short message doesn't reach, so nothing lingers from a longer one 
+  uint8_t segments[DISPLAY_SIZE_] = {0x00,0x00,0x00,0x00}; 
+
+  for (uint8_t i = 0; i < length && i < this->DISPLAY_SIZE_; i++)
+  {
+    segments[i] = get_display_code_for_character(data[i]); 
+  }
+
+  this->store_message(segments, clock_points, will_override, override_duration_micros); 
+}
+
+// Encodes a NUL-terminated string into segment bytes in one pass, blanking whatever's left of the buffer after 
+// the string ends; returns how many characters were encoded 
+//    const char* data           - the string 
+//    uint8_t     segments[]     - where the segment bytes go 
+//    uint8_t     segment_count  - how big segments is 
+uint8_t Seven_Segment_Display::encode_string(const char* data, uint8_t segments[], uint8_t segment_count)
+{
+  uint8_t encoded = 0; 
+
+  while (encoded < segment_count && data[encoded] != '\0')
+  {
+    segments[encoded] = get_display_code_for_character(data[encoded]); 
+    encoded++; 
+  }
+
+  for (uint8_t i = encoded; i < segment_count; i++)
+  {
+    segments[i] = 0x00; 
+  }
+
+  return encoded; 
 }
 
 // Sets the brightness of the display
@@ -179,12 +299,89 @@ void Seven_Segment_Display::set_brightness(uint8_t level)
   // calculate the correct brightness code 
   this->brightness_bit_ = this->BRIGHTNESS_BASE_ + level;
 
-  // send that brightess level immediately 
-  // TODO will cause problems with current incremental send strategy if 
-  //      there's a half-sent message out there already
-  this->send_signal_start();
-  this->writeByte(this->brightness_bit_);
-  this->send_signal_stop();
+  // it goes out in turn with everything else, so it can't land in the middle of a half-sent message 
+  this->queue_command(this->get_display_control_command()); 
+}
+
+
+// Turns the display on or off (what's on it is kept either way) 
+void Seven_Segment_Display::set_display_on(bool on)
+{
+  this->display_on_ = on; 
+
+  this->queue_command(this->get_display_control_command()); 
+}
+
+
+// Resends everything: the data command and every digit 
+void Seven_Segment_Display::refresh()
+{
+  this->data_command_sent_ = false; 
+  this->dirty_digits_      = ALL_DIGITS_DIRTY_; 
+  this->background_resend_ = true; 
+  this->send_generation_++; 
+}
+
+
+// Swaps the incremental sender for another, which the display then owns 
+//    Seven_Segment_Transfer* transfer - the new sender, allocated with new 
+void Seven_Segment_Display::use_transfer(Seven_Segment_Transfer* transfer)
+{
+  if (transfer == NULL || transfer == this->transfer_) return; 
+
+  // a transaction cut off partway leaves the display in no state we can be sure of 
+  if (!this->transfer_->is_idle())
+  {
+    this->transaction_in_flight_ = IN_FLIGHT_NOTHING; 
+    this->refresh(); 
+  }
+
+  delete this->transfer_; 
+  this->transfer_ = transfer; 
+}
+
+
+// Hands this display's sending over to Seven_Segment_Background, after which tick() only stages whole frames 
+// for its interrupt to send; returns false if it couldn't 
+bool Seven_Segment_Display::send_in_background()
+{
+  if (this->bus_ != NULL || this->background_slot_ != Seven_Segment_Background::NO_SLOT_)
+  {
+    return false; 
+  }
+
+  this->background_slot_   = Seven_Segment_Background::add_transfer(this->transfer_); 
+  this->background_resend_ = true; 
+
+  return this->background_slot_ != Seven_Segment_Background::NO_SLOT_; 
+}
+
+
+// Sets how many units (starts, bits, stops) of a pending transaction each tick() may send
+void Seven_Segment_Display::set_transfer_units_per_tick(uint8_t units)
+{
+  // zero would never finish anything 
+  this->transfer_units_per_tick_ = (units == 0) ? 1 : units; 
+}
+
+
+// Returns a copy of the bus traffic accounting for this display 
+Seven_Segment_Display::bus_statistics Seven_Segment_Display::get_bus_statistics()
+{
+  return this->bus_statistics_; 
+}
+
+
+// Zeroes the bus traffic accounting for this display 
+void Seven_Segment_Display::reset_bus_statistics()
+{
+  this->bus_statistics_.bytes_sent                   = 0; 
+  this->bus_statistics_.start_stop_pairs             = 0; 
+  this->bus_statistics_.ack_waits                    = 0; 
+  this->bus_statistics_.ack_failures                 = 0; 
+  this->bus_statistics_.updates_latched              = 0; 
+  this->bus_statistics_.last_time_to_visible_micros  = 0; 
+  this->bus_statistics_.worst_time_to_visible_micros = 0; 
 }
 
 
@@ -192,109 +389,255 @@ void Seven_Segment_Display::set_brightness(uint8_t level)
 //  private methods 
 //
 
-// helper method to zero out display storage
-void Seven_Segment_Display::clear_normal_display_message()
+// helper method; files a message away as the normal or priority one, then updates 
+void Seven_Segment_Display::store_message(const uint8_t segments[], boolean clock_points, boolean will_override, unsigned long override_duration_micros)
+{
+  // the ":" rides along on every character 
+  uint8_t points_flag = clock_points ? CLOCK_POINTS_DATA_FLAG_ : 0x00; 
+  uint8_t message[DISPLAY_SIZE_]; 
+
+  for (uint8_t i = 0; i < this->DISPLAY_SIZE_; i++)
+  {
+    message[i] = segments[i] | points_flag; 
+  }
+
+  if (will_override) // if this is a priority message 
+  {
+    // a zero lifespan on a layer means forever, which a zero-length priority message certainly didn't mean 
+    this->set_layer_contents(LAYER_OVERRIDE, message, override_duration_micros == 0 ? 1 : override_duration_micros); 
+  }
+  else // just a normal message 
+  {
+    this->set_layer_contents(LAYER_NORMAL, message); 
+  }
+}
+
+
+// helper method; where a scrolling message for the normal or priority layer gets encoded, before start_scroll() 
+uint8_t* Seven_Segment_Display::get_scroll_segments(boolean will_override)
+{
+  return this->scrolls_[will_override ? LAYER_OVERRIDE : LAYER_NORMAL].segments; 
+}
+
+
+// helper method; puts up the start of the message now in get_scroll_segments() and sets it scrolling 
+void Seven_Segment_Display::start_scroll(uint8_t length, boolean clock_points, boolean will_override, unsigned long override_duration_micros, 
+                                         boolean direction_r_to_l, unsigned long step_micros)
+{
+  uint8_t          layer  = will_override ? LAYER_OVERRIDE : LAYER_NORMAL; 
+  scroll_contents& scroll = this->scrolls_[layer]; 
+
+  scroll.length           = length; 
+  scroll.offset           = 0; 
+  scroll.r_to_l           = direction_r_to_l; 
+  scroll.step_micros      = step_micros; 
+  scroll.last_step_micros = this->most_recently_seen_external_time_; 
+
+  // the first window goes up like any other message (which also clears out whatever was scrolling there before) 
+  uint8_t window[DISPLAY_SIZE_]; 
+  this->fill_scroll_window(layer, window); 
+  this->store_message(window, clock_points, will_override, override_duration_micros); 
+
+  scroll.points_flag      = clock_points ? CLOCK_POINTS_DATA_FLAG_ : 0x00; 
+  scroll.active           = true; 
+}
+
+
+// helper method; moves a layer's scrolling message along one character; the digits that change get picked up as 
+// dirty by the next staging, same as for any other change 
+void Seven_Segment_Display::step_scroll(uint8_t layer)
+{
+  scroll_contents& scroll = this->scrolls_[layer]; 
+  uint8_t          period = scroll.length + this->DISPLAY_SIZE_; 
+
+  if (scroll.r_to_l) scroll.offset = (scroll.offset + 1 == period) ? 0          : scroll.offset + 1; 
+  else               scroll.offset = (scroll.offset     == 0     ) ? period - 1 : scroll.offset - 1; 
+
+  scroll.last_step_micros = this->most_recently_seen_external_time_; 
+
+  uint8_t* message = this->layers_[layer].segments; 
+  this->fill_scroll_window(layer, message); 
+
+  for (uint8_t i = 0; i < this->DISPLAY_SIZE_; i++)
+  {
+    message[i] |= scroll.points_flag; 
+  }
+
+  this->layers_changed_ = true; 
+}
+
+
+// helper method; stops a layer's message scrolling, if it was (a new message, or the layer going away) 
+void Seven_Segment_Display::stop_scroll(uint8_t layer)
+{
+  if (layer < SCROLL_LAYER_COUNT_) this->scrolls_[layer].active = false; 
+}
+
+
+// helper method; copies what's currently in view of a layer's scrolling message out, a display's worth of blank 
+// separating its end from its next start 
+void Seven_Segment_Display::fill_scroll_window(uint8_t layer, uint8_t window[])
+{
+  const scroll_contents& scroll   = this->scrolls_[layer]; 
+  uint8_t                period   = scroll.length + this->DISPLAY_SIZE_; 
+  uint8_t                position = scroll.offset; 
+
+  for (uint8_t i = 0; i < this->DISPLAY_SIZE_; i++)
+  {
+    window[i] = (position < scroll.length) ? scroll.segments[position] : 0x00; 
+
+    position++; 
+    if (position == period) position = 0; 
+  }
+}
+
+
+// Puts a message up on one layer of the display; whatever's on a higher layer covers whatever's below it, 
+// but only on the segments that layer's masks say it covers 
+//    uint8_t       layer                  - which layer (see message_layer) 
+//    const uint8_t segments[]             - DISPLAY_SIZE_ segment bytes, leftmost first 
+//    unsigned long lifespan_micros        - how long before the layer clears itself; 0 is until replaced or cleared 
+//    const uint8_t segment_masks[]        - per digit, which segments this layer covers; NULL is all of them 
+//    unsigned long blink_period_micros    - if nonzero, the layer shows for half of each period and is see-through 
+//                                           for the other half 
+void Seven_Segment_Display::set_layer_contents(uint8_t layer, const uint8_t segments[], unsigned long lifespan_micros, 
+                                               const uint8_t segment_masks[], unsigned long blink_period_micros)
+{
+  if (layer >= LAYER_COUNT_) return; 
+
+  layer_contents& contents = this->layers_[layer]; 
+
+  for (uint8_t i = 0; i < this->DISPLAY_SIZE_; i++)
+  {
+    contents.segments[i] = segments[i]; 
+    contents.masks[i]    = (segment_masks == NULL) ? 0xFF : segment_masks[i]; 
+  }
+
+  // the normal layer is the backdrop for everything else, so it never goes away 
+  contents.active              = true; 
+  contents.lifespan_micros     = (layer == LAYER_NORMAL) ? 0 : lifespan_micros; 
+  contents.blink_period_micros = blink_period_micros; 
+
+  // zero the age (it just got born!) 
+  contents.birth_micros        = this->most_recently_seen_external_time_; 
+
+  // a new message replaces anything that was scrolling in its place 
+  this->stop_scroll(layer); 
+
+  // update everything through the one central update channel 
+  // (with no time passage - we're just updating)
+  this->layers_changed_ = true; 
+  this->tick(0); 
+}
+
+
+// Takes a layer's message down (the normal layer just goes blank) 
+void Seven_Segment_Display::clear_layer(uint8_t layer)
 {
-  for (uint8_t i = 0; i < sizeof(this->normal_display_message_)/sizeof(uint8_t); i++)
+  if (layer >= LAYER_COUNT_) return; 
+
+  if (layer == LAYER_NORMAL)
   {
-    this->normal_display_message_[i] = 0x00; 
+    uint8_t blank[DISPLAY_SIZE_] = {0x00,0x00,0x00,0x00}; 
+    this->set_layer_contents(LAYER_NORMAL, blank); 
+    return; 
   }
+
+  this->layers_[layer].active = false; 
+  this->stop_scroll(layer); 
+
+  this->layers_changed_ = true; 
+  this->tick(0); 
+}
+
+
+// Whether a change to what should be up hasn't finished going out to the display yet 
+bool Seven_Segment_Display::is_update_pending()
+{
+  return this->update_pending_; 
+}
+
+
+// Whether the display stopped answering, and hasn't answered since 
+bool Seven_Segment_Display::is_degraded()
+{
+  return this->degraded_; 
 }
 
 
-// helper method to zero out override display storage
-void Seven_Segment_Display::clear_override_display_message()
+// helper method; builds what should be up from the layers and stages it, noting when that next needs doing 
+void Seven_Segment_Display::composite_layers()
 {
-  for (uint8_t i = 0; i < sizeof(this->override_display_message_)/sizeof(uint8_t); i++)
+  unsigned long now = this->most_recently_seen_external_time_; 
+  uint8_t composite[DISPLAY_SIZE_] = {0x00,0x00,0x00,0x00}; 
+
+  this->layers_changed_      = false; 
+  this->layer_event_pending_ = false; 
+
+  // bottom up, each layer covering the segments it owns 
+  for (uint8_t layer = 0; layer < LAYER_COUNT_; layer++)
   {
-    this->override_display_message_[i] = 0x00; 
+    layer_contents& contents = this->layers_[layer]; 
+
+    if (!contents.active) continue; 
+
+    unsigned long age = now - contents.birth_micros; 
+
+    if (contents.lifespan_micros != 0)
+    {
+      if (age > contents.lifespan_micros) // i.e. this layer's message just "died" (expired) 
+      {
+        contents.active = false; 
+
+        // a scrolling message dies with it 
+        this->stop_scroll(layer); 
+
+        continue; 
+      }
+
+      this->note_layer_event(contents.birth_micros + contents.lifespan_micros + 1); 
+    }
+
+    // blinking layers are see-through for the second half of every period 
+    if (contents.blink_period_micros != 0)
+    {
+      unsigned long half_period = (contents.blink_period_micros > 1) ? contents.blink_period_micros / 2 : 1; 
+      unsigned long half_cycles = age / half_period; 
+
+      this->note_layer_event(contents.birth_micros + (half_cycles + 1) * half_period); 
+
+      if (half_cycles & 0x01) continue; 
+    }
+
+    for (uint8_t i = 0; i < this->DISPLAY_SIZE_; i++)
+    {
+      composite[i] = (composite[i] & ~contents.masks[i]) | (contents.segments[i] & contents.masks[i]); 
+    }
+  }
+
+  this->stage_message_for_sending(composite); 
+}
+
+
+// helper method; brings the next time the layers need compositing forward to the given one, if it's sooner 
+void Seven_Segment_Display::note_layer_event(unsigned long event_micros)
+{
+  unsigned long now = this->most_recently_seen_external_time_; 
+
+  if (!this->layer_event_pending_ || 
+      (unsigned long)(event_micros - now) < (unsigned long)(this->next_layer_event_micros_ - now))
+  {
+    this->layer_event_pending_     = true; 
+    this->next_layer_event_micros_ = event_micros; 
   }
 }
 
 
 // helper method - translates characters to their seven-segment display byte equivalent, if one exists  
-// TODO: incomplete by a lot 
+// (anything past 7-bit ASCII wraps around into it; nothing the box sends ever gets there) 
 uint8_t Seven_Segment_Display::get_display_code_for_character(char character)
 {
-  uint8_t return_val = 0x00; 
-
-  // retrieve the appropriate seven-segment display numeric code for the alpha-numeric potential character 
-  switch (character)
-  {
-    case '0':
-    case 'o':
-    case 'O':
-      return_val = 0x3f;
-      break;
-    case '1':
-    case 'i':
-    case 'I':
-      return_val = 0x06;
-      break;
-    case '2':
-      return_val = 0x5b;
-      break;
-    case '3':
-      return_val = 0x4f;
-      break;
-    case '4':
-      return_val = 0x66;
-      break;
-    case '5':
-    case 'S':
-    case 's':
-      return_val = 0x6d;
-      break;
-    case '6':
-      return_val = 0x7d;
-      break;
-    case '7':
-      return_val = 0x07;
-      break;
-    case '8':
-    case 'B':
-      return_val = 0x7f;
-      break;
-    case '9':
-      return_val = 0x6f;
-      break;
-    case 'a':
-    case 'A':
-    case 'R':
-      return_val = 0x77;
-      break;
-    case 'b':
-      return_val = 0x7c;
-      break;
-    case 'c':
-    case 'C':
-      return_val = 0x39;
-      break;
-    case 'd':
-    case 'D':
-      return_val = 0x5e;
-      break;
-    case 'e':
-    case 'E':
-      return_val = 0x79;
-      break;
-    case 'f':
-    case 'F':
-      return_val = 0x71;
-      break;
-    case 'l':
-    case 'L':
-      return_val = 0b0111000;
-      break;
-    case 'p':
-    case 'P':
-      return_val = 0b1110011;
-      break;
-    default:
-      return_val = 0x00;
-  }
-
-  return return_val; 
+  return pgm_read_byte(&SEGMENT_FONT_[(uint8_t)character & 0x7F]); 
 }
 
 // helper method; checks for and prepares any new values for sending; ignores the request if redundant
@@ -306,111 +649,262 @@ void Seven_Segment_Display::stage_message_for_sending(uint8_t contents_to_displa
     if (this->new_message_to_be_displayed_[i] != contents_to_display[i])
     {
       this->new_message_to_be_displayed_[i] = contents_to_display[i]; 
-      
-      // only mark that there's a new message to deal with if any differences are actually found
-      this->new_message_waiting_for_send_begin_ = true; 
+      this->send_generation_++; 
+
+      // start the time-to-visible clock, unless it's already running for an earlier change that hasn't landed yet 
+      if (!this->update_pending_)
+      {
+        this->update_pending_              = true; 
+        this->update_pending_since_micros_ = this->most_recently_seen_external_time_; 
+      }
+
+      // only digits that differ from what's actually up need sending (a change back to what's up needs nothing) 
+      if (this->new_message_to_be_displayed_[i] != this->current_display_contents_[i])
+      {
+        this->dirty_digits_ |=  (1 << i); 
+      }
+      else
+      {
+        this->dirty_digits_ &= ~(1 << i); 
+      }
+    }
+  }
+}
+
+// sends a little more of the pending changes; only changed digits go out, nearby ones in a single burst;
+// returns false if there was nothing to send 
+bool Seven_Segment_Display::step_incremental_display()
+{
+  // a display that's stopped answering only gets the odd retry 
+  if (this->transfer_->is_idle() && this->in_retry_backoff())
+  {
+    return false; 
+  }
+
+  // start on the next transaction if the last one's done 
+  if (this->transfer_->is_idle())
+  {
+    Seven_Segment_Transfer::transaction next; 
+
+    if (!this->build_next_transaction(next))
+    {
+      // nothing to send; a change that got undone before it went out has still "landed", though 
+      this->note_update_latched(); 
+      return false; 
     }
+
+    this->transfer_->begin(next); 
+  }
+
+  // send a bounded little bit of it 
+  if (this->transfer_->step(this->transfer_units_per_tick_))
+  {
+    this->complete_transaction(this->transfer_->get_transaction()); 
   }
+
+  return true; 
+}
+
+
+// helper method; fills in the next transaction that needs sending, if any; returns false if there's nothing to send 
+bool Seven_Segment_Display::build_next_transaction(Seven_Segment_Transfer::transaction& next)
+{
+  // queued commands go first; they're one byte apiece 
+  if (this->command_count_ > 0)
+  {
+    next.bytes[0]                = this->command_queue_[this->command_head_]; 
+    next.length                  = 1; 
+    this->transaction_in_flight_ = IN_FLIGHT_COMMAND; 
+    return true; 
+  }
+
+  if (this->dirty_digits_ == 0)
+  {
+    this->transaction_in_flight_ = IN_FLIGHT_NOTHING; 
+    return false; 
+  }
+
+  // the data command only needs to go out once 
+  if (!this->data_command_sent_)
+  {
+    next.bytes[0]                = this->ADDR_AUTO_; 
+    next.length                  = 1; 
+    this->transaction_in_flight_ = IN_FLIGHT_DATA_COMMAND; 
+    return true; 
+  }
+
+  // the burst: the starting address, then each value, which the display files one address further along 
+  this->plan_next_burst(); 
+
+  next.bytes[0] = this->burst_start_ | this->CMD_SET_ADDR_; 
+  for (uint8_t i = 0; i < this->burst_length_; i++)
+  {
+    next.bytes[i + 1] = this->burst_bytes_[i]; 
+  }
+  next.length                  = this->burst_length_ + 1; 
+  this->transaction_in_flight_ = IN_FLIGHT_DIGITS; 
+
+  return true; 
+}
+
+
+// helper method; does the bookkeeping for a transaction that just finished sending 
+void Seven_Segment_Display::complete_transaction(const Seven_Segment_Transfer::transaction& completed)
+{
+  // whatever happened, what's next has moved on 
+  this->send_generation_++; 
+
+  // accounting 
+  this->bus_statistics_.bytes_sent       += completed.length; 
+  this->bus_statistics_.start_stop_pairs += 1; 
+  this->bus_statistics_.ack_waits        += completed.ack_polls; 
+
+  if (!completed.acknowledged)
+  {
+    this->transaction_in_flight_ = IN_FLIGHT_NOTHING; 
+    this->note_transfer_failure(); 
+    return; 
+  }
+
+  // it's answering (again) 
+  this->degraded_             = false; 
+  this->retry_backoff_micros_ = FIRST_RETRY_BACKOFF_MICROS_; 
+
+  if      (this->transaction_in_flight_ == IN_FLIGHT_COMMAND     ) this->pop_command(); 
+  else if (this->transaction_in_flight_ == IN_FLIGHT_DATA_COMMAND) this->data_command_sent_ = true; 
+  else if (this->transaction_in_flight_ == IN_FLIGHT_DIGITS      ) this->finish_burst(); 
+
+  this->transaction_in_flight_ = IN_FLIGHT_NOTHING; 
 }
 
-// performs next step in sending of pending message; does redundancy checking 
-void Seven_Segment_Display::step_incremental_display()
+
+// helper method; picks the next run of changed digits to send and snapshots their values 
+void Seven_Segment_Display::plan_next_burst()
 {
-  // this part's pretty hardcoded, but I'm TRYING to avoid as many magic numbers as possible 
-  const uint8_t STEPS_IN_CHANGING_ONE_VALUE = 8; 
+  // start at the leftmost changed digit 
+  uint8_t first = 0; 
+  while (!(this->dirty_digits_ & (1 << first)))
+  {
+    first++; 
+  }
+
+  // and carry on through any later changed digits, bridging single unchanged ones, since resending one 
+  // digit's byte is cheaper than a second start / address / stop 
+  uint8_t last = first; 
+  for (uint8_t i = first + 1; i < this->DISPLAY_SIZE_ && i - last <= 2; i++)
+  {
+    if (this->dirty_digits_ & (1 << i))
+    {
+      last = i; 
+    }
+  }
+
+  this->burst_start_    = first; 
+  this->burst_length_   = last - first + 1; 
+  for (uint8_t i = 0; i < this->burst_length_; i++)
+  {
+    this->burst_bytes_[i] = this->new_message_to_be_displayed_[first + i]; 
+  }
+}
 
-  // figure out where we are in the process 
-  uint8_t current_index               = this->incremental_display_step_ / STEPS_IN_CHANGING_ONE_VALUE; 
-  uint8_t current_step_for_this_index = this->incremental_display_step_ % STEPS_IN_CHANGING_ONE_VALUE; 
 
-  // make sure new messages can get examined even if the old message is already finished sending; save time if we're already done otherwise  
-  if (!(current_index < this->DISPLAY_SIZE_))       // if you're past an end, therefore finished sending a message and just waiting around...
+// helper method; notes that the burst just sent is now up on the display 
+void Seven_Segment_Display::finish_burst()
+{
+  for (uint8_t i = 0; i < this->burst_length_; i++)
   {
-    if (this->new_message_waiting_for_send_begin_)  // if there's a new message waiting to be sent...
+    uint8_t index = this->burst_start_ + i; 
+
+    this->current_display_contents_[index] = this->burst_bytes_[i]; 
+
+    // still dirty if it changed again while the burst was going out 
+    if (this->new_message_to_be_displayed_[index] != this->current_display_contents_[index])
     {
-      current_step_for_this_index = 0;              // make sure that it gets evaluated 
+      this->dirty_digits_ |=  (1 << index); 
     }
     else
     {
-      return;                                       // just leave to save time 
+      this->dirty_digits_ &= ~(1 << index); 
     }
   }
 
-  // figure out and take the next step of the message updating process 
-  switch (current_step_for_this_index)
+  // if that was the last of it, the whole message is up 
+  if (this->dirty_digits_ == 0)
   {
-    case 0:
+    this->note_update_latched(); 
+  }
+}
 
-      // need to reset if there's a new message waiting, but
-      // only here, when we're not in the middle of sending
-      // a value 
-      if (this->new_message_waiting_for_send_begin_)
-      {
-        current_index                             = 0;  
-        this->incremental_display_step_           = 0; 
-        this->new_message_waiting_for_send_begin_ = false; 
-      }
 
-      /*
-      TODO TODO TODO 
-      while ( 
-              (this->new_message_to_be_displayed_[current_index] == this->current_display_contents_[current_index]) && // while a value's ALREADY being displayed...
-              !(current_index < this->DISPLAY_SIZE_)                                                                   // AND we haven't violated the length of the arrays...
-            ) 
-      {
-        // increment both the current index and the display step 
-        current_index++; 
-        this->incremental_display_step_ += STEPS_IN_CHANGING_ONE_VALUE; 
-      }
+// helper method; notes the display didn't answer, and arranges to try again (everything) later 
+void Seven_Segment_Display::note_transfer_failure()
+{
+  this->bus_statistics_.ack_failures++; 
 
-      */
+  // back off further every time it still isn't answering 
+  if (this->degraded_)
+  {
+    this->retry_backoff_micros_ = (this->retry_backoff_micros_ >= MAX_RETRY_BACKOFF_MICROS_ / 2) ? MAX_RETRY_BACKOFF_MICROS_ : this->retry_backoff_micros_ * 2; 
+  }
+  this->degraded_           = true; 
+  this->retry_after_micros_ = this->most_recently_seen_external_time_ + this->retry_backoff_micros_; 
 
-      
-      break;  
-    
-    // steps to send the preamble command 
-    case 1:
-      this->send_signal_start(); 
-      break;
-    case 2:
-      this->writeByte(this->ADDR_FIXED_); 
-      break;
-    case 3:
-      this->send_signal_stop();
-      break;
-
-    // steps to send one value to the specified index 
-    case 4:
-      this->send_signal_start(); 
-      break;
-    case 5:
-      this->writeByte(current_index | this->CMD_SET_ADDR_); 
-      break;
-    case 6:
-      this->writeByte(this->new_message_to_be_displayed_[current_index]);
-      break;
-    case 7:
-      this->send_signal_stop();
-      // since this value is finished, note that it's been changed 
-      this->current_display_contents_[current_index] = this->new_message_to_be_displayed_[current_index]; 
-      break;
-    
-
-    // catch-all; shouldn't happen 
-    default:
-      bool we_have_an_uh_oh = true; // TODO actually raise an error or crash or something 
-      // should not be able to reach this 
+  // there's no telling what it did or didn't take in (or whether it's been power cycled), so once it's answering 
+  // again it gets the lot: its brightness / on-off state, the data command and every digit 
+  this->command_count_      = 0; 
+  this->queue_command(this->get_display_control_command()); 
+  this->refresh(); 
+}
+
+
+// helper method; adds a command byte to the back of the queue (if it's full, the newest replaces the last one in 
+// line; commands are all "be in this state now" ones, so the latest is the one that matters) 
+void Seven_Segment_Display::queue_command(uint8_t command)
+{
+  if (this->command_count_ == COMMAND_QUEUE_SIZE_)
+  {
+    this->command_count_--; 
   }
-  
-  // move on to the next stage in the process 
-  this->incremental_display_step_++; 
+
+  this->command_queue_[(this->command_head_ + this->command_count_) % COMMAND_QUEUE_SIZE_] = command; 
+  this->command_count_++; 
+  this->send_generation_++; 
+}
+
+
+// helper method; drops the command at the front of the queue, now that it's been sent 
+void Seven_Segment_Display::pop_command()
+{
+  if (this->command_count_ > 0)
+  {
+    this->command_head_ = (this->command_head_ + 1) % COMMAND_QUEUE_SIZE_; 
+    this->command_count_--; 
+  }
+}
+
+
+// helper method; the TM1637 display control command for the current brightness and on/off state 
+uint8_t Seven_Segment_Display::get_display_control_command()
+{
+  return this->display_on_ ? this->brightness_bit_ : (this->brightness_bit_ & ~DISPLAY_ON_FLAG_); 
+}
+
+
+// helper method; whether we're leaving an unanswering display alone for now 
+bool Seven_Segment_Display::in_retry_backoff()
+{
+  return this->degraded_ && (long)(this->most_recently_seen_external_time_ - this->retry_after_micros_) < 0; 
 }
 
 
-// helper method; writes a single byte to the TM1637 style Seven-Segment Display 
-void Seven_Segment_Display::writeByte(int8_t wr_data)
+// helper method; writes a single byte to the TM1637 style Seven-Segment Display; returns whether it was ACKed 
+bool Seven_Segment_Display::writeByte(int8_t wr_data)
 {
-  uint8_t i,count1;      
+  uint8_t i; 
+  bool    acked = false; 
+
+  // accounting 
+  this->bus_statistics_.bytes_sent++; 
 
   // send one byte of data
   for(i = 0; i < 8 ;i++)       
@@ -431,32 +925,37 @@ void Seven_Segment_Display::writeByte(int8_t wr_data)
   // NB: this block can be commented out wholesale with seemingly no effect, but it only saves
   // like 16 microseconds off the worse cases, so I'm leaving it in right now to be on the safe
   // side
+  // (a bounded few looks, same as the incremental sender; a missing display must not hang us here) 
   pinMode(     this->data_pin_ ,  INPUT);
-  while( digitalRead(this->data_pin_) )    
-  {
-    count1 +=1;
-    if(count1 == 200) // TODO what is this janky delay??? 
-    {      
-      pinMode(this->data_pin_,OUTPUT);
-      digitalWrite(this->data_pin_,LOW);
-      count1 =0;
-    }
-    pinMode(this->data_pin_,INPUT);
+  for (i = 0; i < Seven_Segment_Transfer::ACK_SAMPLES_ && !acked; i++)
+  {
+    if (digitalRead(this->data_pin_) == LOW) acked = true; 
+    else                                     this->bus_statistics_.ack_waits++; 
   }
   pinMode(this->data_pin_,OUTPUT);
 
+  if (!acked)
+  {
+    this->bus_statistics_.ack_failures++; 
+  }
+
  
   // gotta set this pin here to make interlacing commands possible
   //    My theory is that if you don't and you're sharing data pins like
   //    we are, the next time data goes high you accidentally start a 
   //    start command!
   digitalWrite(this->clock_pin_,  LOW);
+
+  return acked; 
 }
 
 
 // helper method; sends the "prepare to receive command / data" signal to the TM1637 style Seven-Segment Display
 void Seven_Segment_Display::send_signal_start()
 {
+  // accounting; every start gets a matching stop 
+  this->bus_statistics_.start_stop_pairs++; 
+
   // begin sending start signal to SSD
   digitalWrite(this->clock_pin_, HIGH);
   digitalWrite(this->data_pin_ , HIGH); 
@@ -478,6 +977,82 @@ void Seven_Segment_Display::send_signal_stop()
 }
 
 
+// helper method; stages what should be up for the background sender, if it's changed since last time, and 
+// notices when it's gone out (or been dropped for want of an ACK) 
+void Seven_Segment_Display::stage_background_frame()
+{
+  // look before asking about failures: a frame that fails in between then shows up as a failure, not as sent 
+  bool sending = Seven_Segment_Background::is_sending(this->background_slot_); 
+
+  // the interrupt drops a frame the display didn't ACK; back off just as tick() would, then stage it all again 
+  if (Seven_Segment_Background::take_failure(this->background_slot_))
+  {
+    this->note_transfer_failure(); 
+  }
+
+  // a display that's stopped answering only gets the odd retry 
+  if (this->in_retry_backoff())
+  {
+    return; 
+  }
+
+  uint8_t control = this->get_display_control_command(); 
+  bool    changed = this->background_resend_ || control != this->background_control_; 
+
+  for (uint8_t i = 0; i < this->DISPLAY_SIZE_; i++)
+  {
+    if (this->new_message_to_be_displayed_[i] != this->background_frame_[i])
+    {
+      this->background_frame_[i] = this->new_message_to_be_displayed_[i]; 
+      changed = true; 
+    }
+  }
+
+  if (changed)
+  {
+    this->background_control_ = control; 
+    this->background_resend_  = false; 
+    Seven_Segment_Background::stage_frame(this->background_slot_, this->background_frame_, control); 
+  }
+  else if (!sending)
+  {
+    // it's all out, so it's answering (again) 
+    this->degraded_             = false; 
+    this->retry_backoff_micros_ = FIRST_RETRY_BACKOFF_MICROS_; 
+
+    // the interrupt's been keeping the books on the bytes, so this is just the time-to-visible 
+    if (this->update_pending_)
+    {
+      for (uint8_t i = 0; i < this->DISPLAY_SIZE_; i++)
+      {
+        this->current_display_contents_[i] = this->background_frame_[i]; 
+      }
+      this->dirty_digits_ = 0; 
+      this->note_update_latched(); 
+    }
+  }
+}
+
+
+// helper method; records how long the message that just finished sending took to show up 
+void Seven_Segment_Display::note_update_latched()
+{
+  if (this->update_pending_)
+  {
+    unsigned long time_to_visible = (unsigned long)(this->most_recently_seen_external_time_ - this->update_pending_since_micros_); 
+
+    this->bus_statistics_.updates_latched++; 
+    this->bus_statistics_.last_time_to_visible_micros = time_to_visible; 
+    if (time_to_visible > this->bus_statistics_.worst_time_to_visible_micros)
+    {
+      this->bus_statistics_.worst_time_to_visible_micros = time_to_visible; 
+    }
+
+    this->update_pending_ = false; 
+  }
+}
+
+
 // DEPRECATED; one-shot method to send one value to a given index of the SSD
 void Seven_Segment_Display::change_single_value(uint8_t index, uint8_t new_value)
 {
@@ -30,6 +30,13 @@
 #include <inttypes.h>
 #include <Arduino.h>
 
+// local includes
+#include "Seven_Segment_Transfer.h"
+#include "Seven_Segment_Background.h"
+
+// forward declaration; the bus a display may share its data pin through
+class Seven_Segment_Bus;
+
 // A class to control a four-character, seven-segment display for a fencing control box
 class Seven_Segment_Display
 {
@@ -54,14 +61,15 @@ class Seven_Segment_Display
     void tick(unsigned long elapsed_micros); 
     
     // Sets what is shown on the display, and some details about how it is shown. 
-    //    std::string data                - the numbers or characters to be shown. The first character will display on the leftmost section, the next
+    //    String data                     - the numbers or characters to be shown. The first character will display on the leftmost section, the next
     //                                      on the next leftmost, and so on. 
     //    boolean clock_points            - controls whether the ":" is displayed or not 
     //    boolean will_override           - if true, this message "takes priority" and shows instead of any other future non-override message for 
     //                                      a length of time equal to override_duration_micros, upon which the most recent non-priority message 
     //                                      displays again
-    //    unsigned long loop_speed_micros - the length for which the given message has override priority. Meaningless if will_override is false.  
-    //    boolean looping_enabled         - if true, the contents of data will "scroll" across the display instead of being shown statically. 
+    //    unsigned long override_duration_micros - the length for which the given message has override priority. Meaningless if will_override is false.  
+    //    boolean looping_enabled         - if true, the contents of data will "scroll" across the display instead of being shown statically 
+    //                                      (and can be up to MAX_SCROLL_LENGTH_ characters long). One scrolling message per layer: a priority one scrolls over the normal one, which carries on underneath. 
     //    boolean loop_direction_r_to_l   - controls direction of the scroll, right to left if true, left to right if false 
     //    unsigned long loop_speed_micros - controls the speed of the scrolling, in microseconds. 
     void set_display_contents(  String        data                                , 
@@ -73,9 +81,121 @@ class Seven_Segment_Display
                                 unsigned long loop_speed_micros         = 1000000
                              );
 
-    // Sets the brightness of the display
+    // As above, but without an Arduino String (and so without touching the heap); these are what the box itself
+    // uses, since a String per update fragments the heap over a long day. 
+    //    const char* data                - a NUL-terminated C string; only the first DISPLAY_SIZE_ characters are 
+    //                                      used (MAX_SCROLL_LENGTH_, if looping), so a char[DISPLAY_SIZE_] with no 
+    //                                      room for a NUL is fine too 
+    void set_display_contents(  const char*   data                                , 
+                                boolean       clock_points              = false   ,
+                                boolean       will_override             = false   ,
+                                unsigned long override_duration_micros  = 1000000 ,
+                                boolean       looping_enabled           = false   , 
+                                boolean       loop_direction_r_to_l     = true    , 
+                                unsigned long loop_speed_micros         = 1000000
+                             );
+
+    // As above, but pre-encoded; one seven-segment byte per digit, leftmost first 
+    //    const uint8_t segments[]        - DISPLAY_SIZE_ segment bytes 
+    void set_display_contents(  const uint8_t segments[]                          , 
+                                boolean       clock_points              = false   ,
+                                boolean       will_override             = false   ,
+                                unsigned long override_duration_micros  = 1000000 ,
+                                boolean       looping_enabled           = false   , 
+                                boolean       loop_direction_r_to_l     = true    , 
+                                unsigned long loop_speed_micros         = 1000000
+                             );
+
+    // As above, but for characters that aren't NUL-terminated; a separate name, since a length and a 
+    // clock_points flag look too much alike to overload on 
+    //    const char* data                - the characters to be shown 
+    //    uint8_t     length              - how many of them; anything past DISPLAY_SIZE_ (MAX_SCROLL_LENGTH_, if looping) is ignored 
+    void set_display_characters(const char*   data                                , 
+                                uint8_t       length                              , 
+                                boolean       clock_points              = false   ,
+                                boolean       will_override             = false   ,
+                                unsigned long override_duration_micros  = 1000000 ,
+                                boolean       looping_enabled           = false   , 
+                                boolean       loop_direction_r_to_l     = true    , 
+                                unsigned long loop_speed_micros         = 1000000
+                             );
+
+    // Encodes a NUL-terminated string into segment bytes in one pass, blanking whatever's left of the buffer after 
+    // the string ends; returns how many characters were encoded. Every 7-bit ASCII character has a segment byte 
+    // (blank, if there's nothing it even vaguely looks like) 
+    //    const char* data           - the string 
+    //    uint8_t     segments[]     - where the segment bytes go 
+    //    uint8_t     segment_count  - how big segments is 
+    static uint8_t encode_string(const char* data, uint8_t segments[], uint8_t segment_count); 
+
+    // Puts a message up on one layer of the display. Whatever's on a higher layer covers whatever's below it, 
+    // but only on the segments that layer's masks say it covers, so e.g. a blinking ":" can sit over the time 
+    // without hiding the digits. set_display_contents() is this on LAYER_NORMAL or LAYER_OVERRIDE. 
+    //    uint8_t       layer                  - which layer (see message_layer) 
+    //    const uint8_t segments[]             - DISPLAY_SIZE_ segment bytes, leftmost first 
+    //    unsigned long lifespan_micros        - how long before the layer clears itself; 0 is until replaced or cleared 
+    //    const uint8_t segment_masks[]        - per digit, which segments this layer covers; NULL is all of them 
+    //    unsigned long blink_period_micros    - if nonzero, the layer shows for half of each period and is see-through 
+    //                                           for the other half 
+    void set_layer_contents(uint8_t       layer                       , 
+                            const uint8_t segments[]                  , 
+                            unsigned long lifespan_micros     = 0     , 
+                            const uint8_t segment_masks[]     = NULL  , 
+                            unsigned long blink_period_micros = 0 
+                           ); 
+
+    // Takes a layer's message down (the normal layer just goes blank) 
+    void clear_layer(uint8_t layer); 
+
+    // Sets the brightness of the display; like the other commands below, it's queued and sent in turn with the 
+    // digits, a few units per tick, rather than all at once 
     void set_brightness(uint8_t level); 
 
+    // Turns the display on or off (what's on it is kept either way) 
+    void set_display_on(bool on); 
+
+    // Resends everything: the data command and every digit 
+    void refresh(); 
+
+    // Sets how many units (starts, bits, stops) of a pending transaction each tick() may send;
+    // more means changes show up sooner, fewer means a cheaper tick 
+    void set_transfer_units_per_tick(uint8_t units); 
+
+    // Swaps the incremental sender for another (e.g. a Fixed_Pin_Transfer on the same pins), which the display then 
+    // owns; anything half-sent is dropped and everything resent, so it's best done in setup 
+    //    Seven_Segment_Transfer* transfer - the new sender, allocated with new 
+    void use_transfer(Seven_Segment_Transfer* transfer); 
+
+    // Hands this display's sending over to Seven_Segment_Background, after which tick() only stages whole frames 
+    // for its interrupt to send; returns false if it couldn't (no room, or the display's on a Seven_Segment_Bus). 
+    // Best done in setup, before anything's been sent 
+    bool send_in_background(); 
+
+    // bus traffic accounting for this display, since construction or the last reset 
+    struct bus_statistics
+    {
+      unsigned long bytes_sent;                   // every byte clocked out, commands and digits alike 
+      unsigned long start_stop_pairs;             // every start ... stop framed transaction 
+      unsigned long ack_waits;                    // extra polls spent waiting for the display to ACK a byte 
+      unsigned long ack_failures;                 // transactions cut short because the display never ACKed (unplugged, flaky cable...) 
+      unsigned long updates_latched;              // changed messages that made it all the way onto the display 
+      unsigned long last_time_to_visible_micros;  // from a change being staged to its last digit latching, as seen by tick()
+      unsigned long worst_time_to_visible_micros; // the worst of the above 
+    };
+
+    // Returns a copy of the bus traffic accounting for this display 
+    bus_statistics get_bus_statistics(); 
+
+    // Zeroes the bus traffic accounting for this display 
+    void reset_bus_statistics(); 
+
+    // Whether a change to what should be up hasn't finished going out to the display yet 
+    bool is_update_pending(); 
+
+    // Whether the display stopped answering, and hasn't answered since; it's only retried now and then (less and 
+    // less often, the longer it stays that way) until it does, and then gets everything resent 
+    bool is_degraded(); 
+
 
     //
     //  constants 
@@ -84,6 +204,18 @@ class Seven_Segment_Display
     // size of display constant
     static const uint8_t  DISPLAY_SIZE_   = 4; 
 
+    // longest message that can scroll 
+    static const uint8_t  MAX_SCROLL_LENGTH_ = 16; 
+
+    // the message layers, lowest first; each covers whatever's below it 
+    enum message_layer
+    {
+      LAYER_NORMAL,             // the everyday message; always there, even if blank 
+      LAYER_OVERRIDE,           // priority messages (will_override) 
+      LAYER_ALERT,              // anything that needs to sit on top of even those, e.g. a blinking indicator 
+      LAYER_COUNT_
+    };
+
     // brightness constants for anyone to use  
     static const uint8_t  BRIGHT_DARKEST_ = 0; 
     static const uint8_t  BRIGHT_TYPICAL_ = 2;
@@ -92,27 +224,54 @@ class Seven_Segment_Display
 
   private:
 
+    // the bus sends some of our transactions for us, so it needs to see them
+    friend class Seven_Segment_Bus;
+
     //
     //  methods 
     //
 
-    // helper method to zero out display storage
-    void clear_normal_display_message(); 
+    // helper method; builds what should be up from the layers and stages it, noting when that next needs doing 
+    void composite_layers(); 
+
+    // helper method; brings the next time the layers need compositing forward to the given one, if it's sooner 
+    void note_layer_event(unsigned long event_micros); 
 
-    // helper method to zero out override display storage
-    void clear_override_display_message(); 
+    // helper method; files a message away as the normal or priority one, then updates 
+    void store_message(const uint8_t segments[], boolean clock_points, boolean will_override, unsigned long override_duration_micros); 
+
+    // helper methods for scrolling messages; see the .cpp 
+    uint8_t* get_scroll_segments(boolean will_override); 
+    void start_scroll(uint8_t length, boolean clock_points, boolean will_override, unsigned long override_duration_micros, 
+                      boolean direction_r_to_l, unsigned long step_micros); 
+    void step_scroll(uint8_t layer); 
+    void stop_scroll(uint8_t layer); 
+    void fill_scroll_window(uint8_t layer, uint8_t window[]); 
 
     // helper method - translates characters to their seven-segment display byte equivalent, if one exists  
-    uint8_t get_display_code_for_character(char character);
+    static uint8_t get_display_code_for_character(char character);
 
     // helper method; checks for and prepares any new values for sending; ignores the request if redundant
     void stage_message_for_sending(uint8_t contents_to_display[]);
 
-    // performs next step in sending of pending message; does redundancy checking 
-    void step_incremental_display(); 
+    // sends a little more of the pending changes; only changed digits go out, nearby ones in a single burst;
+    // returns false if there was nothing to send 
+    bool step_incremental_display(); 
+
+    // helper method; fills in the next transaction that needs sending, if any; returns false if there's nothing to send 
+    bool build_next_transaction(Seven_Segment_Transfer::transaction& next); 
+
+    // helper method; does the bookkeeping for a transaction that just finished sending 
+    void complete_transaction(const Seven_Segment_Transfer::transaction& completed); 
+
+    // helper method; picks the next run of changed digits to send and snapshots their values 
+    void plan_next_burst(); 
+
+    // helper method; notes that the burst just sent is now up on the display 
+    void finish_burst(); 
 
-    // helper method; writes a single byte to the TM1637 style Seven-Segment Display
-    void writeByte(int8_t wr_data);
+    // helper method; writes a single byte to the TM1637 style Seven-Segment Display; returns whether it was ACKed 
+    bool writeByte(int8_t wr_data);
 
     // helper method; sends the "prepare to receive command / data" signal to the TM1637 style Seven-Segment Display
     void send_signal_start();
@@ -120,6 +279,24 @@ class Seven_Segment_Display
     // helper method; sends the "finish receiving command / data" signal to the TM1637 style Seven-Segment Display
     void send_signal_stop();
 
+    // helper methods for the command queue; see the .cpp 
+    void    queue_command(uint8_t command); 
+    void    pop_command(); 
+    uint8_t get_display_control_command(); 
+
+    // helper method; notes the display didn't answer, and arranges to try again (everything) later 
+    void note_transfer_failure(); 
+
+    // helper method; whether we're leaving an unanswering display alone for now 
+    bool in_retry_backoff(); 
+
+    // helper method; records how long the message that just finished sending took to show up 
+    void note_update_latched();
+
+    // helper method; stages what should be up for the background sender, if it's changed since last time, and 
+    // notices when it's gone out (or been dropped for want of an ACK) 
+    void stage_background_frame();
+
     // DEPRECATED; one-shot method to send one value to a given index of the SSD
     void change_single_value(uint8_t index, uint8_t new_value);
 
@@ -131,11 +308,24 @@ class Seven_Segment_Display
     //  data members 
     //
 
-    // storage for content of the "screen" 
-    uint8_t normal_display_message_  [DISPLAY_SIZE_]      = {0x00,0x00,0x00,0x00};
-
-    // storage for content of the "screen", priority message edition 
-    uint8_t override_display_message_[DISPLAY_SIZE_]      = {0x00,0x00,0x00,0x00};
+    // one layer's message 
+    struct layer_contents
+    {
+      uint8_t       segments [DISPLAY_SIZE_];
+      uint8_t       masks    [DISPLAY_SIZE_];   // per digit, the segments this layer covers 
+      bool          active;
+      unsigned long birth_micros;
+      unsigned long lifespan_micros;            // 0 is forever 
+      unsigned long blink_period_micros;        // 0 is steady 
+    };
+
+    // storage for content of the "screen", one per layer 
+    layer_contents layers_[LAYER_COUNT_];
+
+    // whether a layer's changed since the last composite, and when one next expires or blinks regardless 
+    bool          layers_changed_                         = true; 
+    bool          layer_event_pending_                    = false; 
+    unsigned long next_layer_event_micros_                = 0; 
 
     // keeping track of what's already up there to avoid redundancy  
     uint8_t current_display_contents_ [DISPLAY_SIZE_]     = {0x00,0x00,0x00,0x00};
@@ -143,12 +333,6 @@ class Seven_Segment_Display
     // keep track of what we're currently trying to send to the display 
     uint8_t new_message_to_be_displayed_ [DISPLAY_SIZE_]  = {0x00,0x00,0x00,0x00};
 
-    // when the current priority message was first displayed
-    unsigned long override_birth_time_                    = 0; 
-
-    // how long the current priority message should be displayed for in total  
-    unsigned long override_lifespan_micros_               = 0; 
-
     // track the time we're told about to make stopping and starting simpler
     unsigned long most_recently_seen_external_time_       = 0;
 
@@ -156,14 +340,79 @@ class Seven_Segment_Display
     uint8_t clock_pin_;
     uint8_t data_pin_;
 
-    // encoding for T1637 brightness 
+    // encoding for T1637 brightness, and whether the display's on 
     uint8_t brightness_bit_                               = BRIGHTNESS_BASE_ + BRIGHT_TYPICAL_;
-
-    // keep track of whether a new message has arrived to begin sending once you get a chance 
-    bool new_message_waiting_for_send_begin_              = false;  
-
-    // keep track of which step of sending a message you've already completed  
-    uint8_t incremental_display_step_                     = DISPLAY_SIZE_; 
+    bool    display_on_                                   = true; 
+
+    // brightness / on-off commands waiting their turn to go out, oldest first; room for a few, e.g. an 
+    // on / off / on / off flash queued up in one go 
+    static const uint8_t COMMAND_QUEUE_SIZE_              = 4; 
+    uint8_t command_queue_ [COMMAND_QUEUE_SIZE_]          = {0x00,0x00,0x00,0x00};
+    uint8_t command_head_                                 = 0; 
+    uint8_t command_count_                                = 0; 
+
+    // one bit per digit (bit 0 is the leftmost) that differs between what we want up and what's actually up;
+    // all of them to start with, since there's no telling what the display shows at power-on 
+    uint8_t dirty_digits_                                 = ALL_DIGITS_DIRTY_; 
+
+    // the TM1637 remembers the auto-increment data command, so it only has to be sent once 
+    bool data_command_sent_                               = false; 
+
+    // moves on whenever what we'd send next might have changed (a new digit, a command queued, a transaction 
+    // finished); the bus only looks for something to share when one of its displays' has 
+    uint8_t send_generation_                              = 0; 
+
+    // sends our transactions a few units at a time 
+    Seven_Segment_Transfer* transfer_; 
+    uint8_t transfer_units_per_tick_                      = DEFAULT_TRANSFER_UNITS_PER_TICK_; 
+
+    // the bus we share our data pin through, if any; set by the bus when we're added to it, after which the bus 
+    // does all our sending for us 
+    Seven_Segment_Bus* bus_                               = NULL; 
+
+    // what the transaction currently being sent is for 
+    uint8_t transaction_in_flight_                        = IN_FLIGHT_NOTHING; 
+
+    // the burst currently being sent; the values are copied at the start so a change mid-burst can't tear it 
+    uint8_t burst_start_                                  = 0; 
+    uint8_t burst_length_                                 = 0; 
+    uint8_t burst_bytes_ [DISPLAY_SIZE_]                  = {0x00,0x00,0x00,0x00};
+
+    // one layer's scrolling message: encoded once up front, then shown a window at a time 
+    struct scroll_contents
+    {
+      uint8_t       segments [MAX_SCROLL_LENGTH_];
+      uint8_t       length; 
+      uint8_t       offset; 
+      uint8_t       points_flag; 
+      boolean       r_to_l; 
+      boolean       active; 
+      unsigned long step_micros; 
+      unsigned long last_step_micros; 
+    };
+
+    // the layers a message can scroll on (set_display_contents() only ever puts one on these), each scrolling 
+    // along on its own, so a priority message scrolling over the normal one doesn't hold it up 
+    static const uint8_t SCROLL_LAYER_COUNT_              = LAYER_OVERRIDE + 1; 
+    scroll_contents scrolls_[SCROLL_LAYER_COUNT_]; 
+
+    // the background sender's slot for us, if we're sending that way, and the last frame we staged there 
+    uint8_t       background_slot_                        = Seven_Segment_Background::NO_SLOT_; 
+    uint8_t       background_frame_ [DISPLAY_SIZE_]       = {0x00,0x00,0x00,0x00};
+    uint8_t       background_control_                     = 0x00; 
+    bool          background_resend_                      = true; 
+
+    // bus traffic accounting 
+    bus_statistics bus_statistics_                        = {0, 0, 0, 0, 0, 0, 0};
+
+    // unanswered display handling: whether it's stopped answering, how long to leave it before trying again, and when 
+    bool          degraded_                               = false; 
+    unsigned long retry_backoff_micros_                   = FIRST_RETRY_BACKOFF_MICROS_; 
+    unsigned long retry_after_micros_                     = 0; 
+
+    // when the change currently being sent was first staged, for the time-to-visible figure 
+    bool          update_pending_                         = false;
+    unsigned long update_pending_since_micros_            = 0;
 
 
     //
@@ -174,8 +423,29 @@ class Seven_Segment_Display
     // (apparently added to every character in the message) 
     const uint8_t CLOCK_POINTS_DATA_FLAG_ = 0x80;
 
+    // what a transaction is for 
+    enum in_flight
+    {
+      IN_FLIGHT_NOTHING,
+      IN_FLIGHT_COMMAND,        // the command at the front of the queue 
+      IN_FLIGHT_DATA_COMMAND,   // the auto-increment data command, first time only 
+      IN_FLIGHT_DIGITS          // a burst: starting address, then the digits 
+    };
+
+    // units per tick unless told otherwise; a byte is eight units, so this sends one in four loops 
+    static const uint8_t DEFAULT_TRANSFER_UNITS_PER_TICK_ = 2; 
+
+    // how long to leave a display that's stopped answering before trying it again; doubles every time it still 
+    // doesn't, up to the max 
+    static const unsigned long FIRST_RETRY_BACKOFF_MICROS_ = 10000; 
+    static const unsigned long MAX_RETRY_BACKOFF_MICROS_   = 1000000; 
+
+    // every digit needs sending 
+    static const uint8_t ALL_DIGITS_DIRTY_ = (1 << DISPLAY_SIZE_) - 1; 
+
     // TM1637 built-in constants for commands and brightness values 
     static const uint8_t BRIGHTNESS_BASE_ = 0x88; 
+    static const uint8_t DISPLAY_ON_FLAG_ = 0x08; 
     static const uint8_t ADDR_AUTO_       = 0x40;
     static const uint8_t ADDR_FIXED_      = 0x44;
     static const uint8_t CMD_SET_ADDR_    = 0xc0;
@@ -0,0 +1,240 @@
+//============================================================================//
+//  Name    : Seven_Segment_Transfer.cpp                                      //
+//  Desc    : C++ Implementation for sending one TM1637 transaction a few     //
+//            clock edges at a time                                           //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - See the header for the units a transaction is sent in         //
+//            - The pin wiggling is Frankie.Chu's, from                       //
+//              Seven_Segment_Display, cut up into resumable pieces           //
+//============================================================================//
+
+// interface include
+#include "Seven_Segment_Transfer.h"
+
+// Constructor
+//    uint8_t clock_pin - the Arduino pin attached to the CLK pin of the display
+//    uint8_t data_pin  - the Arduino pin attached to the DATA pin of the display
+Seven_Segment_Transfer::Seven_Segment_Transfer(uint8_t clock_pin, uint8_t data_pin)
+{
+  // store the pins for later reference
+  this->clock_pin_ = clock_pin;
+  this->data_pin_  = data_pin;
+
+  // set the pin modes
+  pinMode(this->clock_pin_, OUTPUT);
+  pinMode(this->data_pin_,  OUTPUT);
+}
+
+
+// Constructor, for sending to several displays at once
+//    uint8_t clock_port - the I/O address of the output register all the displays' CLK pins are on
+//    uint8_t clock_mask - the bits of every CLK pin taking part, to start with
+//    uint8_t data_pin   - the Arduino pin attached to all the displays' DATA pins
+Seven_Segment_Transfer::Seven_Segment_Transfer(uint8_t clock_port, uint8_t clock_mask, uint8_t data_pin)
+{
+  // store the pins for later reference (the displays set up their own clock pins)
+  this->clock_port_ = clock_port;
+  this->clock_mask_ = clock_mask;
+  this->data_pin_   = data_pin;
+
+  pinMode(this->data_pin_, OUTPUT);
+}
+
+
+// Destructor
+Seven_Segment_Transfer::~Seven_Segment_Transfer()
+{
+}
+
+
+// which bits of the clock port to drive; only for the port flavor, and ignored unless idle
+//    uint8_t clock_mask - the bits of every CLK pin taking part
+void Seven_Segment_Transfer::set_clock_mask(uint8_t clock_mask)
+{
+  if (this->is_idle())
+  {
+    this->clock_mask_ = clock_mask;
+  }
+}
+
+
+// whether there's no transaction in progress
+bool Seven_Segment_Transfer::is_idle()
+{
+  return this->unit_ == UNIT_IDLE;
+}
+
+
+// start sending a transaction (copied, so the caller's can change underneath); ignored unless idle
+//    const transaction& next - the transaction to send
+void Seven_Segment_Transfer::begin(const transaction& next)
+{
+  if (!this->is_idle() || next.length == 0 || next.length > MAX_TRANSACTION_BYTES_)
+  {
+    return;
+  }
+
+  this->transaction_              = next;
+  this->transaction_.ack_polls    = 0;
+  this->transaction_.acknowledged = true;
+  this->byte_index_               = 0;
+  this->bit_index_                = 0;
+  this->unit_                     = UNIT_START;
+}
+
+
+// send up to the given number of units of the transaction in progress; returns true if that finished it
+// (which a missing ACK does early; see get_transaction().acknowledged)
+//    uint8_t unit_budget - the most units to send
+bool Seven_Segment_Transfer::step(uint8_t unit_budget)
+{
+  for (uint8_t i = 0; i < unit_budget; i++)
+  {
+    switch (this->unit_)
+    {
+      case UNIT_IDLE:
+        return false;
+
+      case UNIT_START:
+        this->send_start();
+        this->unit_ = UNIT_BIT;
+        break;
+
+      case UNIT_BIT:
+        this->send_bit();
+        this->bit_index_++;
+
+        // a whole byte out means it's the display's turn to answer, straight away: from the eighth bit's falling
+        // edge it's already pulling DIO low, so the ACK can't be left for the next step
+        if (this->bit_index_ == 8)
+        {
+          this->send_ack();
+          this->bit_index_ = 0;
+          this->byte_index_++;
+
+          // all sent, or nobody's listening (so wrap it up rather than talk to the void)
+          if (!this->transaction_.acknowledged || this->byte_index_ == this->transaction_.length)
+          {
+            this->unit_ = UNIT_STOP;
+          }
+        }
+        break;
+
+      case UNIT_STOP:
+        this->send_stop();
+        this->unit_ = UNIT_IDLE;
+        return true;
+    }
+  }
+
+  return false;
+}
+
+
+// the transaction in progress, or the one that just finished
+const Seven_Segment_Transfer::transaction& Seven_Segment_Transfer::get_transaction()
+{
+  return this->transaction_;
+}
+
+
+//
+//  private methods
+//
+
+// helper method; sends the "prepare to receive command / data" signal
+void Seven_Segment_Transfer::send_start()
+{
+  this->write_clock(HIGH);
+  digitalWrite(this->data_pin_ , HIGH);
+  digitalWrite(this->data_pin_ , LOW );
+  this->write_clock(LOW);
+}
+
+
+// helper method; sends the next bit of the current byte (LSB first)
+void Seven_Segment_Transfer::send_bit()
+{
+  this->write_clock(LOW);
+  if (this->current_bit()) digitalWrite(this->data_pin_, HIGH);
+  else                     digitalWrite(this->data_pin_, LOW );
+  this->write_clock(HIGH);
+
+  // leave the clock low, so nothing another display does on the shared data pin looks like a start or stop to this one
+  this->write_clock(LOW);
+}
+
+
+// helper method; lets the display acknowledge the byte it was just sent, right after its eighth bit
+// (a bounded few looks, never a wait: an unplugged display must not be able to stall the loop)
+void Seven_Segment_Transfer::send_ack()
+{
+  bool acked = false;
+
+  // let go of the data line first; the display's been pulling it low since the eighth bit's falling edge, and
+  // driving it against that (a 1 in the last bit) is a short through both pins
+  pinMode(this->data_pin_, INPUT);
+  this->write_clock(HIGH);
+
+  // look for the display pulling the data line low
+  for (uint8_t i = 0; i < ACK_SAMPLES_ && !acked; i++)
+  {
+    if (digitalRead(this->data_pin_) == LOW)
+    {
+      acked = true;
+    }
+    else
+    {
+      this->transaction_.ack_polls++;
+    }
+  }
+
+  if (!acked)
+  {
+    this->transaction_.acknowledged = false;
+  }
+
+  // the ninth falling edge is the display letting go, after which the line's ours again (driven low, as
+  // pinMode(INPUT) left it; the next bit or the STOP sets it anyway)
+  this->write_clock(LOW);
+  pinMode(this->data_pin_, OUTPUT);
+}
+
+
+// helper method; sends the "finish receiving command / data" signal
+void Seven_Segment_Transfer::send_stop()
+{
+  this->write_clock(LOW);
+  digitalWrite(this->data_pin_ , LOW );
+  this->write_clock(HIGH);
+  digitalWrite(this->data_pin_ , HIGH);
+}
+
+
+// helper method; the bit send_bit() is due to send (LSB first)
+bool Seven_Segment_Transfer::current_bit()
+{
+  return (this->transaction_.bytes[this->byte_index_] >> this->bit_index_) & 0x01;
+}
+
+
+// helper method; drives the clock pin(s)
+// NB: the port flavor read-modify-writes the port, which is only safe because nothing else touches
+//     that port from an interrupt (the NeoPixel pins on PORTB are only written from the main loop)
+void Seven_Segment_Transfer::write_clock(uint8_t level)
+{
+  if (this->clock_port_ == NO_CLOCK_PORT_)
+  {
+    digitalWrite(this->clock_pin_, level);
+  }
+  else
+  {
+    if (level == HIGH) _SFR_IO8(this->clock_port_) |=  this->clock_mask_;
+    else               _SFR_IO8(this->clock_port_) &= ~this->clock_mask_;
+
+    // a port write's over far quicker than the chip can follow
+    __builtin_avr_delay_cycles(EDGE_HOLD_CYCLES_);
+  }
+}
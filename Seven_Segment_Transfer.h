@@ -0,0 +1,164 @@
+//============================================================================//
+//  Name    : Seven_Segment_Transfer.h                                        //
+//  Desc    : C++ Interface for sending one TM1637 transaction a few clock    //
+//            edges at a time                                                 //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - A transaction is start, some bytes (each LSB first, then an   //
+//              ACK), and stop. Sending one byte in one go costs 8 bits and   //
+//              an ACK's worth of pin writes, which is what used to set the   //
+//              worst-case loop time; this sends it in "units" instead:       //
+//                START - CLK high, DIO high, DIO low, CLK low                //
+//                BIT   - CLK low, DIO set, CLK high, CLK low; the eighth     //
+//                        then takes the ACK with it: DIO released, CLK       //
+//                        high, look (a bounded few times) for the display    //
+//                        pulling DIO low, CLK low, DIO driven                //
+//                STOP  - CLK low, DIO low, CLK high, DIO high                //
+//              and step() only does as many units as it's allowed to         //
+//            - The display pulls DIO low from the eighth bit's falling edge  //
+//              to the ninth (the ACK's), which is why the two go together:   //
+//              no unit ends with it holding the line. So every unit leaves   //
+//              CLK low and DIO free (or the bus idle, after STOP), and it's  //
+//              safe for another display sharing the data pin to do anything  //
+//              it likes between units                                        //
+//            - Built on a port instead of a pin, it drives every clock pin   //
+//              in its clock mask with one port write, so several displays    //
+//              sharing the data pin all take in the same transaction at      //
+//              once (their ACKs just pull the same line low together). The   //
+//              port goes by its I/O address, the way Fixed_Pin_Transfer's    //
+//              pins do, rather than a pointer, so the host/ build's pins see //
+//              every edge                                                    //
+//            - A byte that isn't ACKed ends the transaction there, with a    //
+//              STOP; a missing display costs the same few units as a present //
+//              one, and the caller finds out from the transaction            //
+//            - The units here go through digitalWrite(); Fixed_Pin_Transfer  //
+//              sends the very same units with the pins baked in at compile   //
+//              time, for a single instruction per edge                       //
+//            - An edge that quick (or the port flavor's clock) is followed   //
+//              by a short fixed wait, so CLK's highs and lows are never      //
+//              shorter than the chip needs                                   //
+//============================================================================//
+
+#ifndef SEVEN_SEGMENT_TRANSFER_H
+#define SEVEN_SEGMENT_TRANSFER_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+#include <avr/io.h>
+
+// the I/O address of an Uno pin's PORTx register (its DDRx is one below, its PINx two below)
+constexpr uint8_t uno_pin_port_io_address(uint8_t pin)
+{
+  return (pin < 8) ? 0x0B : ((pin < 14) ? 0x05 : 0x08);
+}
+
+// which bit of its port an Uno pin is
+constexpr uint8_t uno_pin_port_bit(uint8_t pin)
+{
+  return (pin < 8) ? pin : ((pin < 14) ? pin - 8 : pin - 14);
+}
+
+// A class to send TM1637 transactions a bounded amount at a time
+class Seven_Segment_Transfer
+{
+  public:
+
+    // longest transaction: an address plus a whole display's worth of digits
+    static const uint8_t MAX_TRANSACTION_BYTES_ = 5;
+
+    // one start ... stop framed transaction
+    struct transaction
+    {
+      uint8_t bytes[MAX_TRANSACTION_BYTES_];
+      uint8_t length;
+      uint8_t ack_polls;        // extra looks at DIO spent waiting for ACKs; filled in while sending
+      bool    acknowledged;     // whether every byte sent got ACKed; filled in while sending
+    };
+
+    // how long to hold still after an edge that's a single instruction (the port flavor's clock, and every one of
+    // Fixed_Pin_Transfer's), in CPU cycles: the TM1637 wants CLK high and low for at least 400ns each, and DIO set
+    // before CLK rises, and an sbi / cbi is only 125ns; this is 437.5ns more on a 16MHz Uno. digitalWrite() takes
+    // several times that on its own
+    static const uint8_t EDGE_HOLD_CYCLES_      = 7;
+
+    // how many times an ACK looks at DIO before giving up on the display; the TM1637 pulls it low well
+    // before CLK even goes high, so more than one look is only there for slow edges
+    static const uint8_t ACK_SAMPLES_           = 4;
+
+    // Constructor
+    //    uint8_t clock_pin - the Arduino pin attached to the CLK pin of the display
+    //    uint8_t data_pin  - the Arduino pin attached to the DATA pin of the display
+    Seven_Segment_Transfer(uint8_t clock_pin, uint8_t data_pin);
+
+    // Constructor, for sending to several displays at once
+    //    uint8_t clock_port - the I/O address of the output register all the displays' CLK pins are on
+    //                         (see uno_pin_port_io_address())
+    //    uint8_t clock_mask - the bits of every CLK pin taking part, to start with (see set_clock_mask())
+    //    uint8_t data_pin   - the Arduino pin attached to all the displays' DATA pins
+    Seven_Segment_Transfer(uint8_t clock_port, uint8_t clock_mask, uint8_t data_pin);
+
+    // Destructor; virtual, since a Fixed_Pin_Transfer may be deleted through one of these
+    virtual ~Seven_Segment_Transfer();
+
+    // which bits of the clock port to drive; only for the port flavor, and ignored unless idle
+    //    uint8_t clock_mask - the bits of every CLK pin taking part
+    void set_clock_mask(uint8_t clock_mask);
+
+    // whether there's no transaction in progress
+    bool is_idle();
+
+    // start sending a transaction (copied, so the caller's can change underneath); ignored unless idle
+    //    const transaction& next - the transaction to send
+    void begin(const transaction& next);
+
+    // send up to the given number of units of the transaction in progress; returns true if that finished it
+    // (which a missing ACK does early; see get_transaction().acknowledged)
+    //    uint8_t unit_budget - the most units to send
+    bool step(uint8_t unit_budget);
+
+    // the transaction in progress, or the one that just finished
+    const transaction& get_transaction();
+
+  protected:
+
+    // the pieces a transaction is sent in
+    enum unit
+    {
+      UNIT_IDLE,
+      UNIT_START,
+      UNIT_BIT,
+      UNIT_STOP
+    };
+
+    // helper methods; one of each unit (the only pin wiggling there is, so the only thing a subclass with
+    // faster pins needs to replace)
+    virtual void send_start();
+    virtual void send_bit();
+    virtual void send_ack();
+    virtual void send_stop();
+
+    // helper method; the bit send_bit() is due to send
+    bool current_bit();
+
+    // helper method; drives the clock pin(s)
+    void write_clock(uint8_t level);
+
+    // SSD pin values; either one clock pin, or some bits of a port
+    uint8_t           clock_pin_                   = 0;
+    uint8_t           clock_port_                  = NO_CLOCK_PORT_;
+    uint8_t           clock_mask_                  = 0;
+    uint8_t           data_pin_;
+
+    // clock_port_ for the one-pin flavor
+    static const uint8_t NO_CLOCK_PORT_            = 0xFF;
+
+    // the transaction and where we are in it
+    transaction transaction_                   = { {0x00,0x00,0x00,0x00,0x00}, 0, 0, true };
+    uint8_t     unit_                          = UNIT_IDLE;
+    uint8_t     byte_index_                    = 0;
+    uint8_t     bit_index_                     = 0;
+};
+
+#endif
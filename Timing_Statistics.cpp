@@ -0,0 +1,98 @@
+//============================================================================//
+//  Name    : Timing_Statistics.cpp                                           //
+//  Desc    : C++ Implementation for a small running min / max / average      //
+//            tracker for timing measurements                                 //
+//  Dev     : Nate Cope,                                                      //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Only keeps running totals, so it costs the same handful of    //
+//              bytes no matter how many samples it sees                      //
+//            - Units are whatever the caller feeds it (micros, cycles, ...)  //
+//============================================================================//
+
+// interface include
+#include "Timing_Statistics.h"
+
+// Constructor
+Timing_Statistics::Timing_Statistics()
+{
+  this->reset();
+}
+
+
+// add one measurement to the running statistics
+//    unsigned long sample - the measured value
+void Timing_Statistics::add_sample(unsigned long sample)
+{
+  // first sample sets the bar for both extremes
+  if (this->count_ == 0 || sample < this->minimum_) this->minimum_ = sample;
+  if (this->count_ == 0 || sample > this->maximum_) this->maximum_ = sample;
+
+  this->count_++;
+  this->total_ += sample;   // NB: will wrap eventually on a box left running for days; reset() between measurement runs
+}
+
+
+// forget everything seen so far
+void Timing_Statistics::reset()
+{
+  this->count_   = 0;
+  this->minimum_ = 0;
+  this->maximum_ = 0;
+  this->total_   = 0;
+}
+
+
+// Hopefully all self-explanatory (all return 0 if no samples have been seen)
+unsigned long Timing_Statistics::get_count()
+{
+  return this->count_;
+}
+
+
+unsigned long Timing_Statistics::get_minimum()
+{
+  return this->minimum_;
+}
+
+
+unsigned long Timing_Statistics::get_maximum()
+{
+  return this->maximum_;
+}
+
+
+unsigned long Timing_Statistics::get_average()
+{
+  // don't divide by zero
+  if (this->count_ == 0) return 0;
+
+  return this->total_ / this->count_;
+}
+
+
+unsigned long Timing_Statistics::get_total()
+{
+  return this->total_;
+}
+
+
+// print a one-line summary over Serial; Serial must already be started
+//    const char* label - what to call this measurement in the printout
+//    const char* units - what to call the units of the measurement in the printout
+void Timing_Statistics::print(const char* label, const char* units)
+{
+  Serial.print(label);
+  Serial.print("\tn: ");
+  Serial.print(this->count_);
+  Serial.print("\tmin: ");
+  Serial.print(this->minimum_);
+  Serial.print(units);
+  Serial.print("\tavg: ");
+  Serial.print(this->get_average());
+  Serial.print(units);
+  Serial.print("\tmax: ");
+  Serial.print(this->maximum_);
+  Serial.print(units);
+  Serial.println("");
+}
@@ -0,0 +1,56 @@
+//============================================================================//
+//  Name    : Timing_Statistics.h                                             //
+//  Desc    : C++ Interface for a small running min / max / average tracker   //
+//            for timing measurements                                         //
+//  Dev     : Nate Cope,                                                      //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Only keeps running totals, so it costs the same handful of    //
+//              bytes no matter how many samples it sees                      //
+//            - Units are whatever the caller feeds it (micros, cycles, ...)  //
+//============================================================================//
+
+#ifndef TIMING_STATISTICS_H
+#define TIMING_STATISTICS_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+
+// A class to keep running statistics on a series of timing measurements
+class Timing_Statistics
+{
+  public:
+
+    // Constructor
+    Timing_Statistics();
+
+    // add one measurement to the running statistics
+    //    unsigned long sample - the measured value
+    void add_sample(unsigned long sample);
+
+    // forget everything seen so far
+    void reset();
+
+    // Hopefully all self-explanatory (all return 0 if no samples have been seen)
+    unsigned long get_count();
+    unsigned long get_minimum();
+    unsigned long get_maximum();
+    unsigned long get_average();
+    unsigned long get_total();
+
+    // print a one-line summary over Serial; Serial must already be started
+    //    const char* label - what to call this measurement in the printout
+    //    const char* units - what to call the units of the measurement in the printout
+    void print(const char* label, const char* units = "us");
+
+  private:
+
+    // running totals
+    unsigned long count_;
+    unsigned long minimum_;
+    unsigned long maximum_;
+    unsigned long total_;
+};
+
+#endif
@@ -0,0 +1,431 @@
+//============================================================================//
+//  Name    : Hit_Scenario.cpp                                                //
+//  Desc    : C++ Implementation for randomized fencing scenarios to run      //
+//            through the hit detection in place of the real weapon lines     //
+//  Dev     : Nate Cope,                                                      //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - See the header for what a scenario is                         //
+//            - Line bits mirror the checks in Hit_Detector's                 //
+//              is_reading_on_target() and is_reading_off_target(); if those  //
+//              change, this has to change with them                          //
+//============================================================================//
+
+// interface include
+#include "Hit_Scenario.h"
+
+// Constructor
+Hit_Scenario::Hit_Scenario()
+{
+  // no-op; generate() does the real work
+}
+
+
+// replace this scenario with a freshly generated one
+//    unsigned long       seed             - the same seed makes the same scenario
+//    const unsigned long contact_micros[] - required contact time for each mode, indexed by mode
+//    const unsigned long lockout_micros[] - lockout time for each mode, indexed by mode
+void Hit_Scenario::generate(unsigned long seed, const unsigned long contact_micros[], const unsigned long lockout_micros[])
+{
+  this->seed_         = seed;
+  this->random_state_ = (uint32_t)(seed * 2654435761UL);  // spread out neighbouring seeds, which xorshift otherwise starts off alike
+  if (this->random_state_ == 0)
+  {
+    this->random_state_ = 1;                      // xorshift gets stuck on zero
+  }
+
+  // half the time, start right before micros() wraps around
+  if (this->next_random() % 2 == 0)
+  {
+    this->start_micros_ = 0xFFFFFFFF - this->random_between(0, 2000000);
+  }
+  else
+  {
+    this->start_micros_ = this->next_random();
+  }
+
+  this->start_mode_ = this->next_random() % MODE_COUNT_;
+
+  unsigned long contact = contact_micros[this->start_mode_];
+  unsigned long lockout = lockout_micros[this->start_mode_];
+
+  // one to four contacts
+  this->event_count_ = 1 + this->next_random() % MAX_EVENTS_;
+  for (uint8_t i = 0; i < this->event_count_; i++)
+  {
+    contact_event& event = this->events_[i];
+
+    event.fencer     = this->next_random() % 2;
+    event.kind       = (this->next_random() % 4 == 0) ? OFF_TARGET : ON_TARGET;
+    event.flickering = (this->next_random() % 4 == 0);
+
+    // how long: mostly right around the contact time, sometimes a whip-over brush well under it
+    if (this->next_random() % 5 == 0)
+    {
+      event.duration_micros = this->random_between(1, contact);
+    }
+    else
+    {
+      event.duration_micros = this->random_between(contact / 2, contact * 2) + 1;
+    }
+
+    // when: the first one early on, later ones just either side of the first one's lockout
+    if (i == 0)
+    {
+      event.start_offset_micros = this->random_between(1000, 5000);
+    }
+    else
+    {
+      event.start_offset_micros = this->events_[0].start_offset_micros + contact +
+                                  this->random_between(lockout * 8 / 10, lockout * 12 / 10);
+    }
+
+    // a fencer's blade only touches one thing at a time; keep their contacts from overlapping
+    // (moving past one earlier contact can land on another, so go again until nothing moves)
+    bool moved = true;
+    while (moved)
+    {
+      moved = false;
+
+      for (uint8_t j = 0; j < i; j++)
+      {
+        const contact_event& earlier     = this->events_[j];
+        unsigned long        earlier_end = earlier.start_offset_micros + earlier.duration_micros;
+
+        if (earlier.fencer == event.fencer &&
+            event.start_offset_micros < earlier_end + 1000 &&
+            earlier.start_offset_micros < event.start_offset_micros + event.duration_micros + 1000)
+        {
+          event.start_offset_micros = earlier_end + 1000;
+          moved                     = true;
+        }
+      }
+    }
+  }
+
+  // a quarter of the time, switch modes somewhere in the middle of things (often mid-lockout)
+  if (this->next_random() % 4 == 0)
+  {
+    this->switched_mode_             = (this->start_mode_ + 1 + this->next_random() % (MODE_COUNT_ - 1)) % MODE_COUNT_;
+    this->mode_switch_offset_micros_ = this->events_[0].start_offset_micros + this->random_between(0, contact + lockout);
+  }
+  else
+  {
+    this->switched_mode_             = this->start_mode_;
+    this->mode_switch_offset_micros_ = 0;
+  }
+}
+
+
+// the weapon line bits (Line_Trace::LINE_*) at a given time
+//    unsigned long sample_time - the (simulated) time to sample at
+//    uint8_t       mode        - the weapon mode in effect at that time
+uint8_t Hit_Scenario::get_lines_at(unsigned long sample_time, uint8_t mode)
+{
+  unsigned long offset = (uint32_t)(sample_time - this->start_micros_);
+  uint8_t       lines  = 0;
+
+  for (uint8_t i = 0; i < this->event_count_; i++)
+  {
+    if (this->is_event_touching(this->events_[i], offset))
+    {
+      lines |= this->get_event_lines(this->events_[i], mode);
+    }
+  }
+
+  return lines;
+}
+
+
+// the mode in effect at a given time
+//    unsigned long sample_time - the (simulated) time to ask about
+uint8_t Hit_Scenario::get_mode_at(unsigned long sample_time)
+{
+  unsigned long offset = (uint32_t)(sample_time - this->start_micros_);
+
+  if (this->mode_switch_offset_micros_ != 0 && offset >= this->mode_switch_offset_micros_)
+  {
+    return this->switched_mode_;
+  }
+
+  return this->start_mode_;
+}
+
+
+// how long a fencer's current contact has been held without a break, as far as the lines would show it
+//    uint8_t       fencer      - LEFT_FENCER_ or RIGHT_FENCER_
+//    unsigned long sample_time - the (simulated) time to ask about
+unsigned long Hit_Scenario::get_contact_held_micros(uint8_t fencer, unsigned long sample_time)
+{
+  unsigned long offset = (uint32_t)(sample_time - this->start_micros_);
+  uint8_t       mode   = this->get_mode_at(sample_time);
+
+  for (uint8_t i = 0; i < this->event_count_; i++)
+  {
+    const contact_event& event = this->events_[i];
+
+    if (event.fencer != fencer || !this->is_event_touching(event, offset) || this->get_event_lines(event, mode) == 0)
+    {
+      continue;
+    }
+
+    // the lines may change shape (or vanish) at the switch, so there's no honest answer
+    if (this->mode_switch_offset_micros_ != 0 &&
+        event.start_offset_micros < this->mode_switch_offset_micros_ &&
+        this->mode_switch_offset_micros_ <= offset)
+    {
+      return UNKNOWN_CONTACT_;
+    }
+
+    unsigned long since_start = offset - event.start_offset_micros;
+
+    // a flickering contact starts over after every dropout
+    return event.flickering ? since_start % FLICKER_PERIOD_MICROS_ : since_start;
+  }
+
+  return 0;
+}
+
+
+// when the rules as written say a fencer's first hit lands
+//    uint8_t       fencer         - LEFT_FENCER_ or RIGHT_FENCER_
+//    unsigned long contact_micros - the contact time the rules require
+unsigned long Hit_Scenario::get_reference_hit_offset(uint8_t fencer, unsigned long contact_micros)
+{
+  unsigned long first_hit = NO_HIT_;
+
+  for (uint8_t i = 0; i < this->event_count_; i++)
+  {
+    const contact_event& event = this->events_[i];
+
+    if (event.fencer != fencer || this->get_event_lines(event, this->start_mode_) == 0)
+    {
+      continue;
+    }
+
+    // a flickering contact is only ever held for one flicker period's worth at a time
+    unsigned long longest_hold = event.duration_micros;
+    if (event.flickering && longest_hold > FLICKER_PERIOD_MICROS_ - FLICKER_GAP_MICROS_)
+    {
+      longest_hold = FLICKER_PERIOD_MICROS_ - FLICKER_GAP_MICROS_;
+    }
+
+    if (longest_hold > contact_micros && event.start_offset_micros + contact_micros < first_hit)
+    {
+      first_hit = event.start_offset_micros + contact_micros;
+    }
+  }
+
+  return first_hit;
+}
+
+
+// the first moment, from a given time on, that the lines (or the mode) could change, as an offset from the start
+//    unsigned long sample_time - the (simulated) time to ask about
+unsigned long Hit_Scenario::get_next_change_offset(unsigned long sample_time)
+{
+  unsigned long offset = (uint32_t)(sample_time - this->start_micros_);
+  unsigned long next   = NO_CHANGE_;
+
+  for (uint8_t i = 0; i < this->event_count_; i++)
+  {
+    const contact_event& event = this->events_[i];
+
+    // going on now (flickering out, even), so it could change at any time
+    if (!(offset < event.start_offset_micros) && offset - event.start_offset_micros < event.duration_micros)
+    {
+      return offset;
+    }
+
+    if (offset < event.start_offset_micros && event.start_offset_micros < next)
+    {
+      next = event.start_offset_micros;
+    }
+  }
+
+  if (this->mode_switch_offset_micros_ != 0 && offset < this->mode_switch_offset_micros_ && this->mode_switch_offset_micros_ < next)
+  {
+    next = this->mode_switch_offset_micros_;
+  }
+
+  return next;
+}
+
+
+// Hopefully all self-explanatory
+unsigned long Hit_Scenario::get_start_micros()
+{
+  return this->start_micros_;
+}
+
+
+unsigned long Hit_Scenario::get_last_event_end_micros()
+{
+  unsigned long last_end = this->mode_switch_offset_micros_;
+
+  for (uint8_t i = 0; i < this->event_count_; i++)
+  {
+    unsigned long end = this->events_[i].start_offset_micros + this->events_[i].duration_micros;
+    if (end > last_end) last_end = end;
+  }
+
+  return last_end;
+}
+
+
+unsigned long Hit_Scenario::get_seed()
+{
+  return this->seed_;
+}
+
+
+uint8_t Hit_Scenario::get_event_count()
+{
+  return this->event_count_;
+}
+
+
+// shrinking helpers; each makes the scenario a little simpler, or returns false if there was nothing to simplify
+bool Hit_Scenario::remove_event(uint8_t index)
+{
+  if (!(index < this->event_count_)) return false;
+
+  for (uint8_t i = index; i + 1 < this->event_count_; i++)
+  {
+    this->events_[i] = this->events_[i + 1];
+  }
+  this->event_count_--;
+
+  return true;
+}
+
+
+bool Hit_Scenario::clear_flickering(uint8_t index)
+{
+  if (!(index < this->event_count_) || !this->events_[index].flickering) return false;
+
+  this->events_[index].flickering = false;
+
+  return true;
+}
+
+
+bool Hit_Scenario::clear_mode_switch()
+{
+  if (this->mode_switch_offset_micros_ == 0) return false;
+
+  this->switched_mode_             = this->start_mode_;
+  this->mode_switch_offset_micros_ = 0;
+
+  return true;
+}
+
+
+// print the scenario
+//    Print& out - where to (Serial, or anything else that prints)
+void Hit_Scenario::print(Print& out)
+{
+  out.print("seed ");
+  out.print(this->seed_);
+  out.print(", start ");
+  out.print(this->start_micros_);
+  out.print("us, mode ");
+  out.print(this->start_mode_);
+  if (this->mode_switch_offset_micros_ != 0)
+  {
+    out.print(", switching to mode ");
+    out.print(this->switched_mode_);
+    out.print(" at +");
+    out.print(this->mode_switch_offset_micros_);
+    out.print("us");
+  }
+  out.println("");
+
+  for (uint8_t i = 0; i < this->event_count_; i++)
+  {
+    const contact_event& event = this->events_[i];
+
+    out.print("  ");
+    out.print(event.fencer == LEFT_FENCER_ ? "left " : "right");
+    out.print(event.kind == ON_TARGET ? " on-target  " : " off-target ");
+    out.print("+");
+    out.print(event.start_offset_micros);
+    out.print("us for ");
+    out.print(event.duration_micros);
+    out.print("us");
+    out.println(event.flickering ? ", flickering" : "");
+  }
+}
+
+
+//
+//  private methods
+//
+
+// helper method; the next pseudo-random number (xorshift32)
+unsigned long Hit_Scenario::next_random()
+{
+  uint32_t x = this->random_state_;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  this->random_state_ = x;
+  return x;
+}
+
+
+// helper method; a pseudo-random number in [low, high]
+unsigned long Hit_Scenario::random_between(unsigned long low, unsigned long high)
+{
+  if (high <= low) return low;
+
+  return low + this->next_random() % (high - low + 1);
+}
+
+
+// helper method; the line bits one contact puts on the lines in a given mode
+uint8_t Hit_Scenario::get_event_lines(const contact_event& event, uint8_t mode)
+{
+  bool left = (event.fencer == LEFT_FENCER_);
+
+  switch (mode)
+  {
+    case 0: // SABER: touching the opponent's lame shows on their lame line; nothing else shows at all
+      if (event.kind != ON_TARGET) return 0;
+      return left ? Line_Trace::LINE_LEFT_PHASE_RIGHT_LAME_ : Line_Trace::LINE_RIGHT_PHASE_LEFT_LAME_;
+
+    case 1: // FOIL: the weapon line goes high, plus the opponent's lame line if it's on target
+      if (event.kind != ON_TARGET)
+      {
+        return left ? Line_Trace::LINE_LEFT_PHASE_LEFT_WEAPON_ : Line_Trace::LINE_RIGHT_PHASE_RIGHT_WEAPON_;
+      }
+      return left ? (Line_Trace::LINE_LEFT_PHASE_LEFT_WEAPON_   | Line_Trace::LINE_LEFT_PHASE_RIGHT_LAME_ )
+                  : (Line_Trace::LINE_RIGHT_PHASE_RIGHT_WEAPON_ | Line_Trace::LINE_RIGHT_PHASE_LEFT_LAME_);
+
+    case 2: // EPEE: the weapon and own lame lines join on a valid touch; off-target is a touch on the grounded piste
+      if (event.kind != ON_TARGET) return 0;
+      return left ? (Line_Trace::LINE_LEFT_PHASE_LEFT_WEAPON_   | Line_Trace::LINE_LEFT_PHASE_LEFT_LAME_  )
+                  : (Line_Trace::LINE_RIGHT_PHASE_RIGHT_WEAPON_ | Line_Trace::LINE_RIGHT_PHASE_RIGHT_LAME_);
+
+    default:
+      return 0;
+  }
+}
+
+
+// helper method; whether a contact is actually touching at a given offset into the scenario
+bool Hit_Scenario::is_event_touching(const contact_event& event, unsigned long offset)
+{
+  if (offset < event.start_offset_micros || !(offset - event.start_offset_micros < event.duration_micros))
+  {
+    return false;
+  }
+
+  // flickering contacts drop out at the end of every flicker period
+  if (event.flickering && (offset - event.start_offset_micros) % FLICKER_PERIOD_MICROS_ >= FLICKER_PERIOD_MICROS_ - FLICKER_GAP_MICROS_)
+  {
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,147 @@
+//============================================================================//
+//  Name    : Hit_Scenario.h                                                  //
+//  Desc    : C++ Interface for randomized fencing scenarios to run through   //
+//            the hit detection in place of the real weapon lines, for the    //
+//            host/ build                                                     //
+//  Dev     : Nate Cope,                                                      //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - A scenario is a handful of contacts (who, on / off target,    //
+//              when, how long, whether it flickers), a starting mode, an     //
+//              optional mode switch partway through, and a start time that's //
+//              often right before micros() wraps around                      //
+//            - Generation aims at the edges: contacts just either side of    //
+//              the contact time, second touches just either side of the      //
+//              lockout, brief whip-over brushes, switches mid-lockout        //
+//            - Same seed and timings in, same scenario out, so any failure   //
+//              can be reproduced from its seed                               //
+//            - Line bits are Line_Trace's, and modes match the sketch's mode //
+//              enum (0 SABER, 1 FOIL, 2 EPEE)                                //
+//            - Times wrap at 32 bits, as micros() does on the box, even      //
+//              though unsigned long is wider on the host                     //
+//============================================================================//
+
+#ifndef HIT_SCENARIO_H
+#define HIT_SCENARIO_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+
+// local includes
+#include "Line_Trace.h"
+
+// A class to generate and play back randomized fencing scenarios
+class Hit_Scenario
+{
+  public:
+
+    // Constructor
+    Hit_Scenario();
+
+    // replace this scenario with a freshly generated one
+    //    unsigned long       seed             - the same seed makes the same scenario
+    //    const unsigned long contact_micros[] - required contact time for each mode, indexed by mode
+    //    const unsigned long lockout_micros[] - lockout time for each mode, indexed by mode
+    void generate(unsigned long seed, const unsigned long contact_micros[], const unsigned long lockout_micros[]);
+
+    // the weapon line bits (Line_Trace::LINE_*) at a given time
+    //    unsigned long sample_time - the (simulated) time to sample at
+    //    uint8_t       mode        - the weapon mode in effect at that time
+    uint8_t get_lines_at(unsigned long sample_time, uint8_t mode);
+
+    // the mode in effect at a given time
+    //    unsigned long sample_time - the (simulated) time to ask about
+    uint8_t get_mode_at(unsigned long sample_time);
+
+    // how long a fencer's current contact has been held without a break, as far as the lines would show it,
+    // or UNKNOWN_CONTACT_ if it's not well defined (the contact straddles the mode switch)
+    //    uint8_t       fencer      - LEFT_FENCER_ or RIGHT_FENCER_
+    //    unsigned long sample_time - the (simulated) time to ask about
+    unsigned long get_contact_held_micros(uint8_t fencer, unsigned long sample_time);
+
+    // when the rules as written say a fencer's first hit lands: the first moment one of their contacts has been
+    // held unbroken for longer than the contact time, as an offset from the start, or NO_HIT_ if it never is
+    // NB: judges everything by the starting mode, so clear the mode switch first if it matters
+    //    uint8_t       fencer         - LEFT_FENCER_ or RIGHT_FENCER_
+    //    unsigned long contact_micros - the contact time the rules require
+    unsigned long get_reference_hit_offset(uint8_t fencer, unsigned long contact_micros);
+
+    // the first moment, from a given time on, that the lines (or the mode) could change: the start of the next
+    // contact, or the mode switch, as an offset from the start; the time's own offset if a contact's going on (it
+    // could be anything), or NO_CHANGE_ if nothing else ever happens. Between now and then the lines read nothing
+    // at all, so a run can skip straight there
+    //    unsigned long sample_time - the (simulated) time to ask about
+    unsigned long get_next_change_offset(unsigned long sample_time);
+
+    // Hopefully all self-explanatory
+    unsigned long get_start_micros();
+    unsigned long get_last_event_end_micros();   // offset from the start, not an absolute time
+    unsigned long get_seed();
+    uint8_t       get_event_count();
+
+    // shrinking helpers; each makes the scenario a little simpler, or returns false if there was nothing to simplify
+    bool remove_event(uint8_t index);
+    bool clear_flickering(uint8_t index);
+    bool clear_mode_switch();
+
+    // print the scenario
+    //    Print& out - where to (Serial, or anything else that prints)
+    void print(Print& out);
+
+    // constants for public use
+    static const uint8_t       LEFT_FENCER_     = 0;
+    static const uint8_t       RIGHT_FENCER_    = 1;
+    static const uint8_t       MODE_COUNT_      = 3;
+    static const unsigned long UNKNOWN_CONTACT_ = 0xFFFFFFFF;
+    static const unsigned long NO_HIT_          = 0xFFFFFFFF;
+    static const unsigned long NO_CHANGE_       = 0xFFFFFFFF;
+
+  private:
+
+    // kinds of contact
+    enum contact_kind
+    {
+      ON_TARGET,
+      OFF_TARGET      // only shows up on the lines in foil; anywhere else it's a touch on nothing
+    };
+
+    // one contact between a blade and something
+    struct contact_event
+    {
+      uint8_t       fencer;
+      uint8_t       kind;
+      bool          flickering;           // drops out for FLICKER_GAP_MICROS_ every FLICKER_PERIOD_MICROS_
+      unsigned long start_offset_micros;  // from the start of the scenario
+      unsigned long duration_micros;
+    };
+
+    // helper method; the next pseudo-random number (xorshift32)
+    unsigned long next_random();
+
+    // helper method; a pseudo-random number in [low, high]
+    unsigned long random_between(unsigned long low, unsigned long high);
+
+    // helper method; the line bits one contact puts on the lines in a given mode
+    uint8_t get_event_lines(const contact_event& event, uint8_t mode);
+
+    // helper method; whether a contact is actually touching at a given offset into the scenario
+    bool is_event_touching(const contact_event& event, unsigned long offset);
+
+    // the scenario itself
+    static const uint8_t MAX_EVENTS_      = 4;
+    contact_event        events_[MAX_EVENTS_];
+    uint8_t              event_count_               = 0;
+    unsigned long        seed_                      = 0;
+    unsigned long        random_state_              = 1;
+    unsigned long        start_micros_              = 0;
+    uint8_t              start_mode_                = 0;
+    uint8_t              switched_mode_             = 0;
+    unsigned long        mode_switch_offset_micros_ = 0;    // zero means no switch
+
+    // flicker shape
+    static const unsigned long FLICKER_PERIOD_MICROS_ = 3000;
+    static const unsigned long FLICKER_GAP_MICROS_    = 500;
+};
+
+#endif
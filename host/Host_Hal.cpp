@@ -0,0 +1,776 @@
+//============================================================================//
+//  Name    : Host_Hal.cpp                                                    //
+//  Desc    : C++ Implementation for the simulated Uno the host/ build runs   //
+//            the box's code against                                          //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - See the header for what's simulated, and what isn't           //
+//            - Also home to the things the real core and avr-libc would      //
+//              define: Serial, __brkval, and the new / delete that move it   //
+//============================================================================//
+
+// interface include
+#include "Host_Hal.h"
+
+// global includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <algorithm>
+#include <new>
+
+// the shims, for Serial and the register / bit names
+#include <Arduino.h>
+
+// the Timer1 compare match ISR (Seven_Segment_Background's)
+extern "C" void TIMER1_COMPA_vect(void);
+
+// what the real core would define
+HardwareSerial Serial;
+
+// avr-libc's top of the heap; new moves it up by whatever it hands out, and nothing ever moves it back down (so
+// it says whether anything's been allocated, not how much is in use)
+char* __brkval = (char*)Host_Hal::HEAP_START_ADDRESS_;
+
+// roughly what a 16MHz Uno takes: the Arduino pin calls are a few dozen cycles each, a port register access is
+// an sbi / cbi / in (2 cycles), micros() is a few dozen cycles, and a NeoPixel's 24 bits go out at 800kHz
+const Host_Hal::access_costs Host_Hal::UNO_COSTS_ = { 4000, 3500, 3500, 125, 3000, 30000, 0 };
+
+// static data member definitions
+uint64_t                                Host_Hal::now_nanos_         = 0;
+unsigned long                           Host_Hal::start_micros_      = 0;
+uint64_t                                Host_Hal::run_limit_nanos_   = 0;
+Host_Hal::access_costs                  Host_Hal::costs_             = Host_Hal::UNO_COSTS_;
+uint8_t                                 Host_Hal::pin_latch_    [Host_Hal::PIN_COUNT_];
+bool                                    Host_Hal::pin_is_output_[Host_Hal::PIN_COUNT_];
+int8_t                                  Host_Hal::pin_input_    [Host_Hal::PIN_COUNT_];
+uint8_t                                 Host_Hal::pin_level_    [Host_Hal::PIN_COUNT_];
+std::vector<Host_Device*>               Host_Hal::pin_devices_  [Host_Hal::PIN_COUNT_];
+std::vector<Host_Hal::scheduled_event>  Host_Hal::scheduled_events_;
+bool                                    Host_Hal::recording_         = false;
+uint32_t                                Host_Hal::recording_mask_    = 0;
+std::vector<Host_Hal::pin_event>        Host_Hal::pin_events_;
+unsigned long                           Host_Hal::pin_writes_        = 0;
+uint8_t                                 Host_Hal::io_registers_       [64];
+volatile uint8_t                        Host_Hal::memory_registers_   [256];
+volatile uint16_t                       Host_Hal::memory_registers_16_[256];
+bool                                    Host_Hal::compare_armed_      = false;
+uint64_t                                Host_Hal::next_compare_nanos_ = 0;
+bool                                    Host_Hal::compare_pending_    = false;
+bool                                    Host_Hal::in_isr_             = false;
+unsigned long                           Host_Hal::interrupt_count_    = 0;
+std::mutex                              Host_Hal::serial_mutex_;
+std::string                             Host_Hal::serial_output_;
+bool                                    Host_Hal::serial_echo_        = false;
+std::string                             Host_Hal::serial_input_;
+std::vector<Host_Hal::tone_event>       Host_Hal::tone_events_;
+std::vector<Host_Hal::show_event>       Host_Hal::show_events_;
+std::atomic<unsigned long>              Host_Hal::allocation_count_(0);
+std::atomic<uintptr_t>                  Host_Hal::heap_top_(Host_Hal::HEAP_START_ADDRESS_);
+thread_local int                        Host_Hal::bookkeeping_depth_ = 0;
+
+// the I/O addresses of the registers that get special treatment
+static const uint8_t SREG_ADDRESS_   = 0x3F;
+static const uint8_t PORTB_ADDRESS_  = 0x05;
+static const uint8_t PORTC_ADDRESS_  = 0x08;
+static const uint8_t PORTD_ADDRESS_  = 0x0B;
+
+// and the memory addresses of Timer1's
+static const uint8_t TIMSK1_ADDRESS_ = 0x6F;
+static const uint8_t TCCR1B_ADDRESS_ = 0x81;
+static const uint8_t OCR1A_ADDRESS_  = 0x88;
+
+// Timer1 prescalers, by clock select bits
+static const uint16_t TIMER1_PRESCALERS_[8] = { 0, 1, 8, 64, 256, 1024, 0, 0 };
+
+
+// put everything back the way it is at power-on, with micros() starting at the given time
+//    unsigned long start_micros - what micros() says first
+void Host_Hal::reset(unsigned long start_micros)
+{
+  now_nanos_       = 0;
+  start_micros_    = start_micros;
+  run_limit_nanos_ = 0;
+  costs_           = UNO_COSTS_;
+
+  for (uint8_t pin = 0; pin < PIN_COUNT_; pin++)
+  {
+    pin_latch_    [pin] = LOW;
+    pin_is_output_[pin] = false;
+    pin_input_    [pin] = Host_Device::RELEASED_;
+    pin_level_    [pin] = LOW;
+    pin_devices_  [pin].clear();
+  }
+  scheduled_events_.clear();
+
+  recording_      = false;
+  recording_mask_ = 0;
+  pin_events_.clear();
+  pin_writes_     = 0;
+
+  for (uint8_t i = 0; i < 64; i++) io_registers_[i] = 0;
+  for (uint16_t i = 0; i < 256; i++)
+  {
+    memory_registers_   [i] = 0;
+    memory_registers_16_[i] = 0;
+  }
+
+  // the core's init() turns interrupts on before setup()
+  io_registers_[SREG_ADDRESS_] = _BV(SREG_I);
+
+  compare_armed_      = false;
+  next_compare_nanos_ = 0;
+  compare_pending_    = false;
+  in_isr_             = false;
+  interrupt_count_    = 0;
+
+  {
+    std::lock_guard<std::mutex> lock(serial_mutex_);
+    serial_output_.clear();
+    serial_input_.clear();
+    serial_echo_ = false;
+  }
+
+  tone_events_.clear();
+  show_events_.clear();
+  allocation_count_ = 0;
+}
+
+
+//
+//  the clock
+//
+
+// the simulated time since reset()
+uint64_t Host_Hal::get_elapsed_nanos()
+{
+  return now_nanos_;
+}
+
+
+// what micros() would say (without spending the time micros() takes); wraps at 32 bits, like the box's
+unsigned long Host_Hal::get_micros()
+{
+  return (unsigned long)(uint32_t)(start_micros_ + now_nanos_ / 1000);
+}
+
+
+// move the clock on, as if the code had spent that long doing something that isn't hardware access
+void Host_Hal::advance_nanos(uint64_t nanos)
+{
+  pass_time(nanos);
+}
+
+void Host_Hal::advance_micros(unsigned long micros)
+{
+  pass_time((uint64_t)micros * 1000);
+}
+
+
+// stop the run once this long has gone by since reset(); 0 for never
+void Host_Hal::set_run_limit_micros(uint64_t elapsed_micros)
+{
+  run_limit_nanos_ = elapsed_micros * 1000;
+}
+
+
+// what hardware access costs
+void Host_Hal::set_costs(const access_costs& costs)
+{
+  costs_ = costs;
+}
+
+Host_Hal::access_costs Host_Hal::get_costs()
+{
+  return costs_;
+}
+
+
+//
+//  the pins
+//
+
+// what a pin that isn't an output reads, unless a device is driving it; now
+//    uint8_t pin   - which pin
+//    uint8_t level - HIGH or LOW
+void Host_Hal::set_input(uint8_t pin, uint8_t level)
+{
+  if (pin >= PIN_COUNT_) return;
+
+  pin_input_[pin] = (level == LOW) ? LOW : HIGH;
+  notice_pin_changes();
+}
+
+
+// as above, but from a given time on
+//    uint8_t  pin            - which pin
+//    uint8_t  level          - HIGH or LOW
+//    uint64_t elapsed_micros - when, since reset()
+void Host_Hal::schedule_input(uint8_t pin, uint8_t level, uint64_t elapsed_micros)
+{
+  scheduled_event event = { elapsed_micros * 1000, pin, level, nullptr };
+  schedule(event);
+}
+
+
+// have something happen at a given time
+//    uint64_t              elapsed_micros - when, since reset()
+//    std::function<void()> call           - what
+void Host_Hal::schedule_call(uint64_t elapsed_micros, std::function<void()> call)
+{
+  scheduled_event event = { elapsed_micros * 1000, 0, LOW, call };
+  schedule(event);
+}
+
+
+// a pin's output latch (PORTx bit)
+uint8_t Host_Hal::get_output(uint8_t pin)
+{
+  return (pin < PIN_COUNT_) ? pin_latch_[pin] : LOW;
+}
+
+
+// whether a pin's an output (DDRx bit)
+bool Host_Hal::is_output(uint8_t pin)
+{
+  return (pin < PIN_COUNT_) ? pin_is_output_[pin] : false;
+}
+
+
+// a pin's level on the wire
+uint8_t Host_Hal::read_pin(uint8_t pin)
+{
+  return (pin < PIN_COUNT_) ? wire_level(pin) : LOW;
+}
+
+
+// wire a device to a pin; it hears about every change there, and can drive it
+void Host_Hal::attach_device(Host_Device* device, uint8_t pin)
+{
+  if (pin >= PIN_COUNT_) return;
+
+  bookkeeping guard;
+  pin_devices_[pin].push_back(device);
+  notice_pin_changes();
+}
+
+
+// tells the devices (and the recording) about any pin whose level on the wire isn't what it was, again and again
+// until they've all settled (a device answering one pin by driving another)
+void Host_Hal::notice_pin_changes()
+{
+  for (uint8_t pass = 0; pass < MAX_SETTLING_PASSES_; pass++)
+  {
+    bool changed = false;
+
+    for (uint8_t pin = 0; pin < PIN_COUNT_; pin++)
+    {
+      uint8_t level = wire_level(pin);
+      if (level == pin_level_[pin]) continue;
+
+      pin_level_[pin] = level;
+      changed         = true;
+
+      if (recording_ && (recording_mask_ & (1UL << pin)))
+      {
+        bookkeeping guard;
+        pin_event   event = { now_nanos_, pin, level };
+        pin_events_.push_back(event);
+      }
+
+      for (size_t i = 0; i < pin_devices_[pin].size(); i++)
+      {
+        pin_devices_[pin][i]->on_pin_change(pin, level);
+      }
+    }
+
+    if (!changed) return;
+  }
+}
+
+
+// keep every pin change (on the given pins; a bit per pin) from now on, or stop
+void Host_Hal::set_recording(bool recording, uint32_t pin_mask)
+{
+  recording_      = recording;
+  recording_mask_ = pin_mask;
+}
+
+const std::vector<Host_Hal::pin_event>& Host_Hal::get_pin_events()
+{
+  return pin_events_;
+}
+
+void Host_Hal::clear_pin_events()
+{
+  pin_events_.clear();
+}
+
+
+// how many times the code's written an output since reset() / the last clear
+unsigned long Host_Hal::get_pin_writes()
+{
+  return pin_writes_;
+}
+
+void Host_Hal::clear_pin_writes()
+{
+  pin_writes_ = 0;
+}
+
+
+//
+//  everything else
+//
+
+// whatever's gone out over Serial since the last take
+std::string Host_Hal::take_serial_output()
+{
+  std::lock_guard<std::mutex> lock(serial_mutex_);
+
+  std::string output;
+  output.swap(serial_output_);
+  return output;
+}
+
+
+// whether Serial's echoed to stdout as it goes
+void Host_Hal::set_serial_echo(bool echo)
+{
+  std::lock_guard<std::mutex> lock(serial_mutex_);
+  serial_echo_ = echo;
+}
+
+
+// queue up bytes for the code to read from Serial
+void Host_Hal::add_serial_input(const std::string& input)
+{
+  std::lock_guard<std::mutex> lock(serial_mutex_);
+  bookkeeping guard;
+  serial_input_ += input;
+}
+
+
+// the tone() / noTone() calls and show()s so far
+const std::vector<Host_Hal::tone_event>& Host_Hal::get_tone_events()
+{
+  return tone_events_;
+}
+
+const std::vector<Host_Hal::show_event>& Host_Hal::get_show_events()
+{
+  return show_events_;
+}
+
+
+// how many times Timer1's compare match A interrupt has fired
+unsigned long Host_Hal::get_interrupt_count()
+{
+  return interrupt_count_;
+}
+
+
+// how many times anything's been allocated with new since reset()
+unsigned long Host_Hal::get_allocation_count()
+{
+  return allocation_count_;
+}
+
+
+//
+//  the shims' side
+//
+
+void Host_Hal::pin_mode(uint8_t pin, uint8_t mode)
+{
+  pass_time(costs_.pin_mode_nanos);
+  if (pin >= PIN_COUNT_) return;
+
+  // (INPUT clears the latch, and with it the pull-up; INPUT_PULLUP sets it)
+  pin_is_output_[pin] = (mode == OUTPUT);
+  if      (mode == INPUT)        pin_latch_[pin] = LOW;
+  else if (mode == INPUT_PULLUP) pin_latch_[pin] = HIGH;
+
+  notice_pin_changes();
+}
+
+
+void Host_Hal::digital_write(uint8_t pin, uint8_t level)
+{
+  pass_time(costs_.digital_write_nanos);
+  if (pin >= PIN_COUNT_) return;
+
+  pin_writes_++;
+  pin_latch_[pin] = (level == LOW) ? LOW : HIGH;
+  notice_pin_changes();
+}
+
+
+int Host_Hal::digital_read(uint8_t pin)
+{
+  pass_time(costs_.digital_read_nanos);
+  return (pin < PIN_COUNT_) ? wire_level(pin) : LOW;
+}
+
+
+unsigned long Host_Hal::read_micros()
+{
+  pass_time(costs_.micros_nanos);
+
+  // (the run only stops where the code looks at the clock; see the header)
+  if (run_limit_nanos_ != 0 && now_nanos_ >= run_limit_nanos_)
+  {
+    throw run_limit_reached();
+  }
+
+  return get_micros();
+}
+
+
+uint8_t Host_Hal::read_register(uint8_t io_address)
+{
+  pass_time(costs_.register_access_nanos);
+  return peek_register(io_address);
+}
+
+
+// a register as it is, without spending any time (for read-modify-writes, which are one instruction on the box)
+uint8_t Host_Hal::peek_register(uint8_t io_address)
+{
+  uint8_t value = 0;
+
+  for (uint8_t pin = 0; pin < PIN_COUNT_; pin++)
+  {
+    uint8_t port = pin_port_address(pin);
+    uint8_t bit  = _BV(pin_port_bit(pin));
+
+    if      (io_address == port     && pin_latch_[pin]   == HIGH) value |= bit;
+    else if (io_address == port - 1 && pin_is_output_[pin])       value |= bit;
+    else if (io_address == port - 2 && wire_level(pin)   == HIGH) value |= bit;
+  }
+
+  bool is_pin_register = (io_address >= PORTB_ADDRESS_ - 2 && io_address <= PORTD_ADDRESS_);
+  return is_pin_register ? value : io_registers_[io_address & 0x3F];
+}
+
+
+void Host_Hal::write_register(uint8_t io_address, uint8_t value)
+{
+  pass_time(costs_.register_access_nanos);
+
+  bool is_port = (io_address == PORTB_ADDRESS_ || io_address == PORTC_ADDRESS_ || io_address == PORTD_ADDRESS_);
+  bool is_ddr  = (io_address + 1 == PORTB_ADDRESS_ || io_address + 1 == PORTC_ADDRESS_ || io_address + 1 == PORTD_ADDRESS_);
+  bool is_pin  = (io_address + 2 == PORTB_ADDRESS_ || io_address + 2 == PORTC_ADDRESS_ || io_address + 2 == PORTD_ADDRESS_);
+
+  if (is_port || is_ddr || is_pin)
+  {
+    uint8_t port = is_port ? io_address : (is_ddr ? io_address + 1 : io_address + 2);
+
+    for (uint8_t pin = 0; pin < PIN_COUNT_; pin++)
+    {
+      if (pin_port_address(pin) != port) continue;
+
+      bool bit_set = value & _BV(pin_port_bit(pin));
+      if      (is_port) pin_latch_[pin]     = bit_set ? HIGH : LOW;
+      else if (is_ddr)  pin_is_output_[pin] = bit_set;
+      else if (bit_set) pin_latch_[pin]     = (pin_latch_[pin] == HIGH) ? LOW : HIGH;  // (writing PINx toggles)
+    }
+
+    if (!is_ddr) pin_writes_++;
+    notice_pin_changes();
+    return;
+  }
+
+  io_registers_[io_address & 0x3F] = value;
+
+  // interrupts just came back on; anything waiting goes now
+  if (io_address == SREG_ADDRESS_ && (value & _BV(SREG_I)))
+  {
+    try_fire_compare();
+  }
+}
+
+
+volatile uint8_t& Host_Hal::memory_register(uint16_t address)
+{
+  return memory_registers_[address & 0xFF];
+}
+
+
+volatile uint16_t& Host_Hal::memory_register_16(uint16_t address)
+{
+  return memory_registers_16_[address & 0xFF];
+}
+
+
+void Host_Hal::tone(uint8_t pin, unsigned int frequency, unsigned long duration_millis)
+{
+  bookkeeping guard;
+  tone_event  event = { now_nanos_, pin, frequency, duration_millis };
+  tone_events_.push_back(event);
+}
+
+
+void Host_Hal::set_interrupts_enabled(bool enabled)
+{
+  if (enabled)
+  {
+    io_registers_[SREG_ADDRESS_] |= _BV(SREG_I);
+    try_fire_compare();
+  }
+  else
+  {
+    io_registers_[SREG_ADDRESS_] &= ~_BV(SREG_I);
+  }
+}
+
+
+// a NeoPixel show(): the whole strip's bits, with interrupts off the whole time
+void Host_Hal::show(uint8_t pin, const uint8_t* bytes, uint16_t pixels)
+{
+  {
+    bookkeeping guard;
+    show_event  event = { now_nanos_, pin, std::vector<uint8_t>(bytes, bytes + pixels * 3) };
+    show_events_.push_back(event);
+  }
+
+  uint8_t old_sreg = io_registers_[SREG_ADDRESS_];
+  io_registers_[SREG_ADDRESS_] &= ~_BV(SREG_I);
+
+  pass_time((uint64_t)pixels * costs_.pixel_show_nanos);
+
+  io_registers_[SREG_ADDRESS_] = old_sreg;
+  try_fire_compare();
+}
+
+
+void Host_Hal::serial_write(uint8_t byte)
+{
+  {
+    std::lock_guard<std::mutex> lock(serial_mutex_);
+    bookkeeping                 guard;
+
+    serial_output_ += (char)byte;
+    if (serial_echo_) fputc(byte, stdout);
+  }
+
+  // (free unless asked otherwise, so threads that never touch the clock can print)
+  if (costs_.serial_byte_nanos != 0) pass_time(costs_.serial_byte_nanos);
+}
+
+
+int Host_Hal::serial_available()
+{
+  std::lock_guard<std::mutex> lock(serial_mutex_);
+  return (int)serial_input_.size();
+}
+
+
+int Host_Hal::serial_read()
+{
+  std::lock_guard<std::mutex> lock(serial_mutex_);
+
+  if (serial_input_.empty()) return -1;
+
+  uint8_t byte = (uint8_t)serial_input_[0];
+  serial_input_.erase(0, 1);
+  return byte;
+}
+
+
+// something just got allocated; the heap grows to match
+//    size_t size - how much
+void Host_Hal::note_allocation(size_t size)
+{
+  if (bookkeeping_depth_ > 0) return;
+
+  allocation_count_++;
+  __brkval = (char*)(heap_top_ += size);
+}
+
+
+//
+//  private methods
+//
+
+// helper method; the I/O address of a pin's PORTx register
+uint8_t Host_Hal::pin_port_address(uint8_t pin)
+{
+  return (pin < 8) ? PORTD_ADDRESS_ : ((pin < 14) ? PORTB_ADDRESS_ : PORTC_ADDRESS_);
+}
+
+
+// helper method; which bit of its port a pin is
+uint8_t Host_Hal::pin_port_bit(uint8_t pin)
+{
+  return (pin < 8) ? pin : ((pin < 14) ? pin - 8 : pin - 14);
+}
+
+
+// helper method; a pin's level on the wire: its output if it's an output; otherwise LOW if any device pulls it
+// low, HIGH if one drives it high, the test's input if there is one, or else the pull-up (the latch)
+uint8_t Host_Hal::wire_level(uint8_t pin)
+{
+  if (pin_is_output_[pin])
+  {
+    return pin_latch_[pin];
+  }
+
+  bool driven_high = false;
+  for (size_t i = 0; i < pin_devices_[pin].size(); i++)
+  {
+    int8_t drive = pin_devices_[pin][i]->get_drive(pin);
+
+    if (drive == LOW)  return LOW;
+    if (drive == HIGH) driven_high = true;
+  }
+
+  if (driven_high)                               return HIGH;
+  if (pin_input_[pin] != Host_Device::RELEASED_) return (uint8_t)pin_input_[pin];
+
+  return pin_latch_[pin];
+}
+
+
+// helper method; files an event away in time order (or does it now, if its time's been and gone)
+void Host_Hal::schedule(const scheduled_event& event)
+{
+  if (event.nanos <= now_nanos_)
+  {
+    if (event.call) event.call();
+    else            pin_input_[event.pin] = (event.level == LOW) ? LOW : HIGH;
+
+    notice_pin_changes();
+    return;
+  }
+
+  // soonest last; anything already waiting for the same time goes first, so it stays behind us
+  std::vector<scheduled_event>::iterator position =
+    std::find_if(scheduled_events_.begin(), scheduled_events_.end(), [&](const scheduled_event& e) { return e.nanos <= event.nanos; });
+  bookkeeping guard;
+  scheduled_events_.insert(position, event);
+}
+
+
+// helper method; moves the clock on, applying scheduled events and firing the timer interrupt on the way (an ISR's
+// own hardware access moves the clock too, so an interrupt landing in the middle makes whatever it interrupted late,
+// as it would on the box)
+void Host_Hal::pass_time(uint64_t nanos)
+{
+  uint64_t target = now_nanos_ + nanos;
+
+  while (true)
+  {
+    // anything that came due while interrupts were off goes first
+    if (try_fire_compare()) continue;
+
+    // Timer1 only counts towards a compare match while one's enabled; it starts a full period out
+    uint64_t period = compare_period_nanos();
+    if (period == 0 || !(memory_registers_[TIMSK1_ADDRESS_] & _BV(OCIE1A)))
+    {
+      compare_armed_ = false;
+    }
+    else if (!compare_armed_)
+    {
+      compare_armed_      = true;
+      next_compare_nanos_ = now_nanos_ + period;
+    }
+
+    // whichever's next, if it's before the target
+    bool event_due   = !scheduled_events_.empty() && scheduled_events_.back().nanos <= target;
+    bool compare_due = compare_armed_ && next_compare_nanos_ <= target;
+
+    if (event_due && (!compare_due || scheduled_events_.back().nanos <= next_compare_nanos_))
+    {
+      scheduled_event event = std::move(scheduled_events_.back());
+      scheduled_events_.pop_back();
+
+      now_nanos_ = std::max(now_nanos_, event.nanos);
+      schedule(event);
+    }
+    else if (compare_due)
+    {
+      now_nanos_          = std::max(now_nanos_, next_compare_nanos_);
+      next_compare_nanos_ += period;
+      compare_pending_    = true;
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  now_nanos_ = std::max(now_nanos_, target);
+}
+
+
+// helper method; Timer1's compare period as set up now (CTC on OCR1A), 0 if it's stopped
+uint64_t Host_Hal::compare_period_nanos()
+{
+  uint16_t prescaler = TIMER1_PRESCALERS_[memory_registers_[TCCR1B_ADDRESS_] & 0x07];
+
+  // 62.5ns a CPU cycle
+  return ((uint64_t)memory_registers_16_[OCR1A_ADDRESS_] + 1) * prescaler * 125 / 2;
+}
+
+
+// helper method; runs the ISR now, if one's due and nothing's stopping it; returns true if it did
+bool Host_Hal::try_fire_compare()
+{
+  if (!compare_pending_ || in_isr_ || !(io_registers_[SREG_ADDRESS_] & _BV(SREG_I)))
+  {
+    return false;
+  }
+
+  // the hardware clears the flag and I on the way in, and reti puts I back
+  compare_pending_ = false;
+  in_isr_          = true;
+  interrupt_count_++;
+  io_registers_[SREG_ADDRESS_] &= ~_BV(SREG_I);
+
+  TIMER1_COMPA_vect();
+
+  io_registers_[SREG_ADDRESS_] |= _BV(SREG_I);
+  in_isr_ = false;
+
+  return true;
+}
+
+
+//
+//  new and delete, counted
+//
+
+void* operator new(size_t size)
+{
+  Host_Hal::note_allocation(size);
+
+  void* memory = malloc(size == 0 ? 1 : size);
+  if (memory == NULL) throw std::bad_alloc();
+  return memory;
+}
+
+void* operator new[](size_t size)
+{
+  return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+  free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+  free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+  free(memory);
+}
+
+void operator delete[](void* memory, size_t) noexcept
+{
+  free(memory);
+}
@@ -0,0 +1,323 @@
+//============================================================================//
+//  Name    : Host_Hal.h                                                      //
+//  Desc    : C++ Interface for the simulated Uno the host/ build runs the    //
+//            box's code against: pins, a clock, Timer1, Serial and NeoPixels //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Everything behind the shim headers (shim/Arduino.h,           //
+//              shim/avr/io.h, shim/Adafruit_NeoPixel.h) ends up in here, so  //
+//              the classes in the repo root compile for Linux unchanged      //
+//            - Time only passes when the code touches the hardware: every    //
+//              digitalWrite(), register access, micros() and show() costs    //
+//              roughly what it costs on a 16MHz Uno (see access_costs), and  //
+//              nothing else costs anything. So host timings are the I/O's    //
+//              share of the real thing, not the whole of it                  //
+//            - The clock starts wherever reset() says, e.g. just short of    //
+//              micros() wrapping, and can be told to throw run_limit_reached //
+//              once it's gone far enough; that's the only way out of the     //
+//              sketch's while (true) loop. It only throws from micros() /    //
+//              millis(), never partway through a pin wiggle, so a stopped    //
+//              run can't leave a display's CLK and DIO half-way through a    //
+//              unit that the box itself would always have finished           //
+//            - Pins are the Uno's 0-19, with PORTB / PORTC / PORTD and their //
+//              DDR and PIN registers mapped onto them. A pin's level on the  //
+//              wire is its output if it's an output; otherwise LOW if any    //
+//              attached device pulls it low, HIGH if one drives it high,     //
+//              whatever the test set it to (set_input() / schedule_input()), //
+//              or else HIGH with the pull-up on and LOW without              //
+//            - Timer1's compare match A interrupt fires on time while it's   //
+//              enabled and interrupts are on; show() keeps them off for as   //
+//              long as it would on the box                                   //
+//            - Everything here is static and single-threaded, like the box;  //
+//              the only things safe to use from several threads at once are  //
+//              Serial, new, and the classes that never touch the hardware   //
+//              (e.g. Hit_Detector)                                           //
+//============================================================================//
+
+#ifndef HOST_HAL_H
+#define HOST_HAL_H
+
+// global includes
+#include <inttypes.h>
+#include <stddef.h>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// A device wired to some of the simulated pins, e.g. the weapons (see Weapon_Circuit)
+class Host_Device
+{
+  public:
+
+    // what get_drive() says when the device is leaving a pin alone
+    static const int8_t RELEASED_ = -1;
+
+    // Destructor
+    virtual ~Host_Device() {}
+
+    // a pin the device's attached to just changed level on the wire
+    //    uint8_t pin   - which pin
+    //    uint8_t level - HIGH or LOW, as it is now
+    virtual void on_pin_change(uint8_t pin, uint8_t level) = 0;
+
+    // what the device is doing to one of its pins right now: driving it HIGH or LOW, or RELEASED_
+    //    uint8_t pin - which pin
+    virtual int8_t get_drive(uint8_t pin) = 0;
+};
+
+// A static class simulating the Uno the box's code runs on
+class Host_Hal
+{
+  public:
+
+    // thrown by the clock once the run limit's been passed
+    struct run_limit_reached
+    {
+    };
+
+    // what each piece of hardware access costs, in nanoseconds of simulated time
+    struct access_costs
+    {
+      uint32_t pin_mode_nanos;            // pinMode()
+      uint32_t digital_write_nanos;       // digitalWrite()
+      uint32_t digital_read_nanos;        // digitalRead()
+      uint32_t register_access_nanos;     // a read or write of an I/O register (sbi, cbi, in, out...)
+      uint32_t micros_nanos;              // micros() / millis()
+      uint32_t pixel_show_nanos;          // show(), per pixel, with interrupts off
+      uint32_t serial_byte_nanos;         // one byte out over Serial (0 is free: the box buffers it)
+    };
+
+    // one change of a pin on the wire, if recording
+    struct pin_event
+    {
+      uint64_t nanos;                     // since reset()
+      uint8_t  pin;
+      uint8_t  level;
+    };
+
+    // one tone() (frequency 0 for noTone())
+    struct tone_event
+    {
+      uint64_t      nanos;                // since reset()
+      uint8_t       pin;
+      unsigned int  frequency;
+      unsigned long duration_millis;
+    };
+
+    // one NeoPixel show()
+    struct show_event
+    {
+      uint64_t             nanos;         // since reset(), when it began
+      uint8_t              pin;
+      std::vector<uint8_t> bytes;         // what went out, three (GRB) a pixel
+    };
+
+    // how many pins there are
+    static const uint8_t PIN_COUNT_ = 20;
+
+    // where __brkval starts (the top of the Uno's static data, give or take; it's only ever compared with itself)
+    static const uintptr_t HEAP_START_ADDRESS_ = 0x0300;
+
+    // roughly what a 16MHz Uno takes
+    static const access_costs UNO_COSTS_;
+
+    // put everything back the way it is at power-on (every pin an input, reading low, nothing attached, nothing
+    // recorded) with micros() starting at the given time
+    //    unsigned long start_micros - what micros() says first
+    static void reset(unsigned long start_micros = 0);
+
+    //
+    //  the clock
+    //
+
+    // the simulated time since reset(), and what micros() would say
+    static uint64_t      get_elapsed_nanos();
+    static unsigned long get_micros();
+
+    // move the clock on, as if the code had spent that long doing something that isn't hardware access
+    static void advance_nanos(uint64_t nanos);
+    static void advance_micros(unsigned long micros);
+
+    // stop the run (by throwing run_limit_reached from the next micros() / millis()) once this long has gone by since
+    // reset(); 0 for never
+    static void set_run_limit_micros(uint64_t elapsed_micros);
+
+    // what hardware access costs
+    static void         set_costs(const access_costs& costs);
+    static access_costs get_costs();
+
+    //
+    //  the pins
+    //
+
+    // what a pin that isn't an output reads, unless a device is driving it; now, or from a given time on
+    //    uint8_t  pin            - which pin
+    //    uint8_t  level          - HIGH or LOW
+    //    uint64_t elapsed_micros - when, since reset()
+    static void set_input(uint8_t pin, uint8_t level);
+    static void schedule_input(uint8_t pin, uint8_t level, uint64_t elapsed_micros);
+
+    // have something happen at a given time, e.g. a blade landing (see Weapon_Circuit)
+    //    uint64_t              elapsed_micros - when, since reset()
+    //    std::function<void()> call           - what
+    static void schedule_call(uint64_t elapsed_micros, std::function<void()> call);
+
+    // a pin as the code set it up: its output latch (PORTx bit), and whether it's an output (DDRx bit)
+    static uint8_t get_output(uint8_t pin);
+    static bool    is_output(uint8_t pin);
+
+    // a pin's level on the wire
+    static uint8_t read_pin(uint8_t pin);
+
+    // wire a device to a pin; it hears about every change there, and can drive it
+    static void attach_device(Host_Device* device, uint8_t pin);
+
+    // tells the devices (and the recording) about any pin whose level on the wire isn't what it was; for a device
+    // that's changed what it drives without being asked (e.g. a blade landing)
+    static void notice_pin_changes();
+
+    // keep every pin change (on the given pins; a bit per pin) from now on, or stop
+    static void                          set_recording(bool recording, uint32_t pin_mask = 0xFFFFF);
+    static const std::vector<pin_event>& get_pin_events();
+    static void                          clear_pin_events();
+
+    // how many times the code's written an output (by digitalWrite() or a port register) since reset() / the last
+    // clear; every write counts, whether or not it changed anything
+    static unsigned long get_pin_writes();
+    static void          clear_pin_writes();
+
+    //
+    //  everything else
+    //
+
+    // whatever's gone out over Serial since the last take, and whether it's echoed to stdout as it goes
+    static std::string take_serial_output();
+    static void        set_serial_echo(bool echo);
+
+    // queue up bytes for the code to read from Serial
+    static void add_serial_input(const std::string& input);
+
+    // the tone() / noTone() calls and show()s so far
+    static const std::vector<tone_event>& get_tone_events();
+    static const std::vector<show_event>& get_show_events();
+
+    // how many times Timer1's compare match A interrupt has fired
+    static unsigned long get_interrupt_count();
+
+    // how many times anything's been allocated with new since reset() (it moves __brkval too, as the heap would);
+    // what Host_Hal itself allocates to record events and Serial doesn't count, so this is the box's (and the test's)
+    static unsigned long get_allocation_count();
+
+    //
+    //  the shims' side; not for tests
+    //
+
+    static void    pin_mode(uint8_t pin, uint8_t mode);
+    static void    digital_write(uint8_t pin, uint8_t level);
+    static int     digital_read(uint8_t pin);
+    static unsigned long read_micros();
+    static uint8_t read_register(uint8_t io_address);
+    static uint8_t peek_register(uint8_t io_address);
+    static void    write_register(uint8_t io_address, uint8_t value);
+    static volatile uint8_t&  memory_register(uint16_t address);
+    static volatile uint16_t& memory_register_16(uint16_t address);
+    static void    tone(uint8_t pin, unsigned int frequency, unsigned long duration_millis);
+    static void    set_interrupts_enabled(bool enabled);
+    static void    show(uint8_t pin, const uint8_t* bytes, uint16_t pixels);
+    static void    serial_write(uint8_t byte);
+    static int     serial_available();
+    static int     serial_read();
+    static void    note_allocation(size_t size);
+
+  private:
+
+    // a change to a pin's input (or anything else), waiting for its time
+    struct scheduled_event
+    {
+      uint64_t              nanos;
+      uint8_t               pin;
+      uint8_t               level;
+      std::function<void()> call;         // instead of the pin, if there is one
+    };
+
+    // while one of these is alive, anything this thread allocates is Host_Hal's own bookkeeping, not the box's
+    struct bookkeeping
+    {
+      bookkeeping()  { bookkeeping_depth_++; }
+      ~bookkeeping() { bookkeeping_depth_--; }
+    };
+    static thread_local int bookkeeping_depth_;
+
+    // helper methods; where a pin is in the port registers
+    static uint8_t pin_port_address(uint8_t pin);
+    static uint8_t pin_port_bit(uint8_t pin);
+
+    // helper method; a pin's level on the wire, by the rules at the top
+    static uint8_t wire_level(uint8_t pin);
+
+    // helper method; files an event away in time order
+    static void schedule(const scheduled_event& event);
+
+    // helper method; moves the clock on, applying scheduled events and firing the timer interrupt on the way
+    static void pass_time(uint64_t nanos);
+
+    // the clock: nanoseconds since reset(), where micros() started, and when to stop (0 for never)
+    static uint64_t       now_nanos_;
+    static unsigned long  start_micros_;
+    static uint64_t       run_limit_nanos_;
+    static access_costs   costs_;
+
+    // the pins: output latch, direction, what the test says the input is (RELEASED_ for nothing), and the level
+    // on the wire as of the last look
+    static uint8_t        pin_latch_      [PIN_COUNT_];
+    static bool           pin_is_output_  [PIN_COUNT_];
+    static int8_t         pin_input_      [PIN_COUNT_];
+    static uint8_t        pin_level_      [PIN_COUNT_];
+    static std::vector<Host_Device*>     pin_devices_[PIN_COUNT_];
+    static std::vector<scheduled_event>  scheduled_events_;      // soonest last
+
+    // pin recording and counting
+    static bool                   recording_;
+    static uint32_t               recording_mask_;
+    static std::vector<pin_event> pin_events_;
+    static unsigned long          pin_writes_;
+
+    // the registers that aren't pins: the rest of the I/O space, and the memory-mapped ones (8 and 16 bit)
+    static uint8_t                io_registers_       [64];
+    static volatile uint8_t       memory_registers_   [256];
+    static volatile uint16_t      memory_registers_16_[256];
+
+    // Timer1's compare match A: whether it's counting towards one, when it lands, whether one's waiting on
+    // interrupts coming back on, and whether the ISR's running now
+    static bool                   compare_armed_;
+    static uint64_t               next_compare_nanos_;
+    static bool                   compare_pending_;
+    static bool                   in_isr_;
+    static unsigned long          interrupt_count_;
+
+    // Serial, both ways
+    static std::mutex             serial_mutex_;
+    static std::string            serial_output_;
+    static bool                   serial_echo_;
+    static std::string            serial_input_;
+
+    // everything else that gets recorded
+    static std::vector<tone_event> tone_events_;
+    static std::vector<show_event> show_events_;
+    static std::atomic<unsigned long> allocation_count_;
+    static std::atomic<uintptr_t>     heap_top_;
+
+    // most rounds of devices answering pin changes with pin changes before we stop listening
+    static const uint8_t MAX_SETTLING_PASSES_ = 8;
+
+    // helper method; Timer1's compare period as set up now (0 if it's stopped)
+    static uint64_t compare_period_nanos();
+
+    // helper method; runs the ISR now, if nothing's stopping it; returns true if it did
+    static bool try_fire_compare();
+};
+
+#endif
@@ -0,0 +1,39 @@
+//============================================================================//
+//  Name    : Host_Sketch.h                                                   //
+//  Desc    : The sketch itself (setup(), loop() and all its globals), for    //
+//            host/ programs that run the box as a whole                      //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Include from exactly one file per program; the sketch's       //
+//              globals are defined, not declared                             //
+//            - The DEBUG level comes from the build (each program in         //
+//              CMakeLists.txt picks its own); the sketch's own 0 otherwise   //
+//            - loop() never returns; run_sketch_until() sets a run limit on  //
+//              Host_Hal and catches Host_Hal::run_limit_reached              //
+//============================================================================//
+
+#ifndef HOST_SKETCH_H
+#define HOST_SKETCH_H
+
+// what the Arduino IDE puts ahead of every sketch
+#include <Arduino.h>
+
+// the sketch
+#include "../Fencing_Box_Brain.ino"
+
+// runs the sketch until the given time; loop() starts over on every call, with the globals as they were left
+//    uint64_t elapsed_micros - when to stop, since Host_Hal::reset()
+inline void run_sketch_until(uint64_t elapsed_micros)
+{
+  Host_Hal::set_run_limit_micros(elapsed_micros);
+  try
+  {
+    loop();
+  }
+  catch (Host_Hal::run_limit_reached&)
+  {
+  }
+}
+
+#endif
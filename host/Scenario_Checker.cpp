@@ -0,0 +1,235 @@
+//============================================================================//
+//  Name    : Scenario_Checker.cpp                                            //
+//  Desc    : C++ Implementation for running generated Hit_Scenarios through  //
+//            a Hit_Detector and checking every decision                      //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//============================================================================//
+
+// interface include
+#include "Scenario_Checker.h"
+
+// the rules as written, indexed by mode
+const unsigned long Scenario_Checker::CONTACT_MICROS_BY_MODE_[Hit_Scenario::MODE_COUNT_] =
+  { Hit_Detector::SABER_CONTACT_MICROS_, Hit_Detector::FOIL_CONTACT_MICROS_, Hit_Detector::EPEE_CONTACT_MICROS_ };
+const unsigned long Scenario_Checker::LOCKOUT_MICROS_BY_MODE_[Hit_Scenario::MODE_COUNT_] =
+  { Hit_Detector::SABER_LOCKOUT_MICROS_, Hit_Detector::FOIL_LOCKOUT_MICROS_, Hit_Detector::EPEE_LOCKOUT_MICROS_ };
+
+// what to call each violation
+static const char* const VIOLATION_NAMES_[Scenario_Checker::VIOLATION_COUNT_] =
+  { "none", "hit after lockout", "double touch too late", "hit without contact", "missed hit", "lockout never came",
+    "stuck lockout" };
+
+
+// Constructor
+Scenario_Checker::Scenario_Checker()
+{
+  // no-op; the detector starts out with the rules as written
+}
+
+
+// runs one scenario through the detection, sample by sample
+//    Hit_Scenario& scenario - the scenario to run
+//    outcome&      result   - filled in with what the detection made of it (as far as it got)
+Scenario_Checker::violation Scenario_Checker::check(Hit_Scenario& scenario, outcome& result)
+{
+  Hit_Detector& detector = this->detector_;
+
+  unsigned long longest_lockout = 0;
+  for (uint8_t i = 0; i < Hit_Scenario::MODE_COUNT_; i++)
+  {
+    if (detector.get_lockout_micros(i) > longest_lockout) longest_lockout = detector.get_lockout_micros(i);
+  }
+
+  unsigned long start_time    = scenario.get_start_micros();
+  unsigned long contacts_end  = scenario.get_last_event_end_micros() + 2 * SAMPLE_MICROS_;
+  unsigned long run_end       = contacts_end + 2 * longest_lockout + detector.get_light_duration_micros() + SETTLE_MICROS_;
+  unsigned long offset        = 0;
+  unsigned long step          = SAMPLE_MICROS_;   // how far the last sample moved; the slack every timing check allows
+  unsigned long lockout_bound = 0;                // longest lockout in force at any sample since the touch's first hit
+  uint8_t       lockouts      = 0;
+
+  result.left_scored  = false;
+  result.right_scored = false;
+  result.extra_hits   = 0;
+
+  detector.reset();
+
+  while (offset < run_end)
+  {
+    // as micros() would read on the box, wrapping around and all
+    unsigned long sample_time  = (uint32_t)(start_time + offset);
+    uint8_t       sample_mode  = scenario.get_mode_at(sample_time);
+    uint8_t       sample_lines = scenario.get_lines_at(sample_time, sample_mode);
+
+    bool left_had_hit   = detector.has_left_hit();
+    bool right_had_hit  = detector.has_right_hit();
+    bool was_locked_out = detector.is_locked_out();
+
+    detector.set_mode(sample_mode);
+    detector.process_line_sample(sample_time, sample_lines);
+
+    bool          left_has_hit  = detector.has_left_hit();
+    bool          right_has_hit = detector.has_right_hit();
+    bool          locked_out    = detector.is_locked_out();
+    bool          left_new_hit  = left_has_hit  && !left_had_hit;
+    bool          right_new_hit = right_has_hit && !right_had_hit;
+    unsigned long left_held     = scenario.get_contact_held_micros(Hit_Scenario::LEFT_FENCER_,  sample_time);
+    unsigned long right_held    = scenario.get_contact_held_micros(Hit_Scenario::RIGHT_FENCER_, sample_time);
+    unsigned long contact       = detector.get_contact_micros(sample_mode);
+
+    // tally up the outcome; anything after the first lockout is a touch of its own
+    if (lockouts == 0)
+    {
+      result.left_scored  = result.left_scored  || left_new_hit;
+      result.right_scored = result.right_scored || right_new_hit;
+    }
+    else
+    {
+      result.extra_hits  += (left_new_hit ? 1 : 0) + (right_new_hit ? 1 : 0);
+    }
+
+    if (locked_out && !was_locked_out)
+    {
+      lockouts++;
+    }
+
+    // the lockout is re-read from the mode every sample, so a mode switch mid-touch can stretch it
+    if (left_has_hit || right_has_hit)
+    {
+      if (detector.get_lockout_micros(sample_mode) > lockout_bound) lockout_bound = detector.get_lockout_micros(sample_mode);
+    }
+    else
+    {
+      lockout_bound = 0;
+    }
+
+    // nothing gets through a lockout
+    if ((left_new_hit || right_new_hit) && was_locked_out)
+    {
+      return HIT_AFTER_LOCKOUT;
+    }
+
+    // the second half of a double touch has to land inside the first half's lockout
+    if ((left_new_hit || right_new_hit) && left_has_hit && right_has_hit)
+    {
+      unsigned long gap = left_new_hit ? (uint32_t)(detector.get_left_hit_micros()  - detector.get_right_hit_micros())
+                                       : (uint32_t)(detector.get_right_hit_micros() - detector.get_left_hit_micros());
+      if (gap > lockout_bound + step)
+      {
+        return DOUBLE_TOUCH_TOO_LATE;
+      }
+    }
+
+    // a hit takes a contact held for longer than the contact time...
+    if ((left_new_hit  && left_held  != Hit_Scenario::UNKNOWN_CONTACT_ && !(left_held  > contact)) ||
+        (right_new_hit && right_held != Hit_Scenario::UNKNOWN_CONTACT_ && !(right_held > contact)))
+    {
+      return HIT_WITHOUT_CONTACT;
+    }
+
+    // ...and a contact held well past it is a hit, unless the lockout got there first
+    if (!locked_out &&
+        ((!left_has_hit  && left_held  != Hit_Scenario::UNKNOWN_CONTACT_ && left_held  > contact + 2 * step) ||
+         (!right_has_hit && right_held != Hit_Scenario::UNKNOWN_CONTACT_ && right_held > contact + 2 * step)))
+    {
+      return MISSED_HIT;
+    }
+
+    // every hit locks out once its lockout runs out
+    if (!locked_out &&
+        ((left_has_hit  && (uint32_t)(sample_time - detector.get_left_hit_micros())  > lockout_bound + step) ||
+         (right_has_hit && (uint32_t)(sample_time - detector.get_right_hit_micros()) > lockout_bound + step)))
+    {
+      return LOCKOUT_NEVER_CAME;
+    }
+
+    // and the lockout goes away with the lights
+    if (locked_out && (uint32_t)(sample_time - detector.get_lockout_micros()) > detector.get_light_duration_micros() + step)
+    {
+      return STUCK_LOCKOUT;
+    }
+
+    // once the contacts are over only the lockout and lights are left to play out, so look less closely
+    step    = (offset < contacts_end) ? SAMPLE_MICROS_ : SETTLE_MICROS_;
+    offset += step;
+
+    // with nothing on the lines and nothing going on, every sample until the next contact would be this one over
+    // again (nothing in the detection moves with time when it's idle), so go straight to the first sample that
+    // could see it; most of a scenario is the wait between contacts
+    if (sample_lines == 0 && !detector.is_contact_pending() && !locked_out && offset < contacts_end)
+    {
+      unsigned long next_change = scenario.get_next_change_offset(sample_time);
+      if (next_change != Hit_Scenario::NO_CHANGE_ && next_change > offset)
+      {
+        offset += (next_change - offset + SAMPLE_MICROS_ - 1) / SAMPLE_MICROS_ * SAMPLE_MICROS_;
+      }
+    }
+
+    // and once those are over too, there's nothing left to check
+    if (!(offset < contacts_end) && !locked_out && !left_has_hit && !right_has_hit)
+    {
+      break;
+    }
+  }
+
+  return NO_VIOLATION;
+}
+
+
+// simplifies a failing scenario for as long as it keeps failing the same way
+//    Hit_Scenario& scenario - the failing scenario; simplified in place
+//    violation     failure  - how it fails
+void Scenario_Checker::shrink(Hit_Scenario& scenario, violation failure)
+{
+  Hit_Scenario candidate;
+  outcome      result;
+  bool         shrunk = true;
+
+  while (shrunk)
+  {
+    shrunk = false;
+
+    candidate = scenario;
+    if (candidate.clear_mode_switch() && this->check(candidate, result) == failure)
+    {
+      scenario = candidate;
+      shrunk   = true;
+    }
+
+    // NB: a removal shifts the later contacts down one, so this can skip one; the next pass gets it
+    for (uint8_t i = 0; i < scenario.get_event_count(); i++)
+    {
+      candidate = scenario;
+      if (candidate.remove_event(i) && this->check(candidate, result) == failure)
+      {
+        scenario = candidate;
+        shrunk   = true;
+        continue;
+      }
+
+      candidate = scenario;
+      if (candidate.clear_flickering(i) && this->check(candidate, result) == failure)
+      {
+        scenario = candidate;
+        shrunk   = true;
+      }
+    }
+  }
+}
+
+
+// the detection being checked
+Hit_Detector& Scenario_Checker::get_detector()
+{
+  return this->detector_;
+}
+
+
+// a few words on a violation, for printing
+//    violation failure - which
+const char* Scenario_Checker::get_violation_name(violation failure)
+{
+  return (failure < VIOLATION_COUNT_) ? VIOLATION_NAMES_[failure] : "unknown";
+}
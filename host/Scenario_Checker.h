@@ -0,0 +1,89 @@
+//============================================================================//
+//  Name    : Scenario_Checker.h                                              //
+//  Desc    : C++ Interface for running generated Hit_Scenarios through a     //
+//            Hit_Detector and checking every decision against what the       //
+//            scenario says really happened on the strip, for the host/ build //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Each checker has a Hit_Detector of its own and nothing        //
+//              shared, so one per thread runs scenarios in parallel          //
+//            - Samples come every SAMPLE_MICROS_ (about a main loop pass)    //
+//              while contacts are going on, then every SETTLE_MICROS_ while  //
+//              the lockout and lights play out; times wrap at 32 bits, as    //
+//              micros() does on the box                                      //
+//            - Every timing check allows a sample's worth of slack, since    //
+//              the box only sees the lines once a pass                       //
+//============================================================================//
+
+#ifndef SCENARIO_CHECKER_H
+#define SCENARIO_CHECKER_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+
+// local includes
+#include "Hit_Detector.h"
+#include "Hit_Scenario.h"
+
+// A class to check the hit detection against generated scenarios
+class Scenario_Checker
+{
+  public:
+
+    // the ways a generated scenario can catch the hit detection misbehaving
+    enum violation
+    {
+      NO_VIOLATION,
+      HIT_AFTER_LOCKOUT,          // a hit registered while already locked out
+      DOUBLE_TOUCH_TOO_LATE,      // a second hit registered further after the first than the lockout allows
+      HIT_WITHOUT_CONTACT,        // a hit registered before the contact had been held for the contact time
+      MISSED_HIT,                 // a contact was held well past the contact time without registering
+      LOCKOUT_NEVER_CAME,         // a hit registered but the lockout didn't follow it in time
+      STUCK_LOCKOUT,              // the lockout outlasted the lights
+      VIOLATION_COUNT_
+    };
+
+    // what the hit detection made of a scenario
+    struct outcome
+    {
+      bool    left_scored;        // left fencer's hit registered before the first lockout
+      bool    right_scored;       // right fencer's hit registered before the first lockout
+      uint8_t extra_hits;         // hits registered after the first lockout, i.e., touches the rules say never happened
+    };
+
+    // the rules as written, indexed by mode; scenarios are built (and judged) around these
+    static const unsigned long CONTACT_MICROS_BY_MODE_[Hit_Scenario::MODE_COUNT_];
+    static const unsigned long LOCKOUT_MICROS_BY_MODE_[Hit_Scenario::MODE_COUNT_];
+
+    // how often the lines are sampled: about a main loop pass, and once only the lockout / lights are left
+    static const unsigned long SAMPLE_MICROS_ = 250;
+    static const unsigned long SETTLE_MICROS_ = 10000;
+
+    // Constructor
+    Scenario_Checker();
+
+    // runs one scenario through the detection, sample by sample; returns the first invariant broken, or NO_VIOLATION
+    //    Hit_Scenario& scenario - the scenario to run
+    //    outcome&      result   - filled in with what the detection made of it (as far as it got)
+    violation check(Hit_Scenario& scenario, outcome& result);
+
+    // simplifies a failing scenario for as long as it keeps failing the same way: drops the mode switch, drops
+    // contacts, and steadies flickering ones, one at a time
+    //    Hit_Scenario& scenario - the failing scenario; simplified in place
+    //    violation     failure  - how it fails
+    void shrink(Hit_Scenario& scenario, violation failure);
+
+    // the detection being checked, e.g. to try other timings on it
+    Hit_Detector& get_detector();
+
+    // a few words on a violation, for printing
+    static const char* get_violation_name(violation failure);
+
+  private:
+
+    Hit_Detector detector_;
+};
+
+#endif
@@ -0,0 +1,290 @@
+//============================================================================//
+//  Name    : Tm1637_Model.cpp                                                //
+//  Desc    : C++ Implementation for a TM1637 display module on the simulated //
+//            Uno                                                             //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//============================================================================//
+
+// interface include
+#include "Tm1637_Model.h"
+
+// global includes
+#include <algorithm>
+
+// the chip's command bytes, by their top two bits
+static const uint8_t COMMAND_TYPE_MASK_    = 0xC0;
+static const uint8_t DATA_COMMAND_         = 0x40;
+static const uint8_t DISPLAY_CONTROL_      = 0x80;
+static const uint8_t ADDRESS_COMMAND_      = 0xC0;
+
+// in a data command, fixed addressing instead of auto-increment
+static const uint8_t FIXED_ADDRESS_BIT_    = 0x04;
+
+// in a display control command, the on bit and the brightness
+static const uint8_t DISPLAY_ON_BIT_       = 0x08;
+static const uint8_t BRIGHTNESS_MASK_      = 0x07;
+
+// the bit count once a byte's all in, and during the ACK clock after it
+static const uint8_t BYTE_COMPLETE_        = 8;
+static const uint8_t ACK_CLOCK_            = 9;
+
+
+// Constructor; attaches the model to its pins
+//    uint8_t clock_pin - the Uno pin wired to the module's CLK
+//    uint8_t data_pin  - the Uno pin wired to the module's DIO
+Tm1637_Model::Tm1637_Model(uint8_t clock_pin, uint8_t data_pin)
+{
+  this->clock_pin_      = clock_pin;
+  this->data_pin_       = data_pin;
+  this->plugged_in_     = true;
+
+  this->in_transaction_          = false;
+  this->bit_count_               = 0;
+  this->shift_register_          = 0;
+  this->byte_count_              = 0;
+  this->transaction_start_nanos_ = 0;
+  this->command_                 = 0;
+  this->acking_                  = false;
+  this->fighting_                = false;
+  this->fight_since_nanos_       = 0;
+
+  // the chip's power-on state
+  this->auto_increment_ = true;
+  this->address_        = 0;
+  this->display_on_     = false;
+  this->brightness_     = 0;
+  for (uint8_t i = 0; i < RAM_SIZE_; i++) this->ram_[i] = 0;
+
+  this->reset_counts();
+
+  this->clock_level_         = Host_Hal::read_pin(clock_pin);
+  this->data_level_          = Host_Hal::read_pin(data_pin);
+  this->clock_changed_nanos_ = NEVER_;
+  this->data_changed_nanos_  = NEVER_;
+  Host_Hal::attach_device(this, clock_pin);
+  Host_Hal::attach_device(this, data_pin);
+}
+
+
+// plug the module in or pull it out; pulled out, it lets go of DIO and ignores everything
+void Tm1637_Model::set_plugged_in(bool plugged_in)
+{
+  this->plugged_in_     = plugged_in;
+  this->in_transaction_ = false;
+  this->bit_count_      = 0;
+  this->acking_         = false;
+
+  Host_Hal::notice_pin_changes();
+  this->check_for_fight();
+}
+
+
+// what's in the digit RAM (0 past the end)
+uint8_t Tm1637_Model::get_ram(uint8_t address)
+{
+  return (address < RAM_SIZE_) ? this->ram_[address] : 0;
+}
+
+bool Tm1637_Model::is_display_on()
+{
+  return this->display_on_;
+}
+
+uint8_t Tm1637_Model::get_brightness()
+{
+  return this->brightness_;
+}
+
+
+// whether we're partway through a transaction, and when that start was
+bool Tm1637_Model::is_in_transaction()
+{
+  return this->in_transaction_ && (this->bit_count_ > 0 || this->byte_count_ > 0);
+}
+
+uint64_t Tm1637_Model::get_transaction_start_nanos()
+{
+  return this->transaction_start_nanos_;
+}
+
+
+// the counts
+Tm1637_Model::counts Tm1637_Model::get_counts()
+{
+  return this->counts_;
+}
+
+void Tm1637_Model::reset_counts()
+{
+  this->counts_.bytes_received      = 0;
+  this->counts_.transactions        = 0;
+  this->counts_.empty_transactions  = 0;
+  this->counts_.data_writes         = 0;
+  this->counts_.bad_commands        = 0;
+  this->counts_.longest_fight_nanos = 0;
+  this->counts_.shortest_clock_nanos = NEVER_;
+  this->counts_.shortest_setup_nanos = NEVER_;
+}
+
+
+// the chip's side of the waveform; see the notes in the header
+void Tm1637_Model::on_pin_change(uint8_t pin, uint8_t level)
+{
+  this->check_timing(pin, level);
+  this->take_pin_change(pin, level);
+  this->check_for_fight();
+}
+
+
+// helper method; decodes one change on the wire
+void Tm1637_Model::take_pin_change(uint8_t pin, uint8_t level)
+{
+  if (pin == this->clock_pin_)
+  {
+    this->clock_level_ = level;
+    if (!this->plugged_in_ || !this->in_transaction_) return;
+
+    if (level == HIGH)
+    {
+      // a data bit, LSB first (a rising edge during a stop's set-up shifts one in too, which the stop then throws away)
+      if (this->bit_count_ < BYTE_COMPLETE_)
+      {
+        if (this->data_level_ == HIGH) this->shift_register_ |= (uint8_t)(1 << this->bit_count_);
+        this->bit_count_++;
+      }
+    }
+    else if (this->bit_count_ == BYTE_COMPLETE_)
+    {
+      // the eighth bit's falling edge: take the byte and ACK it, through the ninth clock
+      this->take_byte(this->shift_register_);
+      this->acking_    = true;
+      this->bit_count_ = ACK_CLOCK_;
+    }
+    else if (this->bit_count_ == ACK_CLOCK_)
+    {
+      // the ninth clock's falling edge: let go, and get ready for the next byte
+      this->acking_         = false;
+      this->bit_count_      = 0;
+      this->shift_register_ = 0;
+    }
+    return;
+  }
+
+  if (pin == this->data_pin_)
+  {
+    uint8_t previous = this->data_level_;
+    this->data_level_ = level;
+
+    // DIO only means start or stop while CLK's high, and never while it's us holding it down (or the box letting go
+    // of it to look for our ACK)
+    if (!this->plugged_in_ || this->clock_level_ != HIGH || this->bit_count_ == ACK_CLOCK_ || level == previous) return;
+
+    if (level == LOW)
+    {
+      this->in_transaction_          = true;
+      this->bit_count_               = 0;
+      this->shift_register_          = 0;
+      this->byte_count_              = 0;
+      this->transaction_start_nanos_ = Host_Hal::get_elapsed_nanos();
+    }
+    else if (this->in_transaction_)
+    {
+      if (this->byte_count_ > 0) this->counts_.transactions++;
+      else                       this->counts_.empty_transactions++;
+
+      this->in_transaction_ = false;
+      this->bit_count_      = 0;
+    }
+  }
+}
+
+
+// DIO goes low while we ACK; otherwise we leave everything alone
+int8_t Tm1637_Model::get_drive(uint8_t pin)
+{
+  if (pin == this->data_pin_ && this->plugged_in_ && this->acking_) return LOW;
+  return RELEASED_;
+}
+
+
+// helper method; a whole byte's come in. The first byte of a transaction is a command; digits follow an address
+// command, one per address
+void Tm1637_Model::take_byte(uint8_t value)
+{
+  this->counts_.bytes_received++;
+  this->byte_count_++;
+
+  if (this->byte_count_ == 1)
+  {
+    this->command_ = value & COMMAND_TYPE_MASK_;
+
+    if      (this->command_ == DATA_COMMAND_)    this->auto_increment_ = ((value & FIXED_ADDRESS_BIT_) == 0);
+    else if (this->command_ == ADDRESS_COMMAND_) this->address_        = value & ~COMMAND_TYPE_MASK_;
+    else if (this->command_ == DISPLAY_CONTROL_)
+    {
+      this->display_on_ = ((value & DISPLAY_ON_BIT_) != 0);
+      this->brightness_ = value & BRIGHTNESS_MASK_;
+    }
+    else this->counts_.bad_commands++;
+    return;
+  }
+
+  // anything after a data or control command is meaningless to the chip
+  if (this->command_ != ADDRESS_COMMAND_)
+  {
+    this->counts_.bad_commands++;
+    return;
+  }
+
+  if (this->address_ < RAM_SIZE_) this->ram_[this->address_] = value;
+  this->counts_.data_writes++;
+  if (this->auto_increment_) this->address_++;
+}
+
+
+// helper method; notes whether the box is driving DIO high against our ACK now, and for how long it did
+void Tm1637_Model::check_for_fight()
+{
+  bool fighting = this->acking_ && Host_Hal::is_output(this->data_pin_) && Host_Hal::get_output(this->data_pin_) == HIGH;
+
+  if (fighting && !this->fighting_)
+  {
+    this->fight_since_nanos_ = Host_Hal::get_elapsed_nanos();
+  }
+  else if (!fighting && this->fighting_)
+  {
+    uint64_t fight_nanos = Host_Hal::get_elapsed_nanos() - this->fight_since_nanos_;
+    if (fight_nanos > this->counts_.longest_fight_nanos) this->counts_.longest_fight_nanos = fight_nanos;
+  }
+
+  this->fighting_ = fighting;
+}
+
+
+// helper method; notes how long CLK and DIO stayed put before this change
+void Tm1637_Model::check_timing(uint8_t pin, uint8_t level)
+{
+  uint64_t now = Host_Hal::get_elapsed_nanos();
+
+  if (pin == this->clock_pin_)
+  {
+    if (this->plugged_in_ && this->clock_changed_nanos_ != NEVER_)
+    {
+      this->counts_.shortest_clock_nanos = std::min(this->counts_.shortest_clock_nanos, now - this->clock_changed_nanos_);
+    }
+
+    // DIO's read as CLK rises, so it has to have settled by then
+    if (this->plugged_in_ && level == HIGH && this->data_changed_nanos_ != NEVER_)
+    {
+      this->counts_.shortest_setup_nanos = std::min(this->counts_.shortest_setup_nanos, now - this->data_changed_nanos_);
+    }
+
+    this->clock_changed_nanos_ = now;
+  }
+  else if (pin == this->data_pin_)
+  {
+    this->data_changed_nanos_ = now;
+  }
+}
@@ -0,0 +1,147 @@
+//============================================================================//
+//  Name    : Tm1637_Model.h                                                  //
+//  Desc    : C++ Interface for a TM1637 display module on the simulated Uno, //
+//            decoding what the box clocks out to it, for the host/ build     //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Reads the waveform the way the chip does, not the way the     //
+//              box's code means it: a start is DIO falling while CLK's high, //
+//              a stop is DIO rising while CLK's high, a bit is DIO as CLK    //
+//              rises (LSB first), and after the eighth bit's falling edge    //
+//              the chip pulls DIO low to ACK until the ninth clock falls     //
+//            - So its counts are an independent check on the display's own  //
+//              bus_statistics: every byte and every start ... stop it really //
+//              got, and its six RAM digits say what's actually showing       //
+//            - A start and stop with no bytes between them is something the  //
+//              chip sees whenever the shared DIO moves while its own CLK is  //
+//              sitting high (another display's traffic, with this one idle   //
+//              after a stop); harmless, and not counted as a transaction     //
+//            - It also times how long the box ever drives DIO high while the //
+//              chip's pulling it low to ACK; two outputs shorted together,   //
+//              which on the box is a bit of current and a DIO level nobody   //
+//              can rely on                                                   //
+//            - And the shortest CLK high or low, and DIO set-up before a     //
+//              rising edge, it's been given; the real chip misreads anything //
+//              quicker than MIN_CLOCK_NANOS_ / MIN_SETUP_NANOS_              //
+//            - Unplug it to see what the box does when a display stops       //
+//              answering: it decodes nothing and never ACKs                  //
+//============================================================================//
+
+#ifndef TM1637_MODEL_H
+#define TM1637_MODEL_H
+
+// global includes
+#include <inttypes.h>
+#include <Arduino.h>
+
+// local includes
+#include "Host_Hal.h"
+
+// A class to stand in for one TM1637 display module on a CLK pin and a (possibly shared) DIO pin
+class Tm1637_Model : public Host_Device
+{
+  public:
+
+    // how many digit addresses the chip has (0xC0 - 0xC5)
+    static const uint8_t RAM_SIZE_ = 6;
+
+    // what the chip's counted since it was attached, or since the last reset_counts()
+    struct counts
+    {
+      unsigned long bytes_received;       // every byte it took in (and ACKed)
+      unsigned long transactions;         // every start ... stop with at least one byte in it
+      unsigned long empty_transactions;   // every start ... stop with none (see the notes up top)
+      unsigned long data_writes;          // digit bytes written to RAM
+      unsigned long bad_commands;         // first bytes that weren't a data, address or control command
+      uint64_t      longest_fight_nanos;  // the longest the box has driven DIO high while we were pulling it low
+      uint64_t      shortest_clock_nanos; // the shortest CLK has stayed high or low (NEVER_ if it hasn't moved)
+      uint64_t      shortest_setup_nanos; // the shortest DIO has been still before CLK rose (the same)
+    };
+
+    // shortest_clock_nanos and shortest_setup_nanos with nothing to go on
+    static const uint64_t NEVER_           = UINT64_MAX;
+
+    // what the real chip needs of them (its datasheet's clock pulse width and data set-up time)
+    static const uint64_t MIN_CLOCK_NANOS_ = 400;
+    static const uint64_t MIN_SETUP_NANOS_ = 100;
+
+    // Constructor; attaches the model to its pins
+    //    uint8_t clock_pin - the Uno pin wired to the module's CLK
+    //    uint8_t data_pin  - the Uno pin wired to the module's DIO
+    Tm1637_Model(uint8_t clock_pin, uint8_t data_pin);
+
+    // plug the module in or pull it out; pulled out, it lets go of DIO and ignores everything
+    void set_plugged_in(bool plugged_in);
+
+    // what's in the digit RAM, and how the display's set up
+    uint8_t get_ram(uint8_t address);
+    bool    is_display_on();
+    uint8_t get_brightness();
+
+    // whether we're partway through a transaction (clocked since a start, so not just a start heard with CLK
+    // sitting high), and when that start was
+    bool     is_in_transaction();
+    uint64_t get_transaction_start_nanos();
+
+    // the counts, and zeroing them
+    counts get_counts();
+    void   reset_counts();
+
+    // Host_Device
+    void   on_pin_change(uint8_t pin, uint8_t level) override;
+    int8_t get_drive(uint8_t pin) override;
+
+  private:
+
+    // helper method; decodes one change on the wire
+    void take_pin_change(uint8_t pin, uint8_t level);
+
+    // helper method; a whole byte's come in
+    void take_byte(uint8_t value);
+
+    // helper method; notes whether the box is driving DIO high against our ACK now, and for how long it did
+    void check_for_fight();
+
+    // helper method; notes how long CLK and DIO stayed put before this change
+    void check_timing(uint8_t pin, uint8_t level);
+
+    uint8_t clock_pin_;
+    uint8_t data_pin_;
+    bool    plugged_in_;
+
+    // the wire as of the last change
+    uint8_t clock_level_;
+    uint8_t data_level_;
+
+    // and when each last changed (NEVER_ until they do)
+    uint64_t clock_changed_nanos_;
+    uint64_t data_changed_nanos_;
+
+    // where we are in a transaction: inside one or not, the bits of the byte so far (8 is "all in", 9 is the ACK
+    // clock), the byte being shifted in, and how many bytes there've been; and when it started
+    bool     in_transaction_;
+    uint8_t  bit_count_;
+    uint8_t  shift_register_;
+    uint8_t  byte_count_;
+    uint64_t transaction_start_nanos_;
+
+    // the first byte of this transaction, its command type bits only
+    uint8_t command_;
+
+    // whether we're pulling DIO low to ACK, and if the box is driving it high anyway, since when
+    bool     acking_;
+    bool     fighting_;
+    uint64_t fight_since_nanos_;
+
+    // the chip itself: auto-increment or fixed addressing, where the next digit goes, the RAM and the display control
+    bool    auto_increment_;
+    uint8_t address_;
+    uint8_t ram_[RAM_SIZE_];
+    bool    display_on_;
+    uint8_t brightness_;
+
+    counts  counts_;
+};
+
+#endif
@@ -0,0 +1,117 @@
+//============================================================================//
+//  Name    : Trace_Replay.cpp                                                //
+//  Desc    : C++ Implementation for replaying recorded Line_Trace files      //
+//            through a Hit_Detector                                          //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//============================================================================//
+
+// interface include
+#include "Trace_Replay.h"
+
+// global includes
+#include <fcntl.h>
+#include <stdio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+
+// Constructor
+Trace_Replay::Trace_Replay()
+{
+  // no-op; map_file() does the real work
+}
+
+
+// Destructor; unmaps the file
+Trace_Replay::~Trace_Replay()
+{
+  if (this->bytes_ != NULL)
+  {
+    munmap((void*)this->bytes_, this->length_);
+  }
+}
+
+
+// map a trace file; returns false (after saying why on stderr) if it can't
+//    const char* path - the .fbt file
+bool Trace_Replay::map_file(const char* path)
+{
+  int         file = open(path, O_RDONLY);
+  struct stat file_status;
+  if (file < 0 || fstat(file, &file_status) != 0)
+  {
+    fprintf(stderr, "can't open %s\n", path);
+    if (file >= 0) close(file);
+    return false;
+  }
+  if (file_status.st_size == 0)
+  {
+    fprintf(stderr, "%s is empty\n", path);
+    close(file);
+    return false;
+  }
+
+  void* bytes = mmap(NULL, file_status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+  close(file);
+  if (bytes == MAP_FAILED)
+  {
+    fprintf(stderr, "can't map %s\n", path);
+    return false;
+  }
+
+  // it's read front to back, every time
+  madvise(bytes, file_status.st_size, MADV_SEQUENTIAL);
+
+  this->bytes_  = (const uint8_t*)bytes;
+  this->length_ = (unsigned long)file_status.st_size;
+  return true;
+}
+
+
+// replay the whole trace through a detection, from scratch; returns false if it isn't a trace
+//    Hit_Detector& detector     - the detection; reset first, timings left as they are
+//    after_sample               - called after every sample with its time, to look at the detection
+bool Trace_Replay::replay(Hit_Detector& detector, const std::function<void(unsigned long sample_time)>& after_sample) const
+{
+  Line_Trace         trace(this->bytes_, this->length_);
+  Line_Trace::record next_record;
+
+  if (!trace.begin_replay())
+  {
+    return false;
+  }
+
+  detector.reset();
+
+  unsigned long sample_time   = trace.get_start_micros();
+  unsigned long sample_period = trace.get_sample_period_micros();
+  uint8_t       lines         = 0;
+  uint8_t       mode          = Hit_Detector::SABER;
+
+  while (trace.read_record(next_record))
+  {
+    unsigned long next_change_time = (uint32_t)(sample_time + next_record.delta_micros);
+
+    // the live box keeps sampling while the lines hold still, and contacts qualify in between changes
+    while (sample_period != 0 && (uint32_t)(next_change_time - sample_time) > sample_period)
+    {
+      sample_time = (uint32_t)(sample_time + sample_period);
+      detector.set_mode(mode);
+      detector.process_line_sample(sample_time, lines);
+      after_sample(sample_time);
+    }
+
+    // now the change itself
+    sample_time = next_change_time;
+    lines       = next_record.lines;
+    mode        = next_record.mode;
+    detector.set_mode(mode);
+    detector.process_line_sample(sample_time, lines);
+    after_sample(sample_time);
+  }
+
+  return true;
+}
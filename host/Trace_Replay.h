@@ -0,0 +1,59 @@
+//============================================================================//
+//  Name    : Trace_Replay.h                                                  //
+//  Desc    : C++ Interface for replaying recorded Line_Trace files through a //
+//            Hit_Detector, for the host/ build                               //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - A file is mmap()ed once and read in place, as often and from  //
+//              as many threads as like; each replay reads it through a       //
+//              Line_Trace of its own                                         //
+//            - Samples are replayed the way the box took them: the held      //
+//              state again every sample period between changes (contacts     //
+//              qualify in between), then the change itself                   //
+//============================================================================//
+
+#ifndef TRACE_REPLAY_H
+#define TRACE_REPLAY_H
+
+// global includes
+#include <inttypes.h>
+#include <functional>
+#include <Arduino.h>
+
+// local includes
+#include "Hit_Detector.h"
+#include "Line_Trace.h"
+
+// A class to map a recorded trace file and replay it through hit detection
+class Trace_Replay
+{
+  public:
+
+    // Constructor
+    Trace_Replay();
+
+    // Destructor; unmaps the file
+    ~Trace_Replay();
+
+    // map a trace file; returns false (after saying why on stderr) if it can't
+    //    const char* path - the .fbt file
+    bool map_file(const char* path);
+
+    // replay the whole trace through a detection, from scratch; returns false if it isn't a trace
+    //    Hit_Detector& detector     - the detection; reset first, timings left as they are
+    //    after_sample               - called after every sample with its time, to look at the detection
+    bool replay(Hit_Detector& detector, const std::function<void(unsigned long sample_time)>& after_sample) const;
+
+  private:
+
+    // the mapped file
+    const uint8_t* bytes_  = NULL;
+    unsigned long  length_ = 0;
+
+    // no copies; there's one mapping
+    Trace_Replay(const Trace_Replay&);
+    Trace_Replay& operator=(const Trace_Replay&);
+};
+
+#endif
@@ -0,0 +1,70 @@
+//============================================================================//
+//  Name    : Weapon_Circuit.cpp                                              //
+//  Desc    : C++ Implementation for the fencers' weapons and lames, as the   //
+//            box's weapon line pins see them                                 //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//============================================================================//
+
+// interface include
+#include "Weapon_Circuit.h"
+
+// join (or part) a power pin and a line pin, now
+//    uint8_t power_pin - the pin powering a weapon
+//    uint8_t line_pin  - the line pin it reaches
+//    bool    joined    - whether they touch
+void Weapon_Circuit::set_contact(uint8_t power_pin, uint8_t line_pin, bool joined)
+{
+  for (size_t i = 0; i < this->contacts_.size(); i++)
+  {
+    if (this->contacts_[i].power_pin == power_pin && this->contacts_[i].line_pin == line_pin)
+    {
+      this->contacts_[i].joined = joined;
+      Host_Hal::notice_pin_changes();
+      return;
+    }
+  }
+
+  // first time for this pair; we need to hear about the power pin, and have a say in the line pin
+  contact pair = { power_pin, line_pin, joined };
+  this->contacts_.push_back(pair);
+  Host_Hal::attach_device(this, power_pin);
+  Host_Hal::attach_device(this, line_pin);
+}
+
+
+// as above, for a while, starting at a given time
+//    uint64_t      elapsed_micros  - when it starts, since Host_Hal::reset()
+//    unsigned long duration_micros - how long it lasts
+void Weapon_Circuit::schedule_contact(uint8_t power_pin, uint8_t line_pin, uint64_t elapsed_micros, unsigned long duration_micros)
+{
+  Host_Hal::schedule_call(elapsed_micros,                   [=]() { this->set_contact(power_pin, line_pin, true);  });
+  Host_Hal::schedule_call(elapsed_micros + duration_micros, [=]() { this->set_contact(power_pin, line_pin, false); });
+}
+
+
+// a power pin changed; the line pins it reaches follow on their own (Host_Hal asks get_drive() again)
+void Weapon_Circuit::on_pin_change(uint8_t pin, uint8_t level)
+{
+  (void)pin;
+  (void)level;
+}
+
+
+// a line pin reads whatever the power pin touching it puts out (and if several do, any of them being high will do)
+int8_t Weapon_Circuit::get_drive(uint8_t pin)
+{
+  int8_t drive = RELEASED_;
+
+  for (size_t i = 0; i < this->contacts_.size(); i++)
+  {
+    const contact& pair = this->contacts_[i];
+    if (!pair.joined || pair.line_pin != pin) continue;
+
+    if (Host_Hal::read_pin(pair.power_pin) == HIGH) return HIGH;
+    drive = LOW;
+  }
+
+  return drive;
+}
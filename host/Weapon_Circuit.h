@@ -0,0 +1,62 @@
+//============================================================================//
+//  Name    : Weapon_Circuit.h                                                //
+//  Desc    : C++ Interface for the fencers' weapons and lames, as the box's  //
+//            weapon line pins see them, for the host/ build                  //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - A contact joins one of the box's weapon power pins to one of  //
+//              its line pins, so the line reads whatever the power pin's     //
+//              putting out; which is why a touch only shows up in the phase  //
+//              of the loop that powers the right weapon, as on the strip     //
+//            - In saber, a left touch is the left power pin to the right     //
+//              lame pin; foil and epee need the weapon line too (see         //
+//              Hit_Detector's is_reading_*() for what each mode looks for)   //
+//            - Contacts can be made and broken now, or at a scheduled time   //
+//============================================================================//
+
+#ifndef WEAPON_CIRCUIT_H
+#define WEAPON_CIRCUIT_H
+
+// global includes
+#include <inttypes.h>
+#include <vector>
+#include <Arduino.h>
+
+// local includes
+#include "Host_Hal.h"
+
+// A class to join the box's weapon power pins to its line pins, as blades and lames do
+class Weapon_Circuit : public Host_Device
+{
+  public:
+
+    // join (or part) a power pin and a line pin, now
+    //    uint8_t power_pin - the pin powering a weapon
+    //    uint8_t line_pin  - the line pin it reaches
+    //    bool    joined    - whether they touch
+    void set_contact(uint8_t power_pin, uint8_t line_pin, bool joined);
+
+    // as above, for a while, starting at a given time
+    //    uint64_t      elapsed_micros  - when it starts, since Host_Hal::reset()
+    //    unsigned long duration_micros - how long it lasts
+    void schedule_contact(uint8_t power_pin, uint8_t line_pin, uint64_t elapsed_micros, unsigned long duration_micros);
+
+    // Host_Device
+    void   on_pin_change(uint8_t pin, uint8_t level) override;
+    int8_t get_drive(uint8_t pin) override;
+
+  private:
+
+    // one pair of pins that can touch
+    struct contact
+    {
+      uint8_t power_pin;
+      uint8_t line_pin;
+      bool    joined;
+    };
+
+    std::vector<contact> contacts_;
+};
+
+#endif
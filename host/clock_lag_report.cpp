@@ -0,0 +1,103 @@
+//============================================================================//
+//  Name    : clock_lag_report.cpp                                            //
+//  Desc    : How far after the true tenth / second the clock's digits show   //
+//            up, with and without them being sent early, from the sketch     //
+//            running on the simulated Uno                                    //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - The whole box runs, TM1637 models on all three displays, so   //
+//              the clock's changes queue behind everything else on the bus   //
+//              the way they would on the box                                 //
+//            - The same countdown (the last seconds of a bout, tenths and    //
+//              all) runs twice: sent on time, then sent early. The lead is   //
+//              learned either way, so the second run starts with it warm     //
+//            - Prints Fencing_Clock's own lag figures for each, as the box   //
+//              does under DEBUG 2, and exits non-zero unless sending early   //
+//              brings the mean lag down; ctest runs it as a check            //
+//            - Only the I/O costs time here (see Host_Hal), so the loop is   //
+//              quicker than the box's; the lag's shape, not its exact size   //
+//            - clock_lag_report [seconds per run]                            //
+//============================================================================//
+
+// global includes
+#include <stdio.h>
+#include <stdlib.h>
+
+// the box
+#include "Host_Sketch.h"
+
+// local includes
+#include "Tm1637_Model.h"
+
+// how long each run counts down for unless told otherwise; from 15s, a few seconds' changes, then tenths
+static const unsigned long DEFAULT_RUN_SECONDS_ = 15;
+
+// how long the box gets to come up before the first run (well past the startup animation)
+static const uint64_t      STARTUP_MICROS_      = 3000000;
+
+// and between runs, for the last change to land
+static const uint64_t      SETTLE_MICROS_       = 500000;
+
+
+// counts the clock down for a while and prints how far off its changes landed; returns the mean lag
+//    bool          lead_enabled - whether the clock sends its changes early
+//    unsigned long run_seconds  - how long to count down for
+//    uint64_t&     now          - the simulated time since reset; moved on past the run
+long run_countdown(bool lead_enabled, unsigned long run_seconds, uint64_t& now)
+{
+  clock_->set_display_lead_enabled(lead_enabled);
+  clock_->set_time(run_seconds * 1000000UL);
+  clock_->reset_display_lag_statistics();
+  clock_->start();
+
+  run_sketch_until(now += (uint64_t)run_seconds * 1000000);
+
+  clock_->stop();
+  Fencing_Clock::display_lag_statistics stats = clock_->get_display_lag_statistics();
+  long mean_lag_micros = (stats.samples == 0) ? 0 : stats.total_lag_micros / (long)stats.samples;
+
+  printf("clock lag (%-12s)  changes: %4lu  mean: %6ldus  earliest: %6ldus  latest: %6ldus  jitter: %6ldus  lead: %6luus\n",
+         lead_enabled ? "sent early" : "sent on time", stats.samples, mean_lag_micros, stats.earliest_lag_micros,
+         stats.latest_lag_micros, stats.latest_lag_micros - stats.earliest_lag_micros, stats.lead_micros);
+
+  run_sketch_until(now += SETTLE_MICROS_);
+
+  return mean_lag_micros;
+}
+
+
+int main(int argc, char** argv)
+{
+  unsigned long run_seconds = (argc > 1) ? strtoul(argv[1], NULL, 10) : DEFAULT_RUN_SECONDS_;
+  if (run_seconds == 0)
+  {
+    fprintf(stderr, "usage: %s [seconds per run]\n", argv[0]);
+    return 2;
+  }
+
+  Host_Hal::reset();
+
+  // the modules' pull-up holds the shared data line high whenever nobody's pulling it down
+  Host_Hal::set_input(TIME_DISPLAY_DATA_PIN_, HIGH);
+
+  Tm1637_Model left_chip (LEFT_FENCER_SCORE_DISPLAY_CLK_PIN_,  LEFT_FENCER_SCORE_DISPLAY_DATA_PIN_);
+  Tm1637_Model right_chip(RIGHT_FENCER_SCORE_DISPLAY_CLK_PIN_, RIGHT_FENCER_SCORE_DISPLAY_DATA_PIN_);
+  Tm1637_Model time_chip (TIME_DISPLAY_CLK_PIN_,               TIME_DISPLAY_DATA_PIN_);
+
+  setup();
+
+  uint64_t now = STARTUP_MICROS_;
+  run_sketch_until(now);
+
+  long on_time_lag = run_countdown(false, run_seconds, now);
+  long early_lag   = run_countdown(true,  run_seconds, now);
+
+  if (!(early_lag < on_time_lag))
+  {
+    printf("sending early didn't bring the mean lag down\n");
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,148 @@
+//============================================================================//
+//  Name    : component_benchmarks.cpp                                        //
+//  Desc    : Per-call cost of the main loop's heavy hitters, on the host     //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - The same calls run_component_benchmarks() times on the box    //
+//              (DEBUG 4), each timed two ways: the simulated Uno time it     //
+//              spends on pins and registers (Host_Hal's access costs), and   //
+//              the host time it takes to run here                            //
+//            - The first is a floor for the box, not a prediction: it has    //
+//              none of the arithmetic in it, and DEBUG 4's cycle counts are  //
+//              the real thing. The second is for spotting algorithmic        //
+//              changes quickly, not for absolute numbers; for anything       //
+//              touching pins, it's mostly the simulator's own time           //
+//            - component_benchmarks [iterations]                             //
+//============================================================================//
+
+// global includes
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+
+// the box
+#include "Host_Sketch.h"
+
+// calls timed per component unless told otherwise
+static const unsigned long DEFAULT_ITERATIONS_ = 10000;
+
+// roughly how far apart the main loop calls the ticks
+static const unsigned long LOOP_PASS_MICROS_   = 250;
+
+
+//=========================================================================================
+// run_benchmark - calls one component the given number of times and prints how long each
+//                 call took, in simulated Uno I/O time and in host time
+//    parameter:  label      - what to call it in the printout
+//    parameter:  iterations - how many calls
+//    parameter:  prepare    - gets call number i ready, untimed (e.g. lets time pass)
+//    parameter:  call       - makes call number i
+//    output:   none
+//=========================================================================================
+template <class Prepare, class Call>
+void run_benchmark(const char* label, unsigned long iterations, Prepare prepare, Call call)
+{
+  Timing_Statistics simulated;
+  Timing_Statistics host;
+
+  for (unsigned long i = 0; i < iterations; i++)
+  {
+    prepare(i);
+
+    uint64_t                              simulated_start = Host_Hal::get_elapsed_nanos();
+    std::chrono::steady_clock::time_point host_start      = std::chrono::steady_clock::now();
+
+    call(i);
+
+    std::chrono::steady_clock::time_point host_end = std::chrono::steady_clock::now();
+    simulated.add_sample((unsigned long)(Host_Hal::get_elapsed_nanos() - simulated_start));
+    host     .add_sample((unsigned long)std::chrono::duration_cast<std::chrono::nanoseconds>(host_end - host_start).count());
+  }
+
+  Serial.println(label);
+  simulated.print("    Uno I/O", "ns");
+  host     .print("    host   ", "ns");
+}
+
+// as above, with nothing to get ready
+template <class Call>
+void run_benchmark(const char* label, unsigned long iterations, Call call)
+{
+  run_benchmark(label, iterations, [](unsigned long) {}, call);
+}
+
+
+int main(int argc, char** argv)
+{
+  unsigned long iterations = (argc > 1) ? strtoul(argv[1], NULL, 10) : DEFAULT_ITERATIONS_;
+
+  Host_Hal::reset();
+  Host_Hal::set_serial_echo(true);
+
+  // the modules' pull-up holds the shared data line high whenever nobody's pulling it down; nothing ACKs, so the
+  // displays back off now and again, as they would with nothing plugged in
+  Host_Hal::set_input(TIME_DISPLAY_DATA_PIN_, HIGH);
+
+  setup();
+
+  Serial.print("Benchmarking, ");
+  Serial.print(iterations);
+  Serial.println(" calls each, per call:");
+
+  // one digits transaction (an address and four digits), by way of digitalWrite() and then with the pins fixed at
+  // compile time
+  Seven_Segment_Transfer::transaction                                digits = { {0xC0, 0x00, 0x00, 0x00, 0x00}, 5, 0, true };
+  Seven_Segment_Transfer                                             runtime_transfer(TIME_DISPLAY_CLK_PIN_, TIME_DISPLAY_DATA_PIN_);
+  Fixed_Pin_Transfer<TIME_DISPLAY_CLK_PIN_, TIME_DISPLAY_DATA_PIN_>  fixed_transfer;
+
+  run_benchmark("  Seven_Segment_Transfer, a whole digits transaction", iterations, [&](unsigned long) {
+    runtime_transfer.begin(digits);
+    runtime_transfer.step(255);
+  });
+
+  run_benchmark("  Fixed_Pin_Transfer, a whole digits transaction", iterations, [&](unsigned long) {
+    fixed_transfer.begin(digits);
+    fixed_transfer.step(255);
+  });
+
+  clock_->clock_->refresh();
+
+  // Seven_Segment_Display::tick (and the bus it sends on), with a fresh four-digit message every so often
+  run_benchmark("  Seven_Segment_Display::tick + bus", iterations, [&](unsigned long i) {
+    if (i % 40 == 0) clock_->clock_->set_display_contents((i / 40) % 2 == 0 ? "1234" : "5678");
+
+    unsigned long now = Host_Hal::get_micros();
+    clock_->clock_->tick(now);
+    display_bus_->tick(now);
+  });
+
+  // Fencing_Clock::tick, with the clock running so the tenths actually roll over (a loop pass apart)
+  clock_->start();
+  run_benchmark("  Fencing_Clock::tick + bus", iterations, [&](unsigned long) { Host_Hal::advance_micros(LOOP_PASS_MICROS_); }, [&](unsigned long) {
+    unsigned long now = Host_Hal::get_micros();
+    clock_->tick(now);
+    display_bus_->tick(now);
+  });
+
+  // Fencing_Point_Displays::set_scores, a new score every call
+  run_benchmark("  Fencing_Point_Displays::set_scores", iterations, [&](unsigned long i) {
+    scoreboard_->set_scores(i % 100, (i + 1) % 100);
+  });
+
+  // the hit detection, one phase per call, with both fencers in contact so the timing checks all run
+  run_benchmark("  Hit_Detector, one phase", iterations, [&](unsigned long i) {
+    unsigned long now = Host_Hal::get_micros();
+    if (i % 2 == 0) hit_detector_->process_left_phase (now, true, true, true);
+    else            hit_detector_->process_right_phase(now, true, true, true);
+  });
+
+  // a ring light change, on and off again, and the show() that sends it
+  run_benchmark("  Fencing_Light_Displays, a change and its commit", iterations, [&](unsigned long i) {
+    if (i % 2 == 0) lights_->display_left_on_target();
+    else            lights_->reset_lights();
+    lights_->commit();
+  });
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+//============================================================================//
+//  Name    : latency_report.cpp                                              //
+//  Desc    : Hit-to-light stage latencies, from the sketch running on the    //
+//            simulated Uno with Latency_Probe switched on (DEBUG 3)          //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Saber touches, left and right in turn, each starting at a     //
+//              different point in the loop pass so the report covers the     //
+//              whole spread rather than one lucky phase                      //
+//            - Each stage is timed twice: by the probe itself (its report,   //
+//              as the box would print it after the last touch), and from     //
+//              the outside, by when the simulated pins, show()s and tone()s  //
+//              actually happened relative to the blade landing. The two      //
+//              should agree; if they don't, the probe's marks are in the     //
+//              wrong places                                                  //
+//            - Only the I/O costs time here (see Host_Hal), so these are the //
+//              pipeline's shape and a floor, not the box's exact numbers;    //
+//              the probe pin on a scope is still the real thing              //
+//            - Exits non-zero if any touch didn't light up the right ring    //
+//              and sound the buzzer on time, so ctest can run it as a check  //
+//            - latency_report [touches]                                      //
+//============================================================================//
+
+// global includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+
+// the box
+#include "Host_Sketch.h"
+
+// local includes
+#include "Weapon_Circuit.h"
+
+// touches unless told otherwise
+static const unsigned long DEFAULT_TOUCHES_       = 20;
+
+// when the first touch lands (well past the startup animation), how far apart they are (time for the lockout, the
+// lights and a bit), how long each blade stays down, and how much each one's start moves along the loop pass
+static const uint64_t      FIRST_TOUCH_MICROS_    = 5000000;
+static const uint64_t      TOUCH_SPACING_MICROS_  = 4000000;
+static const unsigned long TOUCH_DURATION_MICROS_ = 2000;
+static const uint64_t      TOUCH_PHASE_STEP_      = 137;
+static const uint64_t      TOUCH_PHASE_RANGE_     = 1000;
+
+// the slack allowed past each deadline: about a loop pass
+static const uint64_t      DEADLINE_SLACK_MICROS_ = 2000;
+
+
+// the first pin change on a pin at or after the given time (nanos since reset), or NULL
+const Host_Hal::pin_event* first_pin_event_after(uint8_t pin, uint64_t after_nanos)
+{
+  const std::vector<Host_Hal::pin_event>& events = Host_Hal::get_pin_events();
+  for (size_t i = 0; i < events.size(); i++)
+  {
+    if (events[i].pin == pin && events[i].nanos >= after_nanos) return &events[i];
+  }
+  return NULL;
+}
+
+// the first show() on a pin at or after the given time with any color in it, or NULL
+const Host_Hal::show_event* first_lit_show_after(uint8_t pin, uint64_t after_nanos)
+{
+  const std::vector<Host_Hal::show_event>& shows = Host_Hal::get_show_events();
+  for (size_t i = 0; i < shows.size(); i++)
+  {
+    if (shows[i].pin != pin || shows[i].nanos < after_nanos) continue;
+    for (size_t b = 0; b < shows[i].bytes.size(); b++)
+    {
+      if (shows[i].bytes[b] != 0) return &shows[i];
+    }
+  }
+  return NULL;
+}
+
+// the first tone() (not noTone()) on a pin at or after the given time, or NULL
+const Host_Hal::tone_event* first_tone_after(uint8_t pin, uint64_t after_nanos)
+{
+  const std::vector<Host_Hal::tone_event>& tones = Host_Hal::get_tone_events();
+  for (size_t i = 0; i < tones.size(); i++)
+  {
+    if (tones[i].pin == pin && tones[i].frequency != 0 && tones[i].nanos >= after_nanos) return &tones[i];
+  }
+  return NULL;
+}
+
+
+int main(int argc, char** argv)
+{
+  unsigned long touches = (argc > 1) ? strtoul(argv[1], NULL, 10) : DEFAULT_TOUCHES_;
+
+  Host_Hal::reset();
+  Host_Hal::set_recording(true, 1UL << LATENCY_PROBE_PIN_);
+  Weapon_Circuit circuit;
+
+  setup();
+
+  // the touches: left blade on the right lame, then right blade on the left lame, and so on
+  for (unsigned long i = 0; i < touches; i++)
+  {
+    uint64_t start = FIRST_TOUCH_MICROS_ + i * TOUCH_SPACING_MICROS_ + (i * TOUCH_PHASE_STEP_) % TOUCH_PHASE_RANGE_;
+    if (i % 2 == 0) circuit.schedule_contact(LEFT_FENCER_B_WEAPON_LINE_POWER_PIN_,  RIGHT_FENCER_A_LAME_LINE_PIN_, start, TOUCH_DURATION_MICROS_);
+    else            circuit.schedule_contact(RIGHT_FENCER_B_WEAPON_LINE_POWER_PIN_, LEFT_FENCER_A_LAME_LINE_PIN_,  start, TOUCH_DURATION_MICROS_);
+  }
+
+  run_sketch_until(FIRST_TOUCH_MICROS_ + touches * TOUCH_SPACING_MICROS_);
+
+  // the probe's own report, as printed after the last touch
+  std::string output = Host_Hal::take_serial_output();
+  size_t      report = output.rfind("Latency from contact start");
+  printf("The probe's report, after %lu touches:\n%s\n", touches, (report == std::string::npos) ? "(none)\r\n" : output.substr(report).c_str());
+
+  // and the same again, from the outside
+  Timing_Statistics line_edge, show_begin, show_end, buzzer_start;
+  unsigned long     missed = 0;
+
+  for (unsigned long i = 0; i < touches; i++)
+  {
+    uint64_t start = FIRST_TOUCH_MICROS_ + i * TOUCH_SPACING_MICROS_ + (i * TOUCH_PHASE_STEP_) % TOUCH_PHASE_RANGE_;
+    uint8_t  ring  = (i % 2 == 0) ? LEFT_FENCER_RING_LIGHT_CONTROL_PIN_ : RIGHT_FENCER_RING_LIGHT_CONTROL_PIN_;
+
+    const Host_Hal::pin_event*  edge = first_pin_event_after(LATENCY_PROBE_PIN_, start * 1000);
+    const Host_Hal::show_event* lit  = first_lit_show_after(ring, start * 1000);
+    const Host_Hal::tone_event* buzz = first_tone_after(BUZZER_CONTROL_PIN_, start * 1000);
+
+    // the lights are due once the contact's long enough, and the buzzer once the lockout's up
+    bool lit_on_time  = (lit  != NULL) && lit ->nanos / 1000 <  start + Hit_Detector::SABER_CONTACT_MICROS_ + DEADLINE_SLACK_MICROS_;
+    bool buzz_on_time = (buzz != NULL) && buzz->nanos / 1000 >= start + Hit_Detector::SABER_LOCKOUT_MICROS_
+                                       && buzz->nanos / 1000 <  start + Hit_Detector::SABER_LOCKOUT_MICROS_ + DEADLINE_SLACK_MICROS_;
+    if (edge == NULL || !lit_on_time || !buzz_on_time)
+    {
+      printf("touch %lu at %llu us: %s%s%s\n", i, (unsigned long long)start, (edge == NULL) ? "no probe edge; " : "",
+             lit_on_time ? "" : "ring late or dark; ", buzz_on_time ? "" : "buzzer early, late or silent");
+      missed++;
+      continue;
+    }
+
+    // a show()'s bytes go out with interrupts off, a pixel's worth of time each
+    uint64_t show_nanos = (uint64_t)(lit->bytes.size() / 3) * Host_Hal::get_costs().pixel_show_nanos;
+
+    line_edge   .add_sample((unsigned long)(edge->nanos / 1000 - start));
+    show_begin  .add_sample((unsigned long)(lit ->nanos / 1000 - start));
+    show_end    .add_sample((unsigned long)((lit->nanos + show_nanos) / 1000 - start));
+    buzzer_start.add_sample((unsigned long)(buzz->nanos / 1000 - start));
+  }
+
+  Host_Hal::set_serial_echo(true);
+  Serial.println("Latency from the blade landing, as the simulated pins saw it:");
+  line_edge   .print("  line edge    ");
+  show_begin  .print("  show() begin ");
+  show_end    .print("  show() end   ");
+  buzzer_start.print("  buzzer start ");
+
+  if (missed != 0) printf("%lu of %lu touches missed a deadline\n", missed, touches);
+  return (missed == 0) ? 0 : 1;
+}
@@ -0,0 +1,123 @@
+//============================================================================//
+//  Name    : record_trace.cpp                                                //
+//  Desc    : Records a Line_Trace of a scripted bout, from the sketch        //
+//            running on the simulated Uno at DEBUG 5, to a file              //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - The bout goes through all three weapons (the mode button,    //
+//              between them): saber touches left, right and both; foil on   //
+//              and off target, and one too short to count; epee left,       //
+//              right and a double inside the lockout                        //
+//            - What lands in the file is exactly what the box sends over     //
+//              Serial at DEBUG 5, from the trace's header on, so it's what   //
+//              a trace captured off a real box looks like                    //
+//            - host/traces/bout.fbt came from this; if the script changes,  //
+//              re-record it and regenerate its .golden with replay_traces    //
+//            - record_trace <trace.fbt>                                      //
+//============================================================================//
+
+// global includes
+#include <stdio.h>
+
+// the box
+#include "Host_Sketch.h"
+
+// local includes
+#include "Weapon_Circuit.h"
+
+// how long a mode button press lasts
+static const unsigned long PRESS_MICROS_       = 200000;
+
+// how long each kind of blade contact lasts: a saber or epee touch, a foil touch, and a foil touch that's too short
+static const unsigned long TOUCH_MICROS_       = 3000;
+static const unsigned long FOIL_TOUCH_MICROS_  = 20000;
+static const unsigned long FOIL_SHORT_MICROS_  = 5000;
+
+// when it's all over
+static const uint64_t      END_MICROS_         = 40000000;
+
+
+// a blade landing: the weapon line (foil and epee) and / or the opponent's lame, joined to the fencer's power pin
+//    Weapon_Circuit& circuit         - the weapons
+//    uint8_t         power_pin       - the fencer's weapon power pin
+//    uint8_t         first_line_pin  - a line pin it reaches
+//    uint8_t         second_line_pin - another, or 0 for none
+//    uint64_t        elapsed_micros  - when, since Host_Hal::reset()
+//    unsigned long   duration_micros - for how long
+void schedule_touch(Weapon_Circuit& circuit, uint8_t power_pin, uint8_t first_line_pin, uint8_t second_line_pin,
+                    uint64_t elapsed_micros, unsigned long duration_micros)
+{
+  circuit.schedule_contact(power_pin, first_line_pin, elapsed_micros, duration_micros);
+  if (second_line_pin != 0) circuit.schedule_contact(power_pin, second_line_pin, elapsed_micros, duration_micros);
+}
+
+
+int main(int argc, char** argv)
+{
+  if (argc != 2)
+  {
+    fprintf(stderr, "usage: %s <trace.fbt>\n", argv[0]);
+    return 2;
+  }
+
+  Host_Hal::reset();
+
+  // the displays' shared data line has a pull-up, and the mode button one of its own
+  Host_Hal::set_input(TIME_DISPLAY_DATA_PIN_,  HIGH);
+  Host_Hal::set_input(MODE_SWITCH_BUTTON_PIN_, HIGH);
+
+  Weapon_Circuit circuit;
+
+  const uint8_t left_power   = LEFT_FENCER_B_WEAPON_LINE_POWER_PIN_;
+  const uint8_t right_power  = RIGHT_FENCER_B_WEAPON_LINE_POWER_PIN_;
+  const uint8_t left_weapon  = LEFT_FENCER_B_WEAPON_LINE_PIN_;
+  const uint8_t right_weapon = RIGHT_FENCER_B_WEAPON_LINE_PIN_;
+  const uint8_t left_lame    = LEFT_FENCER_A_LAME_LINE_PIN_;
+  const uint8_t right_lame   = RIGHT_FENCER_A_LAME_LINE_PIN_;
+
+  // saber: blade on lame
+  schedule_touch(circuit, left_power,  right_lame, 0, 3000000, TOUCH_MICROS_);
+  schedule_touch(circuit, right_power, left_lame,  0, 7000000, TOUCH_MICROS_);
+  schedule_touch(circuit, left_power,  right_lame, 0, 11000000, TOUCH_MICROS_);
+  schedule_touch(circuit, right_power, left_lame,  0, 11000080, TOUCH_MICROS_);
+
+  // foil: the tip's pressed (weapon line) and either on the lame or not; and one press too short to count
+  Host_Hal::schedule_input(MODE_SWITCH_BUTTON_PIN_, LOW,  15000000);
+  Host_Hal::schedule_input(MODE_SWITCH_BUTTON_PIN_, HIGH, 15000000 + PRESS_MICROS_);
+  schedule_touch(circuit, left_power,  left_weapon,  right_lame, 17000000, FOIL_TOUCH_MICROS_);
+  schedule_touch(circuit, right_power, right_weapon, 0,          21000000, FOIL_TOUCH_MICROS_);
+  schedule_touch(circuit, left_power,  left_weapon,  right_lame, 25000000, FOIL_SHORT_MICROS_);
+
+  // epee: the tip's pressed, anywhere
+  Host_Hal::schedule_input(MODE_SWITCH_BUTTON_PIN_, LOW,  27000000);
+  Host_Hal::schedule_input(MODE_SWITCH_BUTTON_PIN_, HIGH, 27000000 + PRESS_MICROS_);
+  schedule_touch(circuit, left_power,  left_weapon,  left_lame,  29000000, TOUCH_MICROS_);
+  schedule_touch(circuit, right_power, right_weapon, right_lame, 33000000, TOUCH_MICROS_);
+  schedule_touch(circuit, left_power,  left_weapon,  left_lame,  37000000, TOUCH_MICROS_);
+  schedule_touch(circuit, right_power, right_weapon, right_lame, 37010000, TOUCH_MICROS_);
+
+  setup();
+  run_sketch_until(END_MICROS_);
+
+  // everything before the header is the box starting up (there's nothing, at DEBUG 5, but don't count on it)
+  std::string            output = Host_Hal::take_serial_output();
+  std::string::size_type start  = output.find("FBT1");
+  if (start == std::string::npos)
+  {
+    fprintf(stderr, "no trace header in the box's Serial output\n");
+    return 1;
+  }
+
+  FILE* file = fopen(argv[1], "wb");
+  if (file == NULL)
+  {
+    fprintf(stderr, "can't open %s\n", argv[1]);
+    return 1;
+  }
+  fwrite(output.data() + start, 1, output.size() - start, file);
+  fclose(file);
+
+  printf("%zu bytes of trace to %s\n", output.size() - start, argv[1]);
+  return 0;
+}
@@ -0,0 +1,126 @@
+//============================================================================//
+//  Name    : replay_traces.cpp                                               //
+//  Desc    : Replays recorded Line_Traces (DEBUG 5) through Hit_Detector on  //
+//            the host, printing every change in the hit / lockout decision   //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - The trace file is mmap()ed and read in place (see            //
+//              Trace_Replay); a whole day's fencing is a few hundred KB      //
+//            - One line per change in the decision:                          //
+//                <micros> left:<on|off|-> right:<on|off|-> lockout:<1|0>     //
+//              which is easy to diff against a known-good run                //
+//            - Given a golden file as well, prints nothing but the first     //
+//              line that differs, and exits 1 if any does; ctest runs the    //
+//              traces in host/traces this way, so a change to the detection  //
+//              that changes a decision on a real bout doesn't go unnoticed   //
+//            - replay_traces <trace.fbt> [<expected.golden>]                 //
+//============================================================================//
+
+// global includes
+#include <stdio.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <Arduino.h>
+
+// local includes
+#include "Hit_Detector.h"
+#include "Trace_Replay.h"
+
+
+// one line of output for the decision as it stands
+//    Hit_Detector& detector    - the detection
+//    unsigned long sample_time - when it was reached
+std::string describe_decision(Hit_Detector& detector, unsigned long sample_time)
+{
+  char line[80];
+  snprintf(line, sizeof(line), "%lu left:%s right:%s lockout:%s", sample_time,
+           detector.is_left_hit_on_target()  ? "on" : (detector.is_left_hit_off_target()  ? "off" : "-"),
+           detector.is_right_hit_on_target() ? "on" : (detector.is_right_hit_off_target() ? "off" : "-"),
+           detector.is_locked_out() ? "1" : "0");
+  return line;
+}
+
+
+// compares the output with a golden file, printing the first line that differs; returns true if none does
+//    const std::string& output      - what the replay printed
+//    const char*        golden_path - what it should have
+bool matches_golden(const std::string& output, const char* golden_path)
+{
+  std::ifstream golden_file(golden_path);
+  if (!golden_file)
+  {
+    fprintf(stderr, "can't open %s\n", golden_path);
+    return false;
+  }
+
+  std::istringstream actual(output);
+  std::string        expected_line;
+  std::string        actual_line;
+  unsigned long      line_number = 0;
+
+  while (true)
+  {
+    bool have_expected = (bool)std::getline(golden_file, expected_line);
+    bool have_actual   = (bool)std::getline(actual,      actual_line);
+    line_number++;
+
+    if (!have_expected && !have_actual)
+    {
+      return true;
+    }
+    if (!have_expected || !have_actual || expected_line != actual_line)
+    {
+      printf("%s:%lu differs\n", golden_path, line_number);
+      printf("  expected: %s\n", have_expected ? expected_line.c_str() : "(end of file)");
+      printf("  replayed: %s\n", have_actual   ? actual_line.c_str()   : "(end of output)");
+      return false;
+    }
+  }
+}
+
+
+int main(int argc, char** argv)
+{
+  if (argc != 2 && argc != 3)
+  {
+    fprintf(stderr, "usage: %s <trace.fbt> [<expected.golden>]\n", argv[0]);
+    return 2;
+  }
+
+  Trace_Replay replay;
+  if (!replay.map_file(argv[1]))
+  {
+    return 2;
+  }
+
+  // a line for every change in the decision
+  Hit_Detector detector;
+  std::string  output;
+  uint8_t      last_decision = 0;
+
+  bool replayed = replay.replay(detector, [&](unsigned long sample_time)
+  {
+    uint8_t decision = detector.get_decision();
+    if (decision == last_decision) return;
+    last_decision = decision;
+
+    output += describe_decision(detector, sample_time);
+    output += '\n';
+  });
+
+  if (!replayed)
+  {
+    fprintf(stderr, "%s isn't a line trace (no FBT1 header)\n", argv[1]);
+    return 2;
+  }
+
+  if (argc == 3)
+  {
+    return matches_golden(output, argv[2]) ? 0 : 1;
+  }
+
+  fputs(output.c_str(), stdout);
+  return 0;
+}
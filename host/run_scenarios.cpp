@@ -0,0 +1,171 @@
+//============================================================================//
+//  Name    : run_scenarios.cpp                                               //
+//  Desc    : Generates randomized Hit_Scenarios, one seed after another,     //
+//            and checks the hit detection against every one, on every core  //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - A thread per core (or as many as asked for), each with its    //
+//              own Scenario_Checker, taking seeds a block at a time from a   //
+//              shared counter; seeds are the same whatever the thread count, //
+//              so a failure can always be re-run on its own                  //
+//            - Every failure is printed as generated and again shrunk, with  //
+//              what it broke; a running tally (and the rate) goes out about  //
+//              once a second                                                 //
+//            - Exits non-zero if any scenario failed, so ctest can run a     //
+//              batch of it as a check                                        //
+//            - run_scenarios [scenarios] [first seed] [threads]              //
+//============================================================================//
+
+// global includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <Arduino.h>
+
+// local includes
+#include "Hit_Scenario.h"
+#include "Scenario_Checker.h"
+
+// scenarios unless told otherwise
+static const unsigned long DEFAULT_SCENARIOS_ = 10000000;
+
+// seeds a worker takes from the counter at a time; plenty to keep the counter cold
+static const unsigned long SEED_BLOCK_        = 4096;
+
+// how often the tally goes out
+static const auto          REPORT_INTERVAL_   = std::chrono::seconds(1);
+
+
+// a Print that keeps what it's given, so a scenario can be printed in one go from any thread
+class Text_Print : public Print
+{
+  public:
+    size_t write(uint8_t byte) override
+    {
+      // Print ends lines the way Serial does; the terminal doesn't want the '\r'
+      if (byte != '\r') this->text_ += (char)byte;
+      return 1;
+    }
+    using Print::write;
+
+    const std::string& get_text() { return this->text_; }
+
+  private:
+    std::string text_;
+};
+
+
+// what the workers share
+struct shared_run
+{
+  unsigned long              first_seed;
+  unsigned long              end_seed;          // one past the last
+  std::atomic<unsigned long> next_seed;
+  std::atomic<unsigned long> scenarios_run;
+  std::atomic<unsigned long> failures;
+  std::mutex                 print_mutex;
+};
+
+
+// one worker: blocks of seeds until there are none left
+//    shared_run& run - the run it's part of
+void run_worker(shared_run& run)
+{
+  Scenario_Checker           checker;
+  Scenario_Checker::outcome  result;
+  Hit_Scenario               scenario;
+
+  while (true)
+  {
+    unsigned long block_start = run.next_seed.fetch_add(SEED_BLOCK_);
+    if (!(block_start < run.end_seed)) return;
+
+    unsigned long block_end = (run.end_seed - block_start < SEED_BLOCK_) ? run.end_seed : block_start + SEED_BLOCK_;
+
+    for (unsigned long seed = block_start; seed < block_end; seed++)
+    {
+      scenario.generate(seed, Scenario_Checker::CONTACT_MICROS_BY_MODE_, Scenario_Checker::LOCKOUT_MICROS_BY_MODE_);
+
+      Scenario_Checker::violation failure = checker.check(scenario, result);
+      if (failure == Scenario_Checker::NO_VIOLATION) continue;
+
+      run.failures++;
+
+      Text_Print report;
+      report.print("FAILED (");
+      report.print(Scenario_Checker::get_violation_name(failure));
+      report.print("): ");
+      scenario.print(report);
+
+      checker.shrink(scenario, failure);
+      report.print("  shrunk: ");
+      scenario.print(report);
+
+      std::lock_guard<std::mutex> lock(run.print_mutex);
+      fputs(report.get_text().c_str(), stdout);
+      fflush(stdout);
+    }
+
+    run.scenarios_run += block_end - block_start;
+  }
+}
+
+
+int main(int argc, char** argv)
+{
+  unsigned long scenarios  = (argc > 1) ? strtoul(argv[1], NULL, 10) : DEFAULT_SCENARIOS_;
+  unsigned long first_seed = (argc > 2) ? strtoul(argv[2], NULL, 10) : 1;
+  unsigned int  threads    = (argc > 3) ? (unsigned int)strtoul(argv[3], NULL, 10) : std::thread::hardware_concurrency();
+  if (threads == 0) threads = 1;
+
+  shared_run run;
+  run.first_seed    = first_seed;
+  run.end_seed      = first_seed + scenarios;
+  run.next_seed     = first_seed;
+  run.scenarios_run = 0;
+  run.failures      = 0;
+
+  printf("scenarios begin: seeds %lu to %lu on %u threads\n", first_seed, run.end_seed - 1, threads);
+
+  auto start = std::chrono::steady_clock::now();
+
+  std::vector<std::thread> workers;
+  for (unsigned int i = 0; i < threads; i++)
+  {
+    workers.emplace_back(run_worker, std::ref(run));
+  }
+
+  // the tally, while they work
+  auto next_report = start + REPORT_INTERVAL_;
+  while (run.scenarios_run < scenarios)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    if (std::chrono::steady_clock::now() < next_report) continue;
+    next_report += REPORT_INTERVAL_;
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::lock_guard<std::mutex> lock(run.print_mutex);
+    printf("%lu scenarios, %lu failures, %.1f million per minute\n", run.scenarios_run.load(), run.failures.load(),
+           run.scenarios_run / seconds * 60.0 / 1000000.0);
+    fflush(stdout);
+  }
+
+  for (size_t i = 0; i < workers.size(); i++)
+  {
+    workers[i].join();
+  }
+
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  printf("scenarios end: %lu scenarios, %lu failures, %.2fs (%.1f million per minute, %.2fus per scenario per thread)\n",
+         run.scenarios_run.load(), run.failures.load(), seconds, run.scenarios_run / seconds * 60.0 / 1000000.0,
+         (run.scenarios_run > 0) ? seconds * threads * 1000000.0 / run.scenarios_run : 0.0);
+
+  return (run.failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,49 @@
+//============================================================================//
+//  Name    : Adafruit_NeoPixel.h                                             //
+//  Desc    : The slice of Adafruit's NeoPixel library the box's code uses,   //
+//            for the host/ build                                             //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - show() costs what it does on the box (30us a pixel, with      //
+//              interrupts off the whole time) and gets recorded, along with  //
+//              what went out; see Host_Hal                                   //
+//============================================================================//
+
+#ifndef HOST_SHIM_ADAFRUIT_NEOPIXEL_H
+#define HOST_SHIM_ADAFRUIT_NEOPIXEL_H
+
+// global includes
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+// local includes
+#include "Arduino.h"
+
+#define NEO_GRB     ((1 << 6) | (1 << 4) | (0 << 2) | (2))
+#define NEO_KHZ800  0x0000
+
+class Adafruit_NeoPixel
+{
+  public:
+    Adafruit_NeoPixel(uint16_t count, int16_t pin, uint16_t type) : count_(count), pin_(pin)
+    {
+      (void)type;
+      this->pixels_ = (uint8_t*)calloc(count * 3, 1);
+    }
+    ~Adafruit_NeoPixel() { free(this->pixels_); }
+
+    void     begin()                 { pinMode(this->pin_, OUTPUT); digitalWrite(this->pin_, LOW); }
+    void     show()                  { Host_Hal::show(this->pin_, this->pixels_, this->count_); }
+    uint16_t numPixels() const       { return this->count_; }
+    uint8_t* getPixels() const       { return this->pixels_; }
+    void     clear()                 { memset(this->pixels_, 0, this->count_ * 3); }
+
+  private:
+    uint16_t count_;
+    uint8_t  pin_;
+    uint8_t* pixels_;
+};
+
+#endif
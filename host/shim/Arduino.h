@@ -0,0 +1,185 @@
+//============================================================================//
+//  Name    : Arduino.h                                                       //
+//  Desc    : The slice of the Arduino core the box's code uses, for the      //
+//            host/ build, on top of Host_Hal                                 //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Only what the repo actually calls is here; anything new the   //
+//              code starts using shows up as a compile error on the host     //
+//              build, which is the reminder to add it (and its cost)         //
+//            - No min() / max() macros, unlike the real core; they wreck the //
+//              standard library the host tools use                           //
+//            - Serial prints like the real Print class does: integers in     //
+//              decimal, floats to 2 places, char as a character              //
+//============================================================================//
+
+#ifndef HOST_SHIM_ARDUINO_H
+#define HOST_SHIM_ARDUINO_H
+
+// global includes
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+
+// the rest of what the real core pulls in
+#include <avr/io.h>
+#include <avr/pgmspace.h>
+#include <avr/interrupt.h>
+
+// local includes
+#include "../Host_Hal.h"
+
+typedef bool    boolean;
+typedef uint8_t byte;
+
+#define HIGH          0x1
+#define LOW           0x0
+
+#define INPUT         0x0
+#define OUTPUT        0x1
+#define INPUT_PULLUP  0x2
+
+#define DEC 10
+#define HEX 16
+#define BIN 2
+
+template <class T, class L, class H>
+inline T constrain(T value, L low, H high) { return (value < low) ? low : ((value > high) ? high : value); }
+
+// pins, time and sound
+inline void          pinMode(uint8_t pin, uint8_t mode)       { Host_Hal::pin_mode(pin, mode); }
+inline void          digitalWrite(uint8_t pin, uint8_t level) { Host_Hal::digital_write(pin, level); }
+inline int           digitalRead(uint8_t pin)                 { return Host_Hal::digital_read(pin); }
+inline unsigned long micros()                                 { return Host_Hal::read_micros(); }
+inline unsigned long millis()                                 { return Host_Hal::read_micros() / 1000; }
+inline void          tone(uint8_t pin, unsigned int frequency, unsigned long duration_millis = 0) { Host_Hal::tone(pin, frequency, duration_millis); }
+inline void          noTone(uint8_t pin)                      { Host_Hal::tone(pin, 0, 0); }
+inline void          noInterrupts()                           { Host_Hal::set_interrupts_enabled(false); }
+inline void          interrupts()                             { Host_Hal::set_interrupts_enabled(true); }
+
+// the compiler's cycle-counted busy wait (a builtin on avr-gcc, so no header), at the Uno's 62.5ns a cycle
+#define __builtin_avr_delay_cycles(cycles) Host_Hal::advance_nanos((uint64_t)(cycles) * 125 / 2)
+
+// just enough of the Arduino String for the overloads that take one; like the real one, every String has its
+// characters on the heap, so one turning up where it shouldn't shows in Host_Hal::get_allocation_count()
+class String
+{
+  public:
+    String(const char* text = "")           { this->copy_from(text); }
+    String(const std::string& text)         { this->copy_from(text.c_str()); }
+    String(const String& other)             { this->copy_from(other.text_); }
+    ~String()                               { delete[] this->text_; }
+    String& operator=(const String& other)
+    {
+      if (this != &other) { delete[] this->text_; this->copy_from(other.text_); }
+      return *this;
+    }
+
+    unsigned int length() const             { return (unsigned int)strlen(this->text_); }
+    const char*  c_str()  const             { return this->text_; }
+    char operator[](unsigned int i) const   { return (i < this->length()) ? this->text_[i] : 0; }
+    bool operator==(const char* text) const { return strcmp(this->text_, text) == 0; }
+
+  private:
+    void copy_from(const char* text)
+    {
+      this->text_ = new char[strlen(text) + 1];
+      strcpy(this->text_, text);
+    }
+
+    char* text_;
+};
+
+// the real core's Print, formatting and all
+class Print
+{
+  public:
+    virtual ~Print() {}
+
+    virtual size_t write(uint8_t byte) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size)
+    {
+      size_t n = 0;
+      while (n < size && this->write(buffer[n])) n++;
+      return n;
+    }
+    size_t write(const char* buffer, size_t size) { return this->write((const uint8_t*)buffer, size); }
+
+    size_t print(const char* text)                    { return this->write((const uint8_t*)text, strlen(text)); }
+    size_t print(const String& text)                  { return this->write((const uint8_t*)text.c_str(), text.length()); }
+    size_t print(char c)                              { return this->write((uint8_t)c); }
+    size_t print(unsigned char n, int base = DEC)     { return this->print_number((unsigned long)n, base); }
+    size_t print(int n, int base = DEC)               { return this->print((long)n, base); }
+    size_t print(unsigned int n, int base = DEC)      { return this->print_number((unsigned long)n, base); }
+    size_t print(long n, int base = DEC)
+    {
+      if (base == DEC && n < 0) return this->print('-') + this->print_number((unsigned long)(-n), DEC);
+      return this->print_number((unsigned long)n, base);
+    }
+    size_t print(unsigned long n, int base = DEC)     { return this->print_number(n, base); }
+    size_t print(double n, int digits = 2)
+    {
+      char buffer[48];
+      snprintf(buffer, sizeof(buffer), "%.*f", digits, n);
+      return this->print(buffer);
+    }
+
+    template <class T> size_t println(T value)           { size_t n = this->print(value); return n + this->println(); }
+    template <class T> size_t println(T value, int base) { size_t n = this->print(value, base); return n + this->println(); }
+    size_t println()                                     { return this->print("\r\n"); }
+
+  private:
+    size_t print_number(unsigned long n, int base)
+    {
+      char buffer[8 * sizeof(unsigned long) + 1];
+      char* c = &buffer[sizeof(buffer) - 1];
+      *c = '\0';
+      do { unsigned long d = n % base; *--c = (char)(d < 10 ? '0' + d : 'A' + d - 10); n /= base; } while (n != 0);
+      return this->print(c);
+    }
+};
+
+// Print, plus reading (with the real core's timeout reduced to "whatever's there")
+class Stream : public Print
+{
+  public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+
+    size_t readBytes(uint8_t* buffer, size_t length)
+    {
+      size_t n = 0;
+      while (n < length)
+      {
+        int c = this->read();
+        if (c < 0) break;
+        buffer[n++] = (uint8_t)c;
+      }
+      return n;
+    }
+    size_t readBytes(char* buffer, size_t length) { return this->readBytes((uint8_t*)buffer, length); }
+
+    void setTimeout(unsigned long) {}
+};
+
+// Serial goes to Host_Hal, which keeps it for the test (and echoes it to stdout if asked)
+class HardwareSerial : public Stream
+{
+  public:
+    void   begin(unsigned long) {}
+    void   end() {}
+    void   flush() {}
+    size_t write(uint8_t byte) override { Host_Hal::serial_write(byte); return 1; }
+    using  Print::write;
+    int    available() override { return Host_Hal::serial_available(); }
+    int    read() override      { return Host_Hal::serial_read(); }
+    operator bool()             { return true; }
+};
+
+extern HardwareSerial Serial;
+
+#endif
@@ -0,0 +1,22 @@
+//============================================================================//
+//  Name    : interrupt.h                                                     //
+//  Desc    : Interrupt service routines for the host/ build                  //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - An ISR is just a function named after its vector; Host_Hal    //
+//              calls TIMER1_COMPA_vect() when the compare match is due       //
+//============================================================================//
+
+#ifndef HOST_SHIM_AVR_INTERRUPT_H
+#define HOST_SHIM_AVR_INTERRUPT_H
+
+// local includes
+#include "../../Host_Hal.h"
+
+#define ISR(vector) extern "C" void vector(void)
+
+#define cli() Host_Hal::set_interrupts_enabled(false)
+#define sei() Host_Hal::set_interrupts_enabled(true)
+
+#endif
@@ -0,0 +1,87 @@
+//============================================================================//
+//  Name    : io.h                                                            //
+//  Desc    : The ATmega328P registers the box's code touches, for the host/  //
+//            build, routed to Host_Hal                                       //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - _SFR_IO8() is a stand-in object rather than a memory          //
+//              location, so writing PORTB moves the simulated pins and       //
+//              reading PINB reads them; every access costs an in / out /     //
+//              sbi / cbi's worth of simulated time, like it would on the box //
+//            - The memory-mapped registers (Timer1, UART) are just storage;  //
+//              Host_Hal looks at the Timer1 ones to decide when the compare  //
+//              interrupt's due                                               //
+//============================================================================//
+
+#ifndef HOST_SHIM_AVR_IO_H
+#define HOST_SHIM_AVR_IO_H
+
+// global includes
+#include <inttypes.h>
+
+// local includes
+#include "../../Host_Hal.h"
+
+// one I/O register, by address
+class Host_Io_Register
+{
+  public:
+    explicit Host_Io_Register(uint8_t io_address) : io_address_(io_address) {}
+
+    operator uint8_t() const                         { return Host_Hal::read_register(this->io_address_); }
+    Host_Io_Register& operator= (uint8_t value)      { Host_Hal::write_register(this->io_address_, value); return *this; }
+    Host_Io_Register& operator|=(uint8_t mask)       { Host_Hal::write_register(this->io_address_, Host_Hal::peek_register(this->io_address_) | mask); return *this; }
+    Host_Io_Register& operator&=(uint8_t mask)       { Host_Hal::write_register(this->io_address_, Host_Hal::peek_register(this->io_address_) & mask); return *this; }
+    Host_Io_Register& operator^=(uint8_t mask)       { Host_Hal::write_register(this->io_address_, Host_Hal::peek_register(this->io_address_) ^ mask); return *this; }
+
+  private:
+    uint8_t io_address_;
+};
+
+#define _SFR_IO8(io_address)   Host_Io_Register((uint8_t)(io_address))
+#define _SFR_MEM8(address)     Host_Hal::memory_register(address)
+#define _SFR_MEM16(address)    Host_Hal::memory_register_16(address)
+#define _BV(bit)               (1 << (bit))
+
+// the ports
+#define PINB    _SFR_IO8(0x03)
+#define DDRB    _SFR_IO8(0x04)
+#define PORTB   _SFR_IO8(0x05)
+#define PINC    _SFR_IO8(0x06)
+#define DDRC    _SFR_IO8(0x07)
+#define PORTC   _SFR_IO8(0x08)
+#define PIND    _SFR_IO8(0x09)
+#define DDRD    _SFR_IO8(0x0A)
+#define PORTD   _SFR_IO8(0x0B)
+
+// status, and the general purpose I/O registers (free for markers)
+#define TIFR1   _SFR_IO8(0x16)
+#define GPIOR0  _SFR_IO8(0x1E)
+#define GPIOR1  _SFR_IO8(0x2A)
+#define GPIOR2  _SFR_IO8(0x2B)
+#define SREG    _SFR_IO8(0x3F)
+
+// Timer1 and the UART
+#define TIMSK1  _SFR_MEM8(0x6F)
+#define TCCR1A  _SFR_MEM8(0x80)
+#define TCCR1B  _SFR_MEM8(0x81)
+#define TCNT1   _SFR_MEM16(0x84)
+#define OCR1A   _SFR_MEM16(0x88)
+#define UCSR0B  _SFR_MEM8(0xC1)
+
+// bits
+#define SREG_I  7
+#define TOV1    0
+#define OCF1A   1
+#define TOIE1   0
+#define OCIE1A  1
+#define CS10    0
+#define CS11    1
+#define CS12    2
+#define WGM12   3
+#define RXEN0   4
+
+#define F_CPU   16000000UL
+
+#endif
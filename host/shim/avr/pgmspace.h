@@ -0,0 +1,23 @@
+//============================================================================//
+//  Name    : pgmspace.h                                                      //
+//  Desc    : Flash access for the host/ build, where flash is just memory    //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//============================================================================//
+
+#ifndef HOST_SHIM_AVR_PGMSPACE_H
+#define HOST_SHIM_AVR_PGMSPACE_H
+
+// global includes
+#include <inttypes.h>
+#include <string.h>
+
+#define PROGMEM
+#define PSTR(text)             (text)
+#define F(text)                (text)
+#define pgm_read_byte(address) (*(const uint8_t*)(address))
+#define pgm_read_word(address) (*(const uint16_t*)(address))
+#define memcpy_P               memcpy
+
+#endif
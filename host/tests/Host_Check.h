@@ -0,0 +1,38 @@
+//============================================================================//
+//  Name    : Host_Check.h                                                    //
+//  Desc    : The one check macro the host/ tests share                       //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - HOST_CHECK() prints what failed and carries on, so one run    //
+//              shows everything that's wrong; main() returns                 //
+//              host_check_result() for ctest                                 //
+//============================================================================//
+
+#ifndef HOST_CHECK_H
+#define HOST_CHECK_H
+
+// global includes
+#include <stdio.h>
+
+// how many checks have failed so far
+static int host_check_failures_ = 0;
+
+#define HOST_CHECK(condition)                                                              \
+  do                                                                                       \
+  {                                                                                        \
+    if (!(condition))                                                                      \
+    {                                                                                      \
+      printf("FAILED: %s (%s:%d)\n", #condition, __FILE__, __LINE__);                      \
+      host_check_failures_++;                                                              \
+    }                                                                                      \
+  } while (0)
+
+// what main() should return
+inline int host_check_result()
+{
+  if (host_check_failures_ == 0) printf("all checks passed\n");
+  return (host_check_failures_ == 0) ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,122 @@
+//============================================================================//
+//  Name    : allocation_test.cpp                                             //
+//  Desc    : Nothing the main loop does, once setup() is over, allocates     //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - The sketch runs on the simulated Uno, with a TM1637 model on  //
+//              each display so they really send, through everything the      //
+//              loop's tick paths do in a bout: remote buttons (score up,     //
+//              held for score down, clock start / stop, held for a score     //
+//              reset), the mode button round all three weapons, the clock    //
+//              running out, and touches left, right and both                 //
+//            - Every new goes through Host_Hal, which counts it and moves    //
+//              __brkval the way the heap would; one allocation anywhere in   //
+//              all of that fails the test, which is what keeps the String-   //
+//              free display paths String-free                                //
+//============================================================================//
+
+// the box
+#include "Host_Sketch.h"
+
+// local includes
+#include "Tm1637_Model.h"
+#include "Weapon_Circuit.h"
+#include "tests/Host_Check.h"
+
+// how long a press that's a press (first mode) lasts, and a hold that's a hold (second mode, once)
+static const unsigned long PRESS_MICROS_  = 200000;
+static const unsigned long HOLD_MICROS_   = 1300000;
+
+// how long a blade stays down
+static const unsigned long TOUCH_MICROS_  = 2000;
+
+// when it's all over
+static const uint64_t      END_MICROS_    = 30000000;
+
+
+// a button pressed at a given time for a given while; the remote's read HIGH when pressed, the mode button LOW
+//    uint8_t       pin            - which button
+//    uint8_t       pressed_level  - what it reads pressed
+//    uint64_t      elapsed_micros - when, since Host_Hal::reset()
+//    unsigned long duration       - for how long
+void schedule_press(uint8_t pin, uint8_t pressed_level, uint64_t elapsed_micros, unsigned long duration)
+{
+  Host_Hal::schedule_input(pin, pressed_level,                         elapsed_micros);
+  Host_Hal::schedule_input(pin, (pressed_level == HIGH) ? LOW : HIGH,  elapsed_micros + duration);
+}
+
+
+int main()
+{
+  Host_Hal::reset();
+
+  // the displays' shared data line has a pull-up, and the mode button one of its own
+  Host_Hal::set_input(TIME_DISPLAY_DATA_PIN_,   HIGH);
+  Host_Hal::set_input(MODE_SWITCH_BUTTON_PIN_,  HIGH);
+
+  Tm1637_Model   left_chip (LEFT_FENCER_SCORE_DISPLAY_CLK_PIN_,  LEFT_FENCER_SCORE_DISPLAY_DATA_PIN_);
+  Tm1637_Model   right_chip(RIGHT_FENCER_SCORE_DISPLAY_CLK_PIN_, RIGHT_FENCER_SCORE_DISPLAY_DATA_PIN_);
+  Tm1637_Model   time_chip (TIME_DISPLAY_CLK_PIN_,               TIME_DISPLAY_DATA_PIN_);
+  Weapon_Circuit circuit;
+
+  // every contact the touches use, made once (parted) now, so the circuit's own bookkeeping is done before we count
+  circuit.set_contact(LEFT_FENCER_B_WEAPON_LINE_POWER_PIN_,  RIGHT_FENCER_A_LAME_LINE_PIN_, false);
+  circuit.set_contact(RIGHT_FENCER_B_WEAPON_LINE_POWER_PIN_, LEFT_FENCER_A_LAME_LINE_PIN_,  false);
+
+  // a bout's worth of everything, scheduled up front (the schedule's own storage is the host's, not the box's)
+  schedule_press(REMOTE_INPUT_BUTTON_A_PIN_, HIGH,  3500000, PRESS_MICROS_);    // left +1
+  schedule_press(REMOTE_INPUT_BUTTON_B_PIN_, HIGH,  4000000, HOLD_MICROS_);     // right -1
+  Host_Hal::schedule_call(5900000, []() { clock_->set_time(3000000); });         // three seconds left...
+  schedule_press(REMOTE_INPUT_BUTTON_C_PIN_, HIGH,  6000000, PRESS_MICROS_);    // ...and go; it runs out at ~9s
+  schedule_press(MODE_SWITCH_BUTTON_PIN_,    LOW,  11000000, PRESS_MICROS_);    // foil
+  schedule_press(MODE_SWITCH_BUTTON_PIN_,    LOW,  13000000, PRESS_MICROS_);    // epee
+  schedule_press(MODE_SWITCH_BUTTON_PIN_,    LOW,  15000000, PRESS_MICROS_);    // saber again
+  circuit.schedule_contact(LEFT_FENCER_B_WEAPON_LINE_POWER_PIN_,  RIGHT_FENCER_A_LAME_LINE_PIN_, 17000000, TOUCH_MICROS_);
+  circuit.schedule_contact(RIGHT_FENCER_B_WEAPON_LINE_POWER_PIN_, LEFT_FENCER_A_LAME_LINE_PIN_,  21000000, TOUCH_MICROS_);
+  circuit.schedule_contact(LEFT_FENCER_B_WEAPON_LINE_POWER_PIN_,  RIGHT_FENCER_A_LAME_LINE_PIN_, 25000000, TOUCH_MICROS_);
+  circuit.schedule_contact(RIGHT_FENCER_B_WEAPON_LINE_POWER_PIN_, LEFT_FENCER_A_LAME_LINE_PIN_,  25000050, TOUCH_MICROS_);
+  schedule_press(REMOTE_INPUT_BUTTON_D_PIN_, HIGH, 28000000, HOLD_MICROS_);     // scores back to 0-0
+
+  // a look along the way, so we know it all actually happened
+  int  left_score_after_press = -1;
+  mode mode_after_press       = mode::SABER;
+  bool clock_ran_out          = false;
+  Host_Hal::schedule_call( 3900000, [&]() { left_score_after_press = scoreboard_->get_left_fencer_score(); });
+  Host_Hal::schedule_call(10500000, [&]() { clock_ran_out          = !clock_->is_running();                });
+  Host_Hal::schedule_call(12000000, [&]() { mode_after_press       = current_mode_;                        });
+
+  setup();
+
+  // from here on, nothing should touch the heap
+  unsigned long allocations_after_setup = Host_Hal::get_allocation_count();
+  char*         heap_top_after_setup    = __brkval;
+
+  run_sketch_until(END_MICROS_);
+
+  printf("allocations after setup(): %lu, __brkval moved %ld bytes\n",
+         Host_Hal::get_allocation_count() - allocations_after_setup, (long)(__brkval - heap_top_after_setup));
+
+  HOST_CHECK(Host_Hal::get_allocation_count() == allocations_after_setup);
+  HOST_CHECK(__brkval == heap_top_after_setup);
+
+  // and it did actually all happen
+  HOST_CHECK(left_score_after_press == 1);
+  HOST_CHECK(clock_ran_out);
+  HOST_CHECK(mode_after_press == mode::FOIL);
+  HOST_CHECK(scoreboard_->get_left_fencer_score()  == 0);
+  HOST_CHECK(scoreboard_->get_right_fencer_score() == 0);
+  HOST_CHECK(current_mode_ == mode::SABER);
+  HOST_CHECK(!clock_->is_running());
+  HOST_CHECK(time_chip.get_counts().data_writes > 0);
+  HOST_CHECK(Host_Hal::get_tone_events().size() > 0);
+
+  // and the counting works: one allocation, one count, and a String (the usual culprit) is one
+  unsigned long before = Host_Hal::get_allocation_count();
+  delete new uint8_t(0);
+  HOST_CHECK(Host_Hal::get_allocation_count() == before + 1);
+  clock_->clock_->set_display_contents(String("1234"));
+  HOST_CHECK(Host_Hal::get_allocation_count() == before + 2);
+
+  return host_check_result();
+}
@@ -0,0 +1,125 @@
+//============================================================================//
+//  Name    : background_send_test.cpp                                        //
+//  Desc    : Seven_Segment_Background on the simulated Uno, with a TM1637    //
+//            model that can be unplugged                                     //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - A staged frame has to land, and the interrupt has to switch   //
+//              itself off once there's nothing left to send                  //
+//            - An unplugged display has to back off the way it does when     //
+//              tick() sends, not get retried at the full interrupt rate      //
+//============================================================================//
+
+// global includes
+#include <Arduino.h>
+
+// local includes
+#include "Seven_Segment_Display.h"
+#include "Seven_Segment_Background.h"
+#include "Tm1637_Model.h"
+#include "tests/Host_Check.h"
+
+// the display's pins (the time display's, on the box)
+static const uint8_t       CLOCK_PIN_       = 9;
+static const uint8_t       DATA_PIN_        = 11;
+
+// how often the loop ticks the display
+static const unsigned long TICK_MICROS_     = 200;
+
+// how long to leave the display unplugged for
+static const unsigned long UNPLUGGED_MICROS_ = 1000000;
+
+// most frames an unplugged display should get sent in that second: the first try, then one per backoff (10ms,
+// 20ms, 40ms ... doubling), with a couple over for the ticks not landing exactly on time
+static const unsigned long MAX_UNPLUGGED_FAILURES_ = 10;
+
+// and most interrupts, the same frames' worth with room to spare; retrying at the full rate would be ~10,000
+static const unsigned long MAX_UNPLUGGED_INTERRUPTS_ = 1000;
+
+
+// ticks the display for a while
+//    Seven_Segment_Display& display - the display
+//    unsigned long          micros  - how long for
+static void tick_for(Seven_Segment_Display& display, unsigned long micros)
+{
+  for (unsigned long elapsed = 0; elapsed < micros; elapsed += TICK_MICROS_)
+  {
+    display.tick(Host_Hal::get_micros());
+    Host_Hal::advance_micros(TICK_MICROS_);
+  }
+}
+
+
+// whether the chip is showing the given text
+//    Tm1637_Model& chip - the chip
+//    const char*   text - what it should show
+static bool is_showing(Tm1637_Model& chip, const char* text)
+{
+  uint8_t segments[Seven_Segment_Display::DISPLAY_SIZE_];
+  Seven_Segment_Display::encode_string(text, segments, Seven_Segment_Display::DISPLAY_SIZE_);
+  for (uint8_t digit = 0; digit < Seven_Segment_Display::DISPLAY_SIZE_; digit++)
+  {
+    if (chip.get_ram(digit) != segments[digit]) return false;
+  }
+  return true;
+}
+
+
+int main()
+{
+  Host_Hal::reset();
+
+  // the module's pull-up on its data line
+  Host_Hal::set_input(DATA_PIN_, HIGH);
+
+  Tm1637_Model          chip(CLOCK_PIN_, DATA_PIN_);
+  Seven_Segment_Display display(CLOCK_PIN_, DATA_PIN_);
+
+  HOST_CHECK(Seven_Segment_Background::begin());
+  HOST_CHECK(display.send_in_background());
+
+  // a frame goes out, and lands
+  display.set_display_contents("1234");
+  tick_for(display, 20000);
+
+  HOST_CHECK(!display.is_update_pending());
+  HOST_CHECK(is_showing(chip, "1234"));
+
+  // and then there's nothing to send, so the interrupt stops
+  unsigned long idle_interrupts = Host_Hal::get_interrupt_count();
+  tick_for(display, 100000);
+
+  printf("interrupts with nothing to send: %lu\n", Host_Hal::get_interrupt_count() - idle_interrupts);
+  HOST_CHECK(Host_Hal::get_interrupt_count() == idle_interrupts);
+
+  // unplugged, it backs off
+  chip.set_plugged_in(false);
+  Seven_Segment_Background::reset_statistics();
+  unsigned long unplugged_interrupts = Host_Hal::get_interrupt_count();
+
+  display.set_display_contents("5678");
+  tick_for(display, UNPLUGGED_MICROS_);
+
+  Seven_Segment_Background::statistics unplugged = Seven_Segment_Background::get_statistics();
+  unplugged_interrupts = Host_Hal::get_interrupt_count() - unplugged_interrupts;
+
+  printf("unplugged for %lums: %lu failed frames, %lu interrupts\n", UNPLUGGED_MICROS_ / 1000, unplugged.ack_failures,
+         unplugged_interrupts);
+  HOST_CHECK(display.is_degraded());
+  HOST_CHECK(unplugged.ack_failures > 0);
+  HOST_CHECK(unplugged.ack_failures <= MAX_UNPLUGGED_FAILURES_);
+  HOST_CHECK(unplugged_interrupts   <= MAX_UNPLUGGED_INTERRUPTS_);
+
+  // plugged back in, it gets the lot at the next retry, and is answering again
+  chip.set_plugged_in(true);
+  tick_for(display, UNPLUGGED_MICROS_ + 20000);
+
+  HOST_CHECK(!display.is_degraded());
+  HOST_CHECK(!display.is_update_pending());
+  HOST_CHECK(is_showing(chip, "5678"));
+
+  Seven_Segment_Background::end();
+
+  return host_check_result();
+}
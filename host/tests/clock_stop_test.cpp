@@ -0,0 +1,130 @@
+//============================================================================//
+//  Name    : clock_stop_test.cpp                                             //
+//  Desc    : Stopping a Fencing_Clock just after its digits have counted     //
+//            down early, on the simulated Uno, with a TM1637 model showing   //
+//            what's up                                                       //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - The clock sends each change a little early, so for a moment   //
+//              before every tenth the display's already showing it. Stopped  //
+//              then, the digits have to stay put, not go back up a tenth,    //
+//              and the time left has to agree with them                      //
+//============================================================================//
+
+// global includes
+#include <Arduino.h>
+#include <string.h>
+
+// local includes
+#include "Fencing_Clock.h"
+#include "Tm1637_Model.h"
+#include "tests/Host_Check.h"
+
+// the clock display's pins (the time display's, on the box)
+static const uint8_t       CLOCK_PIN_        = 9;
+static const uint8_t       DATA_PIN_         = 11;
+
+// a tenth, the clock's unit
+static const unsigned long TENTH_MICROS_     = Fencing_Clock::MICROS_IN_SEC_ / 10;
+
+// how often the loop ticks the clock
+static const unsigned long TICK_MICROS_      = 20;
+
+// where the countdown starts (in tenths), how long it runs for the lead to be learned, and how long to watch after
+// the stop
+static const unsigned long START_MICROS_     = 9000000;
+static const unsigned long WARM_UP_MICROS_   = 2000000;
+static const unsigned long SETTLE_MICROS_    = 200000;
+
+// most tenths to try before giving up on catching one landing early
+static const unsigned long MAX_TENTHS_TRIED_ = 20;
+
+
+// ticks the clock for a while
+//    Fencing_Clock& clock  - the clock
+//    unsigned long  micros - how long for
+static void tick_for(Fencing_Clock& clock, unsigned long micros)
+{
+  for (unsigned long elapsed = 0; elapsed < micros; elapsed += TICK_MICROS_)
+  {
+    clock.tick(Host_Hal::get_micros());
+    Host_Hal::advance_micros(TICK_MICROS_);
+  }
+}
+
+
+// what the chip's showing
+//    Tm1637_Model& chip      - the chip
+//    uint8_t*      segments  - filled in, a display's worth
+static void read_chip(Tm1637_Model& chip, uint8_t* segments)
+{
+  for (uint8_t digit = 0; digit < Seven_Segment_Display::DISPLAY_SIZE_; digit++)
+  {
+    segments[digit] = chip.get_ram(digit);
+  }
+}
+
+
+int main()
+{
+  Host_Hal::reset();
+
+  // the module's pull-up on its data line
+  Host_Hal::set_input(DATA_PIN_, HIGH);
+
+  Tm1637_Model  chip(CLOCK_PIN_, DATA_PIN_);
+  Fencing_Clock clock(CLOCK_PIN_, DATA_PIN_);
+
+  // (a tick first, so the clock's time starts at 0 like everything else here)
+  clock.tick(Host_Hal::get_micros());
+  clock.set_time(START_MICROS_);
+  clock.start();
+  tick_for(clock, WARM_UP_MICROS_);
+
+  unsigned long lead_micros = clock.get_display_lag_statistics().lead_micros;
+  printf("lead after warming up: %luus\n", lead_micros);
+  HOST_CHECK(lead_micros > 0);
+
+  // watch each tenth come up, and stop the clock the moment one lands while the time left is still above it
+  uint8_t       before[Seven_Segment_Display::DISPLAY_SIZE_];
+  uint8_t       shown [Seven_Segment_Display::DISPLAY_SIZE_];
+  unsigned long stopped_at_micros = 0;
+  read_chip(chip, before);
+
+  for (unsigned long tenths = 0; tenths < MAX_TENTHS_TRIED_ && stopped_at_micros == 0; )
+  {
+    clock.tick(Host_Hal::get_micros());
+    Host_Hal::advance_micros(TICK_MICROS_);
+
+    read_chip(chip, shown);
+    if (memcmp(shown, before, sizeof(shown)) == 0) continue;
+
+    // a change just landed; early, if the time left hasn't got down to the tenth it shows yet
+    unsigned long remaining = clock.get_remaining_micros();
+    if (remaining % TENTH_MICROS_ < lead_micros)
+    {
+      clock.stop();
+      stopped_at_micros = remaining;
+    }
+
+    memcpy(before, shown, sizeof(before));
+    tenths++;
+  }
+
+  printf("stopped %luus above a tenth, with it already showing\n", stopped_at_micros % TENTH_MICROS_);
+  HOST_CHECK(stopped_at_micros != 0);
+
+  // the digits stay as they were, and the time left is the tenth they show
+  tick_for(clock, SETTLE_MICROS_);
+  read_chip(chip, shown);
+
+  bool unchanged = (memcmp(shown, before, sizeof(shown)) == 0);
+  printf("after stopping: %s, %luus left\n", unchanged ? "digits unchanged" : "DIGITS WENT BACK UP",
+         clock.get_remaining_micros());
+  HOST_CHECK(unchanged);
+  HOST_CHECK(clock.get_remaining_micros() / TENTH_MICROS_ == stopped_at_micros / TENTH_MICROS_ - 1);
+  HOST_CHECK(stopped_at_micros - clock.get_remaining_micros() <= lead_micros);
+
+  return host_check_result();
+}
@@ -0,0 +1,114 @@
+//============================================================================//
+//  Name    : display_scroll_test.cpp                                         //
+//  Desc    : Scrolling messages on one Seven_Segment_Display, on the         //
+//            simulated Uno, with a TM1637 model showing what's up            //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - A normal message scrolls; a priority one scrolls over it for  //
+//              a while. The normal one has to keep scrolling underneath,     //
+//              and be where it would have been anyway once it's uncovered    //
+//============================================================================//
+
+// global includes
+#include <Arduino.h>
+
+// local includes
+#include "Seven_Segment_Display.h"
+#include "Tm1637_Model.h"
+#include "tests/Host_Check.h"
+
+// the display's pins (the time display's, on the box)
+static const uint8_t       CLOCK_PIN_          = 9;
+static const uint8_t       DATA_PIN_           = 11;
+
+// how often the loop ticks the display
+static const unsigned long TICK_MICROS_        = 200;
+
+// the normal message, scrolling a character every step; with a display's worth of blank after it, it comes round
+// every 11 steps
+static const char*         NORMAL_TEXT_        = "1234567";
+static const unsigned long STEP_MICROS_        = 100000;
+
+// the priority one, scrolling over it from partway through the third step for half a second
+static const char*         OVERRIDE_TEXT_      = "ABCDE";
+static const unsigned long OVERRIDE_AT_MICROS_ = 250000;
+static const unsigned long OVERRIDE_MICROS_    = 500000;
+
+// when to look, halfway between steps (well clear of a step, and of the little each one drifts by a tick), and
+// what should be up then
+struct window_check
+{
+  unsigned long at_micros;
+  const char*   shown;
+};
+static const window_check CHECKS_[] =
+{
+  { 150000,  "2345" },   // one step in, before the priority message
+  { 500000,  "CDE " },   // the priority message, two steps in
+  { 1050000, " 123" },   // the normal one again, ten steps in
+  { 1150000, "1234" },   // eleven, round to the start
+  { 1250000, "2345" },
+};
+
+
+// ticks the display until the given time
+//    Seven_Segment_Display& display - the display
+//    unsigned long          micros  - until when
+static void tick_until(Seven_Segment_Display& display, unsigned long micros)
+{
+  while (Host_Hal::get_micros() < micros)
+  {
+    display.tick(Host_Hal::get_micros());
+    Host_Hal::advance_micros(TICK_MICROS_);
+  }
+}
+
+
+// whether the chip is showing the given text
+//    Tm1637_Model& chip - the chip
+//    const char*   text - what it should show
+static bool is_showing(Tm1637_Model& chip, const char* text)
+{
+  uint8_t segments[Seven_Segment_Display::DISPLAY_SIZE_];
+  Seven_Segment_Display::encode_string(text, segments, Seven_Segment_Display::DISPLAY_SIZE_);
+  for (uint8_t digit = 0; digit < Seven_Segment_Display::DISPLAY_SIZE_; digit++)
+  {
+    if (chip.get_ram(digit) != segments[digit]) return false;
+  }
+  return true;
+}
+
+
+int main()
+{
+  Host_Hal::reset();
+
+  // the module's pull-up on its data line
+  Host_Hal::set_input(DATA_PIN_, HIGH);
+
+  Tm1637_Model          chip(CLOCK_PIN_, DATA_PIN_);
+  Seven_Segment_Display display(CLOCK_PIN_, DATA_PIN_);
+
+  // (a tick first, so the display's clock starts at 0 like everything else here)
+  display.tick(Host_Hal::get_micros());
+  display.set_display_contents(NORMAL_TEXT_, false, false, 0, true, true, STEP_MICROS_);
+
+  bool overridden = false;
+  for (size_t i = 0; i < sizeof(CHECKS_) / sizeof(CHECKS_[0]); i++)
+  {
+    if (!overridden && CHECKS_[i].at_micros > OVERRIDE_AT_MICROS_)
+    {
+      tick_until(display, OVERRIDE_AT_MICROS_);
+      display.set_display_contents(OVERRIDE_TEXT_, false, true, OVERRIDE_MICROS_, true, true, STEP_MICROS_);
+      overridden = true;
+    }
+
+    tick_until(display, CHECKS_[i].at_micros);
+
+    printf("at %4lums: expecting \"%s\"\n", CHECKS_[i].at_micros / 1000, CHECKS_[i].shown);
+    HOST_CHECK(is_showing(chip, CHECKS_[i].shown));
+  }
+
+  return host_check_result();
+}
@@ -0,0 +1,102 @@
+//============================================================================//
+//  Name    : display_traffic_test.cpp                                        //
+//  Desc    : Bus traffic per update for one Seven_Segment_Display, on the    //
+//            simulated Uno, with a TM1637 model decoding it                  //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Prints the bytes and start ... stops each kind of update      //
+//              costs, as the display counts them and as the chip got them,   //
+//              and checks them against what only sending the changed digits  //
+//              (in bursts, bridging a single unchanged one) should cost      //
+//            - Every update also has to land: the chip's RAM has to hold     //
+//              the new digits afterwards                                     //
+//============================================================================//
+
+// global includes
+#include <Arduino.h>
+
+// local includes
+#include "Seven_Segment_Display.h"
+#include "Tm1637_Model.h"
+#include "tests/Host_Check.h"
+
+// the display's pins (the time display's, on the box)
+static const uint8_t       CLOCK_PIN_ = 9;
+static const uint8_t       DATA_PIN_  = 11;
+
+// most ticks any one update should need; well past what the slowest takes
+static const unsigned long MAX_TICKS_ = 1000;
+
+// one update, and what it should cost
+struct traffic_case
+{
+  const char*   label;
+  const char*   text;
+  unsigned long bytes;
+  unsigned long start_stop_pairs;
+};
+
+// in order, each from the one before
+static const traffic_case CASES_[] =
+{
+  { "first update (data command, display control, all four)", "1234", 7, 3 },
+  { "last digit only",                                          "1235", 2, 1 },
+  { "last three digits",                                        "1567", 4, 1 },
+  { "first and third (one burst over the second)",              "9587", 4, 1 },
+  { "first and last (two bursts)",                              "6584", 4, 2 },
+  { "nothing",                                                  "6584", 0, 0 },
+  { "all four",                                                 "    ", 5, 1 },
+};
+
+
+int main()
+{
+  Host_Hal::reset();
+
+  // the module's pull-up on its data line
+  Host_Hal::set_input(DATA_PIN_, HIGH);
+
+  Tm1637_Model          chip(CLOCK_PIN_, DATA_PIN_);
+  Seven_Segment_Display display(CLOCK_PIN_, DATA_PIN_);
+
+  printf("%-56s %7s %12s\n", "update", "bytes", "start-stops");
+
+  for (size_t i = 0; i < sizeof(CASES_) / sizeof(CASES_[0]); i++)
+  {
+    const traffic_case& expected = CASES_[i];
+
+    display.reset_bus_statistics();
+    chip.reset_counts();
+
+    display.set_display_contents(expected.text);
+
+    unsigned long ticks = 0;
+    while (display.is_update_pending() && ticks < MAX_TICKS_)
+    {
+      display.tick(Host_Hal::get_micros());
+      ticks++;
+    }
+
+    Seven_Segment_Display::bus_statistics sent     = display.get_bus_statistics();
+    Tm1637_Model::counts                  received = chip.get_counts();
+
+    printf("%-56s %7lu %12lu\n", expected.label, sent.bytes_sent, sent.start_stop_pairs);
+
+    HOST_CHECK(!display.is_update_pending());
+    HOST_CHECK(sent.bytes_sent       == expected.bytes);
+    HOST_CHECK(sent.start_stop_pairs == expected.start_stop_pairs);
+    HOST_CHECK(received.bytes_received == sent.bytes_sent);
+    HOST_CHECK(received.transactions   == sent.start_stop_pairs);
+
+    // and it's up there
+    uint8_t segments[Seven_Segment_Display::DISPLAY_SIZE_];
+    Seven_Segment_Display::encode_string(expected.text, segments, Seven_Segment_Display::DISPLAY_SIZE_);
+    for (uint8_t digit = 0; digit < Seven_Segment_Display::DISPLAY_SIZE_; digit++)
+    {
+      HOST_CHECK(chip.get_ram(digit) == segments[digit]);
+    }
+  }
+
+  return host_check_result();
+}
@@ -0,0 +1,102 @@
+//============================================================================//
+//  Name    : sketch_smoke_test.cpp                                           //
+//  Desc    : The whole sketch, on the simulated Uno, through one saber touch //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - The left blade lands on the right lame for a couple of        //
+//              milliseconds; the left ring should go red straight away, the  //
+//              buzzer should go once the lockout's up, and the ring should   //
+//              go dark again once the lights have been on long enough        //
+//============================================================================//
+
+// the box
+#include "Host_Sketch.h"
+
+// local includes
+#include "Weapon_Circuit.h"
+#include "tests/Host_Check.h"
+
+// when the blade lands, and for how long (well past the startup animation, and well over saber's contact time)
+static const uint64_t      TOUCH_AT_MICROS_       = 5000000;
+static const unsigned long TOUCH_DURATION_MICROS_ = 2000;
+
+// how long a loop pass takes on the simulated Uno, give or take; the slack allowed on every deadline below
+static const uint64_t      LOOP_PASS_SLACK_MICROS_ = 2000;
+
+
+// the first show() on a pin at or after the given time, or NULL
+//    uint8_t  pin          - which ring
+//    uint64_t after_micros - since Host_Hal::reset()
+const Host_Hal::show_event* first_show_after(uint8_t pin, uint64_t after_micros)
+{
+  const std::vector<Host_Hal::show_event>& shows = Host_Hal::get_show_events();
+
+  for (size_t i = 0; i < shows.size(); i++)
+  {
+    if (shows[i].pin == pin && shows[i].nanos >= after_micros * 1000) return &shows[i];
+  }
+  return NULL;
+}
+
+
+// whether any pixel of a show() has any color in it
+bool is_lit(const Host_Hal::show_event* show)
+{
+  for (size_t i = 0; i < show->bytes.size(); i++)
+  {
+    if (show->bytes[i] != 0) return true;
+  }
+  return false;
+}
+
+
+int main()
+{
+  Host_Hal::reset();
+  Weapon_Circuit circuit;
+
+  setup();
+
+  circuit.schedule_contact(LEFT_FENCER_B_WEAPON_LINE_POWER_PIN_, RIGHT_FENCER_A_LAME_LINE_PIN_, TOUCH_AT_MICROS_, TOUCH_DURATION_MICROS_);
+
+  run_sketch_until(TOUCH_AT_MICROS_ + Hit_Detector::LIGHT_DURATION_MICROS_ + 1000000);
+
+  // the left ring goes red (GRB, so the second byte) as soon as the hit's in
+  const Host_Hal::show_event* left_lit = first_show_after(LEFT_FENCER_RING_LIGHT_CONTROL_PIN_, TOUCH_AT_MICROS_);
+  HOST_CHECK(left_lit != NULL);
+  if (left_lit != NULL)
+  {
+    HOST_CHECK(left_lit->nanos / 1000 < TOUCH_AT_MICROS_ + Hit_Detector::SABER_CONTACT_MICROS_ + LOOP_PASS_SLACK_MICROS_);
+    HOST_CHECK(left_lit->bytes[0] == 0 && left_lit->bytes[1] != 0 && left_lit->bytes[2] == 0);
+  }
+
+  // the right ring stays dark
+  const Host_Hal::show_event* right_lit = first_show_after(RIGHT_FENCER_RING_LIGHT_CONTROL_PIN_, TOUCH_AT_MICROS_);
+  HOST_CHECK(right_lit == NULL || !is_lit(right_lit));
+
+  // the buzzer goes once the lockout's up, and only then
+  const std::vector<Host_Hal::tone_event>& tones = Host_Hal::get_tone_events();
+  const Host_Hal::tone_event*              buzz  = NULL;
+  for (size_t i = 0; i < tones.size() && buzz == NULL; i++)
+  {
+    if (tones[i].pin == BUZZER_CONTROL_PIN_ && tones[i].frequency != 0 && tones[i].nanos >= TOUCH_AT_MICROS_ * 1000) buzz = &tones[i];
+  }
+  HOST_CHECK(buzz != NULL);
+  if (buzz != NULL)
+  {
+    uint64_t buzz_micros = buzz->nanos / 1000;
+    HOST_CHECK(buzz_micros >= TOUCH_AT_MICROS_ + Hit_Detector::SABER_LOCKOUT_MICROS_);
+    HOST_CHECK(buzz_micros <  TOUCH_AT_MICROS_ + Hit_Detector::SABER_LOCKOUT_MICROS_ + LOOP_PASS_SLACK_MICROS_);
+  }
+
+  // and the left ring goes dark again once the lights have been on long enough
+  uint64_t dark_after = TOUCH_AT_MICROS_ + Hit_Detector::SABER_LOCKOUT_MICROS_ + Hit_Detector::LIGHT_DURATION_MICROS_;
+  const Host_Hal::show_event* left_dark = first_show_after(LEFT_FENCER_RING_LIGHT_CONTROL_PIN_, dark_after - LOOP_PASS_SLACK_MICROS_);
+  HOST_CHECK(left_dark != NULL && !is_lit(left_dark));
+
+  // and the hit detection's ready for the next one
+  HOST_CHECK(!hit_detector_->is_locked_out());
+
+  return host_check_result();
+}
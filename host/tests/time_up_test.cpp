@@ -0,0 +1,102 @@
+//============================================================================//
+//  Name    : time_up_test.cpp                                                //
+//  Desc    : The whole sketch, on the simulated Uno, with the bout's time    //
+//            running out in the middle of a saber touch                      //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - The left blade lands just before time's up, so the time-up    //
+//              comes inside the lockout. The touch has to play out as any    //
+//              other would: the left ring red the whole time its lights are  //
+//              on, with nothing flashing over it                             //
+//            - The time-up alert still has to flash, once the touch is over  //
+//============================================================================//
+
+// the box
+#include "Host_Sketch.h"
+
+// local includes
+#include "Weapon_Circuit.h"
+#include "tests/Host_Check.h"
+
+// when the bout's last second starts (well past the startup animation), so when it runs out
+static const uint64_t      LAST_SECOND_AT_MICROS_ = 3000000;
+static const uint64_t      TIME_UP_AT_MICROS_     = LAST_SECOND_AT_MICROS_ + 1000000;
+
+// when the blade lands (inside a saber lockout of the time-up), and for how long
+static const uint64_t      TOUCH_AT_MICROS_       = TIME_UP_AT_MICROS_ - 50000;
+static const unsigned long TOUCH_DURATION_MICROS_ = 2000;
+
+// how long a loop pass takes on the simulated Uno, give or take; the slack allowed on every deadline below
+static const uint64_t      LOOP_PASS_SLACK_MICROS_ = 2000;
+
+
+// whether every pixel of a show() is red (GRB, so only the second byte of each)
+bool is_all_red(const Host_Hal::show_event& show)
+{
+  for (size_t i = 0; i + 2 < show.bytes.size(); i += 3)
+  {
+    if (show.bytes[i] != 0 || show.bytes[i + 1] == 0 || show.bytes[i + 2] != 0) return false;
+  }
+  return true;
+}
+
+
+// whether any pixel of a show() is white
+bool has_white(const Host_Hal::show_event& show)
+{
+  for (size_t i = 0; i + 2 < show.bytes.size(); i += 3)
+  {
+    if (show.bytes[i] != 0 && show.bytes[i + 1] != 0 && show.bytes[i + 2] != 0) return true;
+  }
+  return false;
+}
+
+
+int main()
+{
+  Host_Hal::reset();
+  Weapon_Circuit circuit;
+
+  setup();
+
+  circuit.schedule_contact(LEFT_FENCER_B_WEAPON_LINE_POWER_PIN_, RIGHT_FENCER_A_LAME_LINE_PIN_, TOUCH_AT_MICROS_, TOUCH_DURATION_MICROS_);
+
+  run_sketch_until(LAST_SECOND_AT_MICROS_);
+  clock_->set_time(1000000);
+  clock_->start();
+
+  uint64_t dark_after = TOUCH_AT_MICROS_ + Hit_Detector::SABER_LOCKOUT_MICROS_ + Hit_Detector::LIGHT_DURATION_MICROS_;
+  run_sketch_until(dark_after + 1000000);
+
+  // time did run out, inside the lockout
+  HOST_CHECK(clock_->get_timer_remaining_micros(Fencing_Clock::BOUT_TIMER) == 0);
+
+  // every show() on the left ring from the touch until its lights are due to go out is the hit's red
+  const std::vector<Host_Hal::show_event>& shows = Host_Hal::get_show_events();
+  unsigned long shows_during_touch = 0;
+  bool          flashed_after      = false;
+  for (size_t i = 0; i < shows.size(); i++)
+  {
+    if (shows[i].pin != LEFT_FENCER_RING_LIGHT_CONTROL_PIN_) continue;
+
+    uint64_t show_micros = shows[i].nanos / 1000;
+    if (show_micros >= TOUCH_AT_MICROS_ && show_micros < dark_after - LOOP_PASS_SLACK_MICROS_)
+    {
+      shows_during_touch++;
+      HOST_CHECK(is_all_red(shows[i]));
+    }
+
+    // and the alert flashes once it's over
+    if (show_micros >= dark_after - LOOP_PASS_SLACK_MICROS_ && has_white(shows[i]))
+    {
+      flashed_after = true;
+    }
+  }
+
+  printf("left ring: %lu shows during the touch, alert %s afterwards\n", shows_during_touch, flashed_after ? "flashed" : "didn't flash");
+  HOST_CHECK(shows_during_touch > 0);
+  HOST_CHECK(flashed_after);
+
+  return host_check_result();
+}
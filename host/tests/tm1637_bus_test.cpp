@@ -0,0 +1,229 @@
+//============================================================================//
+//  Name    : tm1637_bus_test.cpp                                             //
+//  Desc    : The sketch's three displays, on the simulated Uno, with a       //
+//            TM1637 model on each decoding what really went down the wires   //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Every byte and every start ... stop each display counts in    //
+//              its bus_statistics has to be one its chip actually took in,   //
+//              and the chip's RAM has to end up holding the digits it was    //
+//              sent, through a score change and with the clock running       //
+//            - No transaction may start while another one's partway through //
+//              (the clock's first in line while it runs, but it still has to //
+//              wait for the scoreboards' to finish, and shared ones too)     //
+//            - Then one scoreboard gets unplugged and plugged back in: the   //
+//              box has to notice (ACK failures, degraded), leave the others  //
+//              alone, and put the right digits back up once it's back; and  //
+//              while it's out, the other one's ACKs on a transaction they'd  //
+//              both share mustn't pass for its own                           //
+//============================================================================//
+
+// global includes
+#include <functional>
+
+// the box
+#include "Host_Sketch.h"
+
+// local includes
+#include "Tm1637_Model.h"
+#include "tests/Host_Check.h"
+
+// how long everything gets to settle after each change; plenty for a few transactions, and for the degraded display's
+// backed-off retries to come round again
+static const uint64_t SETTLE_MICROS_   = 1000000;
+static const uint64_t RECOVER_MICROS_  = 10000000;
+
+// how often the left scoreboard gets everything sent again while the right one's unplugged
+static const uint64_t RESEND_MICROS_   = 1000;
+
+// how often the scores change with the clock running in tenths (often enough that a scoreboard's nearly always
+// partway through something when the clock's digits change), and how often the chips get looked at meanwhile
+static const uint64_t SCORE_CHANGE_MICROS_ = 1000;
+static const uint64_t OVERLAP_LOOK_MICROS_ = 20;
+
+
+// whether any chip is partway through a transaction that didn't start when another chip's did: every one partway
+// through has to be in the same one, shared
+//    Tm1637_Model* chips[] - the modules
+//    uint8_t       count   - how many
+bool transactions_overlap(Tm1637_Model* chips[], uint8_t count)
+{
+  bool     any_in_one = false;
+  uint64_t started    = 0;
+  for (uint8_t i = 0; i < count; i++)
+  {
+    if (!chips[i]->is_in_transaction()) continue;
+
+    if (any_in_one && chips[i]->get_transaction_start_nanos() != started) return true;
+    any_in_one = true;
+    started    = chips[i]->get_transaction_start_nanos();
+  }
+  return false;
+}
+
+
+// the display's own bus accounting has to agree with what its chip got, transaction for transaction and byte for byte,
+// and the chip has to have been given time enough to get it
+//    const char*            name    - for the printout
+//    Seven_Segment_Display* display - the box's side
+//    Tm1637_Model&          chip    - the module's side
+void check_counts_agree(const char* name, Seven_Segment_Display* display, Tm1637_Model& chip)
+{
+  Seven_Segment_Display::bus_statistics sent     = display->get_bus_statistics();
+  Tm1637_Model::counts                  received = chip.get_counts();
+
+  printf("%-6s sent %5lu bytes in %4lu transactions, received %5lu in %4lu, %lu ACK failures\n",
+         name, sent.bytes_sent, sent.start_stop_pairs, received.bytes_received, received.transactions, sent.ack_failures);
+
+  HOST_CHECK(!display->is_update_pending());
+  HOST_CHECK(sent.bytes_sent       == received.bytes_received);
+  HOST_CHECK(sent.start_stop_pairs == received.transactions);
+  HOST_CHECK(sent.ack_failures     == 0);
+  HOST_CHECK(received.bad_commands == 0);
+  HOST_CHECK(received.shortest_clock_nanos >= Tm1637_Model::MIN_CLOCK_NANOS_);
+  HOST_CHECK(received.shortest_setup_nanos >= Tm1637_Model::MIN_SETUP_NANOS_);
+  HOST_CHECK(chip.is_display_on());
+}
+
+
+// the chip's first four digits have to be the given text, as the display encodes it (less the colon bit, which the
+// scoreboards never set)
+//    Tm1637_Model& chip - the module
+//    const char*   text - four characters
+void check_digits(Tm1637_Model& chip, const char* text)
+{
+  uint8_t expected[Seven_Segment_Display::DISPLAY_SIZE_];
+  Seven_Segment_Display::encode_string(text, expected, Seven_Segment_Display::DISPLAY_SIZE_);
+
+  for (uint8_t i = 0; i < Seven_Segment_Display::DISPLAY_SIZE_; i++)
+  {
+    HOST_CHECK(chip.get_ram(i) == expected[i]);
+  }
+}
+
+
+int main()
+{
+  Host_Hal::reset();
+
+  // the modules' pull-up holds the shared data line high whenever nobody's pulling it down
+  Host_Hal::set_input(TIME_DISPLAY_DATA_PIN_, HIGH);
+
+  Tm1637_Model left_chip (LEFT_FENCER_SCORE_DISPLAY_CLK_PIN_,  LEFT_FENCER_SCORE_DISPLAY_DATA_PIN_);
+  Tm1637_Model right_chip(RIGHT_FENCER_SCORE_DISPLAY_CLK_PIN_, RIGHT_FENCER_SCORE_DISPLAY_DATA_PIN_);
+  Tm1637_Model time_chip (TIME_DISPLAY_CLK_PIN_,               TIME_DISPLAY_DATA_PIN_);
+
+  setup();
+
+  Seven_Segment_Display* left_display  = scoreboard_->left_fencer_score_display_;
+  Seven_Segment_Display* right_display = scoreboard_->right_fencer_score_display_;
+  Seven_Segment_Display* time_display  = clock_->clock_;
+
+  uint64_t now = SETTLE_MICROS_;
+  run_sketch_until(now);
+
+  // at power-on they all want the same data command and display control, so those go out once for the lot
+  printf("at power-on: %lu shared transactions, %lu bytes saved\n", display_bus_->get_broadcast_count(),
+         display_bus_->get_bytes_saved());
+  HOST_CHECK(display_bus_->get_broadcast_count() > 0);
+
+  // a score change
+  scoreboard_->set_scores(12, 7);
+  run_sketch_until(now += SETTLE_MICROS_);
+
+  printf("after a score change:\n");
+  check_counts_agree("left",  left_display,  left_chip);
+  check_counts_agree("right", right_display, right_chip);
+  check_counts_agree("time",  time_display,  time_chip);
+  check_digits(left_chip,  "  12");
+  check_digits(right_chip, "   7");
+
+  // a few seconds of the clock counting down, a digit change every second, then stopped so nothing's half-sent
+  clock_->start();
+  run_sketch_until(now += 3 * SETTLE_MICROS_);
+  clock_->stop();
+  run_sketch_until(now += SETTLE_MICROS_);
+
+  printf("after the clock's run:\n");
+  check_counts_agree("time",  time_display,  time_chip);
+  HOST_CHECK(time_chip.get_counts().data_writes > 0);
+
+  // the clock running in tenths, so first in line and changing often, with the scores changing under it, now and
+  // then to the same on both so they'd share
+  // (each look schedules the next; scheduling them all up front costs more than the run)
+  Tm1637_Model*         chips[]  = { &left_chip, &right_chip, &time_chip };
+  unsigned long         looks    = 0;
+  unsigned long         overlaps = 0;
+  uint64_t              look_at  = now;
+  uint64_t              look_end = now + 3 * SETTLE_MICROS_;
+  std::function<void()> look     = [&]()
+  {
+    looks++;
+    if (transactions_overlap(chips, 3)) overlaps++;
+    if ((look_at += OVERLAP_LOOK_MICROS_) < look_end) Host_Hal::schedule_call(look_at, look);
+  };
+  Host_Hal::schedule_call(look_at, look);
+
+  clock_->set_time(9000000);
+  clock_->start();
+  for (uint64_t end = now + 3 * SETTLE_MICROS_, change = 0; now < end; now += SCORE_CHANGE_MICROS_, change++)
+  {
+    scoreboard_->set_scores(change % 10, (change % 3 == 0) ? change % 10 : change % 7);
+    run_sketch_until(now);
+  }
+  clock_->stop();
+  scoreboard_->set_scores(12, 7);
+  run_sketch_until(now += SETTLE_MICROS_);
+
+  printf("with the clock and the scores all changing: %lu looks, %lu with one transaction over another\n", looks,
+         overlaps);
+  HOST_CHECK(looks > 0);
+  HOST_CHECK(overlaps == 0);
+  check_counts_agree("left",  left_display,  left_chip);
+  check_counts_agree("right", right_display, right_chip);
+  check_counts_agree("time",  time_display,  time_chip);
+  check_digits(left_chip,  "  12");
+  check_digits(right_chip, "   7");
+
+  // the right scoreboard comes unplugged, and misses a score change
+  right_chip.set_plugged_in(false);
+  scoreboard_->set_scores(12, 8);
+  run_sketch_until(now += SETTLE_MICROS_);
+
+  printf("with the right scoreboard unplugged:\n");
+  HOST_CHECK(right_display->get_bus_statistics().ack_failures > 0);
+  HOST_CHECK(right_display->is_degraded());
+  check_digits(right_chip, "   7");
+  check_counts_agree("left",  left_display,  left_chip);
+
+  // still unplugged, it wants just what the left one does, which keeps getting everything sent again (the display
+  // control command on) so it's still wanting it whenever the right one's retry comes round; they'd share, and the
+  // left one's ACK mustn't pass for the right one's
+  scoreboard_->set_scores(8, 8);
+  for (uint64_t end = now + 3 * SETTLE_MICROS_; now < end; now += RESEND_MICROS_)
+  {
+    left_display->set_display_on(true);
+    left_display->refresh();
+    run_sketch_until(now);
+  }
+  run_sketch_until(now += SETTLE_MICROS_);
+
+  printf("with both scoreboards wanting the same, the right one still unplugged:\n");
+  HOST_CHECK(right_display->is_degraded());
+  HOST_CHECK(right_display->is_update_pending());
+  check_digits(left_chip,  "   8");
+  check_counts_agree("left",  left_display,  left_chip);
+
+  // and gets plugged back in; the box finds it again on a retry, and puts the new score up
+  right_chip.set_plugged_in(true);
+  run_sketch_until(now += RECOVER_MICROS_);
+
+  printf("with it plugged back in:\n");
+  HOST_CHECK(!right_display->is_degraded());
+  HOST_CHECK(!right_display->is_update_pending());
+  check_digits(right_chip, "   8");
+  check_digits(left_chip,  "   8");
+
+  return host_check_result();
+}
@@ -0,0 +1,150 @@
+//============================================================================//
+//  Name    : transfer_tick_test.cpp                                          //
+//  Desc    : How much pin work one Seven_Segment_Display tick does, and that //
+//            what it sends in those slices still decodes, on the simulated   //
+//            Uno with a TM1637 model on the pins                             //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - The worst single tick has to stay within the units it's       //
+//              allowed (START, BIT and STOP are four pin writes each, the    //
+//              eighth bit two more for its ACK), at a few settings of        //
+//              set_transfer_units_per_tick()                                 //
+//            - CLK has to stay high and low, and DIO set before CLK rises,   //
+//              for as long as the chip needs, however quick the pins are     //
+//            - The box can't be driving DIO high while the chip's pulling it //
+//              low to ACK, for any longer than it takes to let go after the  //
+//              eighth bit's falling edge                                     //
+//            - Every update has to land in the chip's RAM regardless         //
+//            - Fixed_Pin_Transfer has to put exactly the same waveform on    //
+//              the wires as Seven_Segment_Transfer, edge for edge            //
+//============================================================================//
+
+// global includes
+#include <Arduino.h>
+#include <vector>
+
+// local includes
+#include "Seven_Segment_Display.h"
+#include "Fixed_Pin_Transfer.h"
+#include "Tm1637_Model.h"
+#include "tests/Host_Check.h"
+
+// the display's pins (the time display's, on the box)
+static const uint8_t       CLOCK_PIN_            = 9;
+static const uint8_t       DATA_PIN_             = 11;
+
+// the most pin writes any one unit takes, and the eighth bit's extra for its ACK
+static const unsigned long MAX_WRITES_PER_UNIT_  = 4;
+static const unsigned long MAX_ACK_WRITES_       = 2;
+
+// the longest the box may drive DIO against the chip's ACK: the one pinMode() it takes to let go
+static const uint64_t      MAX_FIGHT_NANOS_      = Host_Hal::UNO_COSTS_.pin_mode_nanos;
+
+// most ticks any one update should need
+static const unsigned long MAX_TICKS_            = 1000;
+
+// the updates sent, in order
+static const char* const   UPDATES_[]            = { "1234", "1235", "1567", "9587", "6584", "    ", "8888" };
+
+
+// sends every update through a fresh display, checking each lands; returns the most pin writes any one tick did
+//    uint8_t units_per_tick - the display's setting
+//    bool    fixed_pins     - whether to send through a Fixed_Pin_Transfer rather than the usual one
+unsigned long run_updates(uint8_t units_per_tick, bool fixed_pins)
+{
+  Host_Hal::reset();
+  Host_Hal::set_input(DATA_PIN_, HIGH);
+  Host_Hal::set_recording(true, (1UL << CLOCK_PIN_) | (1UL << DATA_PIN_));
+
+  Tm1637_Model          chip(CLOCK_PIN_, DATA_PIN_);
+  Seven_Segment_Display display(CLOCK_PIN_, DATA_PIN_);
+
+  if (fixed_pins) display.use_transfer(new Fixed_Pin_Transfer<CLOCK_PIN_, DATA_PIN_>());
+  display.set_transfer_units_per_tick(units_per_tick);
+
+  unsigned long worst_writes = 0;
+
+  for (size_t i = 0; i < sizeof(UPDATES_) / sizeof(UPDATES_[0]); i++)
+  {
+    display.set_display_contents(UPDATES_[i]);
+
+    unsigned long ticks = 0;
+    while (display.is_update_pending() && ticks < MAX_TICKS_)
+    {
+      Host_Hal::clear_pin_writes();
+      display.tick(Host_Hal::get_micros());
+      if (Host_Hal::get_pin_writes() > worst_writes) worst_writes = Host_Hal::get_pin_writes();
+      ticks++;
+    }
+
+    HOST_CHECK(!display.is_update_pending());
+
+    uint8_t segments[Seven_Segment_Display::DISPLAY_SIZE_];
+    Seven_Segment_Display::encode_string(UPDATES_[i], segments, Seven_Segment_Display::DISPLAY_SIZE_);
+    for (uint8_t digit = 0; digit < Seven_Segment_Display::DISPLAY_SIZE_; digit++)
+    {
+      HOST_CHECK(chip.get_ram(digit) == segments[digit]);
+    }
+  }
+
+  HOST_CHECK(chip.get_counts().bad_commands == 0);
+  HOST_CHECK(display.get_bus_statistics().ack_failures == 0);
+
+  if (chip.get_counts().longest_fight_nanos > MAX_FIGHT_NANOS_)
+  {
+    printf("  DIO driven against the ACK for up to %lluns\n", (unsigned long long)chip.get_counts().longest_fight_nanos);
+  }
+  HOST_CHECK(chip.get_counts().longest_fight_nanos <= MAX_FIGHT_NANOS_);
+
+  if (chip.get_counts().shortest_clock_nanos < Tm1637_Model::MIN_CLOCK_NANOS_)
+  {
+    printf("  CLK high or low for as little as %lluns\n", (unsigned long long)chip.get_counts().shortest_clock_nanos);
+  }
+  HOST_CHECK(chip.get_counts().shortest_clock_nanos >= Tm1637_Model::MIN_CLOCK_NANOS_);
+  HOST_CHECK(chip.get_counts().shortest_setup_nanos >= Tm1637_Model::MIN_SETUP_NANOS_);
+
+  return worst_writes;
+}
+
+
+// the last run's waveform, as (pin, level) pairs in order, without the times
+std::vector<uint16_t> recorded_waveform()
+{
+  std::vector<uint16_t> waveform;
+  const std::vector<Host_Hal::pin_event>& events = Host_Hal::get_pin_events();
+  for (size_t i = 0; i < events.size(); i++) waveform.push_back((uint16_t)((events[i].pin << 8) | events[i].level));
+  return waveform;
+}
+
+
+int main()
+{
+  printf("%-32s %15s\n", "sender", "worst tick");
+
+  const uint8_t units_settings[] = { 1, 2, 4 };
+  for (size_t i = 0; i < sizeof(units_settings); i++)
+  {
+    unsigned long worst = run_updates(units_settings[i], false);
+    printf("Seven_Segment_Transfer, %u / tick %9lu pin writes\n", units_settings[i], worst);
+    HOST_CHECK(worst > 0);
+    HOST_CHECK(worst <= units_settings[i] * MAX_WRITES_PER_UNIT_ + MAX_ACK_WRITES_);
+  }
+
+  // the box's default, both ways, down to the edge
+  unsigned long         runtime_worst    = run_updates(2, false);
+  std::vector<uint16_t> runtime_waveform = recorded_waveform();
+  unsigned long         fixed_worst      = run_updates(2, true);
+  std::vector<uint16_t> fixed_waveform   = recorded_waveform();
+
+  printf("Fixed_Pin_Transfer,     2 / tick %9lu pin writes\n", fixed_worst);
+  printf("waveforms: %zu edges and %zu edges, %s\n", runtime_waveform.size(), fixed_waveform.size(),
+         (runtime_waveform == fixed_waveform) ? "identical" : "DIFFERENT");
+
+  // (Fixed_Pin_Transfer clears the latch when it lets go of DIO, as a write; pinMode() does it without one)
+  HOST_CHECK(fixed_worst <= runtime_worst + 1);
+  HOST_CHECK(!runtime_waveform.empty());
+  HOST_CHECK(runtime_waveform == fixed_waveform);
+
+  return host_check_result();
+}
@@ -0,0 +1,340 @@
+//============================================================================//
+//  Name    : timing_sweep.cpp                                                //
+//  Desc    : Tries every combination of contact time, lockout and light      //
+//            duration in a grid on recorded bouts (Line_Trace files) and on  //
+//            generated scenarios, and prints how each calls the touches      //
+//            compared to the rules as written                                //
+//  Dev     : Nate Cope                                                       //
+//  Version : 1.0                                                             //
+//  Date    : Oct 2026                                                        //
+//  Notes   : - Recorded bouts: every touch (a lockout, and the hits that     //
+//              led to it) is compared with the same bout replayed at the     //
+//              rules as written; a touch is the same if one lands within a   //
+//              lockout of it with the same lights, changed if one lands with //
+//              different lights, and missed if none lands at all; anything   //
+//              left over is an extra touch                                   //
+//            - Generated scenarios: the same seeds at every point, sorted     //
+//              (at most one bucket each) into false positive, missed hit,   //
+//              double hit and invariant failure against what the rules say   //
+//              should have happened; mid-touch mode switches are left out,   //
+//              since the rules don't say what one should do                  //
+//            - Grid points go to a pool of workers, a thread per core, each  //
+//              with its own detection; the results print in grid order once  //
+//              they're all in                                                //
+//            - Exits non-zero if the rules-as-written point itself breaks an //
+//              invariant or calls a recorded touch differently, since that   //
+//              means the sweep, not the timing, is wrong                     //
+//            - timing_sweep [scenarios per point] [trace.fbt ...]            //
+//============================================================================//
+
+// global includes
+#include <stdio.h>
+#include <stdlib.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+#include <Arduino.h>
+
+// local includes
+#include "Hit_Detector.h"
+#include "Hit_Scenario.h"
+#include "Scenario_Checker.h"
+#include "Trace_Replay.h"
+
+// the grid: contact times and lockouts as percentages of the rules as written, and light durations
+static const unsigned long CONTACT_PERCENTS_[]  = { 50, 75, 100, 125, 150 };
+static const unsigned long LOCKOUT_PERCENTS_[]  = { 80, 100, 120 };
+static const unsigned long LIGHT_DURATIONS_[]   = { 1000000, Hit_Detector::LIGHT_DURATION_MICROS_ };
+static const size_t        CONTACT_COUNT_       = sizeof(CONTACT_PERCENTS_) / sizeof(CONTACT_PERCENTS_[0]);
+static const size_t        LOCKOUT_COUNT_       = sizeof(LOCKOUT_PERCENTS_) / sizeof(LOCKOUT_PERCENTS_[0]);
+static const size_t        LIGHT_COUNT_         = sizeof(LIGHT_DURATIONS_)  / sizeof(LIGHT_DURATIONS_[0]);
+static const size_t        POINT_COUNT_         = CONTACT_COUNT_ * LOCKOUT_COUNT_ * LIGHT_COUNT_;
+
+// scenarios at every point unless told otherwise
+static const unsigned long DEFAULT_SCENARIOS_   = 20000;
+
+// how far apart two touches' first hits can be and still be the same touch: the longest lockout there is
+static const unsigned long SAME_TOUCH_MICROS_   = Hit_Detector::FOIL_LOCKOUT_MICROS_;
+
+
+// one grid point's timing
+struct grid_point
+{
+  unsigned long contact_percent;
+  unsigned long lockout_percent;
+  unsigned long light_duration_micros;
+};
+
+// one touch in a recorded bout
+struct recorded_touch
+{
+  unsigned long first_hit_micros;
+  uint8_t       lights;           // Hit_Detector::DECISION_* bits, less the lockout
+};
+
+// how a grid point called the recorded bouts, next to the rules as written
+struct trace_result
+{
+  unsigned long same    = 0;
+  unsigned long changed = 0;
+  unsigned long missed  = 0;
+  unsigned long extra   = 0;
+};
+
+// how a grid point called the generated scenarios
+struct scenario_result
+{
+  unsigned long false_positives    = 0;
+  unsigned long missed_hits        = 0;
+  unsigned long double_hits        = 0;
+  unsigned long invariant_failures = 0;
+};
+
+// a grid point's results
+struct point_result
+{
+  trace_result    traces;
+  scenario_result scenarios;
+};
+
+
+// the grid point with the given index, contact time slowest, light duration fastest
+//    size_t index - from 0 to POINT_COUNT_ - 1
+grid_point get_grid_point(size_t index)
+{
+  grid_point point;
+  point.light_duration_micros = LIGHT_DURATIONS_[index % LIGHT_COUNT_];
+  point.lockout_percent       = LOCKOUT_PERCENTS_[(index / LIGHT_COUNT_) % LOCKOUT_COUNT_];
+  point.contact_percent       = CONTACT_PERCENTS_[index / (LIGHT_COUNT_ * LOCKOUT_COUNT_)];
+  return point;
+}
+
+
+// whether a grid point is the rules as written
+//    const grid_point& point - which
+bool is_rules_as_written(const grid_point& point)
+{
+  return point.contact_percent == 100 && point.lockout_percent == 100 && point.light_duration_micros == Hit_Detector::LIGHT_DURATION_MICROS_;
+}
+
+
+// puts a grid point's timing in force on a detection
+//    Hit_Detector&     detector - the detection
+//    const grid_point& point    - the timing
+void apply_timing(Hit_Detector& detector, const grid_point& point)
+{
+  for (uint8_t m = 0; m < Hit_Scenario::MODE_COUNT_; m++)
+  {
+    detector.set_contact_micros(m, Scenario_Checker::CONTACT_MICROS_BY_MODE_[m] * point.contact_percent / 100);
+    detector.set_lockout_micros(m, Scenario_Checker::LOCKOUT_MICROS_BY_MODE_[m] * point.lockout_percent / 100);
+  }
+  detector.set_light_duration_micros(point.light_duration_micros);
+}
+
+
+// every touch in a recorded bout, as a detection calls it
+//    const Trace_Replay& trace    - the bout
+//    Hit_Detector&       detector - the detection, timing already in force
+std::vector<recorded_touch> find_touches(const Trace_Replay& trace, Hit_Detector& detector)
+{
+  std::vector<recorded_touch> touches;
+  bool                        was_locked_out = false;
+
+  trace.replay(detector, [&](unsigned long sample_time)
+  {
+    bool locked_out = detector.is_locked_out();
+    if (locked_out && !was_locked_out)
+    {
+      recorded_touch touch;
+      if (detector.has_left_hit() && detector.has_right_hit())
+      {
+        touch.first_hit_micros = ((uint32_t)(detector.get_right_hit_micros() - detector.get_left_hit_micros()) < 0x80000000UL)
+                               ? detector.get_left_hit_micros() : detector.get_right_hit_micros();
+      }
+      else
+      {
+        touch.first_hit_micros = detector.has_left_hit() ? detector.get_left_hit_micros() : detector.get_right_hit_micros();
+      }
+      touch.lights = detector.get_decision() & ~Hit_Detector::DECISION_LOCKED_OUT_;
+      touches.push_back(touch);
+    }
+    was_locked_out = locked_out;
+  });
+
+  return touches;
+}
+
+
+// sorts a bout's touches at one timing against the same bout at the rules as written
+//    const std::vector<recorded_touch>& reference - the touches at the rules as written
+//    const std::vector<recorded_touch>& touches   - the touches at the timing being tried
+//    trace_result&                      result    - added to
+void compare_touches(const std::vector<recorded_touch>& reference, const std::vector<recorded_touch>& touches, trace_result& result)
+{
+  std::vector<bool> matched(touches.size(), false);
+
+  for (size_t r = 0; r < reference.size(); r++)
+  {
+    size_t found = touches.size();
+    for (size_t t = 0; t < touches.size() && found == touches.size(); t++)
+    {
+      uint32_t apart = (uint32_t)(touches[t].first_hit_micros - reference[r].first_hit_micros);
+      if (!matched[t] && (apart <= SAME_TOUCH_MICROS_ || (uint32_t)(0 - apart) <= SAME_TOUCH_MICROS_)) found = t;
+    }
+
+    if (found == touches.size())
+    {
+      result.missed++;
+      continue;
+    }
+
+    matched[found] = true;
+    if (touches[found].lights == reference[r].lights) result.same++;
+    else                                                result.changed++;
+  }
+
+  for (size_t t = 0; t < touches.size(); t++)
+  {
+    if (!matched[t]) result.extra++;
+  }
+}
+
+
+// runs the generated scenarios at one timing
+//    Scenario_Checker& checker   - the checker, timing already in force on its detection
+//    unsigned long     scenarios - how many (seeds 1 on)
+//    scenario_result&  result    - filled in
+void run_scenarios(Scenario_Checker& checker, unsigned long scenarios, scenario_result& result)
+{
+  Hit_Scenario              scenario;
+  Scenario_Checker::outcome outcome;
+
+  for (unsigned long seed = 1; seed <= scenarios; seed++)
+  {
+    // the scenarios are always built around the rules as written, whatever's in force
+    scenario.generate(seed, Scenario_Checker::CONTACT_MICROS_BY_MODE_, Scenario_Checker::LOCKOUT_MICROS_BY_MODE_);
+    scenario.clear_mode_switch();
+
+    // what the rules say should happen
+    uint8_t       rules_mode = scenario.get_mode_at(scenario.get_start_micros());
+    unsigned long left_at    = scenario.get_reference_hit_offset(Hit_Scenario::LEFT_FENCER_,  Scenario_Checker::CONTACT_MICROS_BY_MODE_[rules_mode]);
+    unsigned long right_at   = scenario.get_reference_hit_offset(Hit_Scenario::RIGHT_FENCER_, Scenario_Checker::CONTACT_MICROS_BY_MODE_[rules_mode]);
+    unsigned long first_at   = (left_at < right_at) ? left_at : right_at;
+    bool          left_hit   = (left_at  != Hit_Scenario::NO_HIT_) && (left_at  - first_at <= Scenario_Checker::LOCKOUT_MICROS_BY_MODE_[rules_mode]);
+    bool          right_hit  = (right_at != Hit_Scenario::NO_HIT_) && (right_at - first_at <= Scenario_Checker::LOCKOUT_MICROS_BY_MODE_[rules_mode]);
+
+    // and what the detection says did, sorted into (at most) one bucket per scenario
+    if (checker.check(scenario, outcome) != Scenario_Checker::NO_VIOLATION)
+    {
+      result.invariant_failures++;
+    }
+    else if ((left_hit && !outcome.left_scored) || (right_hit && !outcome.right_scored))
+    {
+      result.missed_hits++;
+    }
+    else if (outcome.left_scored && outcome.right_scored && !(left_hit && right_hit))
+    {
+      result.double_hits++;
+    }
+    else if (outcome.left_scored != left_hit || outcome.right_scored != right_hit || outcome.extra_hits > 0)
+    {
+      result.false_positives++;
+    }
+  }
+}
+
+
+int main(int argc, char** argv)
+{
+  unsigned long scenarios = (argc > 1) ? strtoul(argv[1], NULL, 10) : DEFAULT_SCENARIOS_;
+  unsigned int  threads   = std::thread::hardware_concurrency();
+  if (threads == 0) threads = 1;
+  if (threads > POINT_COUNT_) threads = POINT_COUNT_;
+
+  // the recorded bouts, mapped once and shared by every worker, with their touches at the rules as written
+  std::vector<std::unique_ptr<Trace_Replay>>  traces;
+  std::vector<std::vector<recorded_touch>>    reference_touches;
+  unsigned long                               reference_count = 0;
+  for (int i = 2; i < argc; i++)
+  {
+    std::unique_ptr<Trace_Replay> trace(new Trace_Replay());
+    if (!trace->map_file(argv[i]))
+    {
+      return 2;
+    }
+
+    Hit_Detector detector;
+    reference_touches.push_back(find_touches(*trace, detector));
+    reference_count += reference_touches.back().size();
+    traces.push_back(std::move(trace));
+  }
+
+  printf("sweep begin: %zu points, %lu scenarios each, %zu recorded bouts (%lu touches), %u threads\n",
+         POINT_COUNT_, scenarios, traces.size(), reference_count, threads);
+
+  // the pool: each worker takes the next grid point until there are none left
+  std::vector<point_result> results(POINT_COUNT_);
+  std::atomic<size_t>       next_point(0);
+  std::vector<std::thread>  workers;
+
+  for (unsigned int i = 0; i < threads; i++)
+  {
+    workers.emplace_back([&]()
+    {
+      Scenario_Checker checker;
+      Hit_Detector     detector;
+
+      for (size_t index = next_point++; index < POINT_COUNT_; index = next_point++)
+      {
+        grid_point point = get_grid_point(index);
+        apply_timing(checker.get_detector(), point);
+        apply_timing(detector, point);
+
+        for (size_t t = 0; t < traces.size(); t++)
+        {
+          compare_touches(reference_touches[t], find_touches(*traces[t], detector), results[index].traces);
+        }
+        run_scenarios(checker, scenarios, results[index].scenarios);
+      }
+    });
+  }
+
+  for (size_t i = 0; i < workers.size(); i++)
+  {
+    workers[i].join();
+  }
+
+  // the results, in grid order
+  bool sweep_is_sane = true;
+  for (size_t index = 0; index < POINT_COUNT_; index++)
+  {
+    grid_point             point = get_grid_point(index);
+    const point_result&    r     = results[index];
+    double                 per   = (scenarios > 0) ? 100.0 / scenarios : 0.0;
+
+    printf("contact %3lu%%\tlockout %3lu%%\tlights %7luus", point.contact_percent, point.lockout_percent, point.light_duration_micros);
+    if (!traces.empty())
+    {
+      printf("\trecorded: %lu same, %lu changed, %lu missed, %lu extra", r.traces.same, r.traces.changed, r.traces.missed, r.traces.extra);
+    }
+    printf("\tfalse positive: %.2f%%\tmissed hit: %.2f%%\tdouble hit: %.2f%%\tinvariant failures: %lu\n",
+           r.scenarios.false_positives * per, r.scenarios.missed_hits * per, r.scenarios.double_hits * per,
+           r.scenarios.invariant_failures);
+
+    if (is_rules_as_written(point) &&
+        (r.scenarios.invariant_failures > 0 || r.traces.changed > 0 || r.traces.missed > 0 || r.traces.extra > 0))
+    {
+      sweep_is_sane = false;
+    }
+  }
+
+  printf("sweep end\n");
+
+  if (!sweep_is_sane)
+  {
+    fprintf(stderr, "the rules as written don't agree with themselves; the sweep is broken\n");
+    return 1;
+  }
+  return 0;
+}